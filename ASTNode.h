@@ -1,6 +1,8 @@
 #ifndef ASTNode_h
 #define ASTNode_h
 
+#include <memory>
+
 #include "utils.h"
 
 namespace IPG
@@ -10,42 +12,162 @@ namespace IPG
 class ASTNode
 {
 public:
+	static const uint32_t NO_RULE = 0xffffffff;
+	// reach() of a node given to a new tree by Parser::reparse()
+	static const uint32_t MOVED = 0xffffffff;
+
 	ASTNode() {}
-	ASTNode(uint32_t pos, uint32_t line, uint32_t col, std::string text)
+	ASTNode(uint32_t pos, uint32_t line, uint32_t col, std::string text,
+		uint32_t rule_id = NO_RULE)
 	{
 		m_pos = pos;
 		m_line = line;
 		m_col = col;
 		m_text = text;
+		m_rule_id = rule_id;
 	}
+	ASTNode(const ASTNode &other) : m_pos(other.m_pos), m_line(other.m_line), m_col(other.m_col),
+		m_rule_id(other.m_rule_id), m_text(other.m_text), m_children(other.m_children),
+		m_extra((nullptr == other.m_extra) ? nullptr : new Extra(*other.m_extra)) {}
+	ASTNode(ASTNode &&other) = default;
+	ASTNode &operator=(const ASTNode &other)
+	{
+		if (this != &other) *this = ASTNode(other);
+		return *this;
+	}
+	ASTNode &operator=(ASTNode &&other) = default;
 	void clear()
 	{
 		m_pos = 0;
 		m_line = 1;
 		m_col = 1;
+		m_rule_id = NO_RULE;
 		m_text.clear();
 		m_children.clear();
+		m_extra.reset();
 	}
 	uint32_t pos() { return m_pos; }
 	uint32_t line() { return m_line; }
 	uint32_t col() { return m_col; }
 	std::string text() { return m_text; }
 	void add_child(ASTNode &child) { m_children.push_back(child); }
-    ASTNode &child(uint32_t index) { return m_children[index]; }
-	std::vector<ASTNode> &children() { return m_children; }
+	void add_child(ASTNode &&child) { m_children.push_back(std::move(child)); }
+	ASTNode &child(uint32_t index) { return children()[index]; }
+	std::vector<ASTNode> &children()
+	{
+		if (nullptr != m_extra && 0 != (m_extra->shift_pos | m_extra->shift_line | m_extra->shift_col)) push_shift();
+		return m_children;
+	}
+	// id of the rule that built this node (see Parser::rule_name()), or
+	// NO_RULE for text nodes
+	uint32_t rule_id() { return m_rule_id; }
+	// ids of collapsed rules whose only child this node was, innermost
+	// first; only recorded by parsers generated with -e
+	const std::vector<uint32_t> &elided()
+	{
+		static const std::vector<uint32_t> none;
+		return (nullptr == m_extra) ? none : m_extra->elided;
+	}
+	void add_elided(uint32_t rule_id) { extra().elided.push_back(rule_id); }
+	// length of the input of a node left unparsed by a 'lazy' rule (see
+	// Parser::expand()), 0 for parsed nodes
+	uint32_t lazy_len() { return (nullptr == m_extra) ? 0 : m_extra->lazy_len; }
+	void set_lazy_len(uint32_t len) { extra().lazy_len = len; }
+	// length of the input of a counted payload of raw bytes, which is
+	// left out of text() (see %bytes), 0 for other nodes
+	uint32_t span_len() { return (nullptr == m_extra) ? 0 : m_extra->span_len; }
+	void set_span_len(uint32_t len) { extra().span_len = len; }
+	// where the match ends and how far past its start the parser read to
+	// make it, for Parser::reparse(); only set on nodes of rules that can be
+	// reused (parsers generated with -i), reach() is 0 on others
+	uint32_t end() { return (nullptr == m_extra) ? 0 : m_extra->end; }
+	uint32_t end_line() { return (nullptr == m_extra) ? 1 : m_extra->end_line; }
+	uint32_t end_col() { return (nullptr == m_extra) ? 1 : m_extra->end_col; }
+	uint32_t reach() { return (nullptr == m_extra) ? 0 : m_extra->reach; }
+	void set_end(uint32_t end, uint32_t end_line, uint32_t end_col, uint32_t reach)
+	{
+		Extra &ext = extra();
+		ext.end = end;
+		ext.end_line = end_line;
+		ext.end_col = end_col;
+		ext.reach = reach;
+	}
+	void set_reach(uint32_t reach) { extra().reach = reach; }
+	// move node by the given offsets, the column one only applying to its
+	// first line; nodes below it follow as children() reaches them, so this
+	// costs the same for any size of subtree
+	void shift(int32_t pos, int32_t line, int32_t col)
+	{
+		if (0 != reach())
+		{
+			if (m_extra->end_line == m_line) m_extra->end_col += col;
+			m_extra->end += pos;
+			m_extra->end_line += line;
+			if (MOVED != m_extra->reach) m_extra->reach += pos;
+		}
+		m_pos += pos;
+		m_line += line;
+		m_col += col;
+		if (m_children.empty()) return;
+		Extra &ext = extra();
+		ext.shift_pos += pos;
+		ext.shift_line += line;
+		ext.shift_col += col;
+	}
 	void print(uint32_t depth = 0)
 	{
 		prints(std::string(depth * 2, ' '), m_text);
 		if (m_children.size() > 0) prints(": ", m_children.size(), " ", m_pos, " ", m_line, " ", m_col);
 		println("");
-		for (auto child : m_children) child.print(depth + 1);
+		for (auto &child : children()) child.print(depth + 1);
 	}
 private:
+	// data only some nodes have, kept apart so that every other node
+	// carries just a null pointer for it
+	struct Extra
+	{
+		uint32_t lazy_len = 0;
+		uint32_t span_len = 0;
+		uint32_t end = 0;
+		uint32_t end_line = 1;
+		uint32_t end_col = 1;
+		uint32_t reach = 0;
+		// offsets from shift() not yet passed on to the children
+		int32_t shift_pos = 0;
+		int32_t shift_line = 0;
+		int32_t shift_col = 0;
+		std::vector<uint32_t> elided;
+	};
+
 	uint32_t m_pos = 0;
 	uint32_t m_line = 1;
 	uint32_t m_col = 1;
+	uint32_t m_rule_id = NO_RULE;
 	std::string m_text;
 	std::vector<ASTNode> m_children;
+	std::unique_ptr<Extra> m_extra;
+
+	// m_extra, made on first use
+	Extra &extra()
+	{
+		if (nullptr == m_extra) m_extra.reset(new Extra());
+		return *m_extra;
+	}
+
+	// pass pending offsets on to the children; the column one applies to
+	// those on this node's first line as it was before them
+	void push_shift()
+	{
+		Extra &ext = *m_extra;
+		uint32_t line = m_line - ext.shift_line;
+		for (auto &child : m_children)
+		{
+			child.shift(ext.shift_pos, ext.shift_line, (child.m_line == line) ? ext.shift_col : 0);
+		}
+		ext.shift_pos = 0;
+		ext.shift_line = 0;
+		ext.shift_col = 0;
+	}
 };
 };
 
@@ -0,0 +1,215 @@
+#ifndef CodeWriter_h
+#define CodeWriter_h
+
+#include <cstdio>
+#include <string>
+
+#include "utils.h"
+
+namespace IPG
+{
+// ----------------------------------------------------------------------------
+// buffered writer for generated source code
+//
+// appends to one large buffer and hands it to fwrite() in big blocks;
+// integers are formatted in place and indentation is written straight
+// from Indent values, so emitting code allocates nothing per call
+class CodeWriter
+{
+public:
+	// ------------------------------------------------------------------------
+	// indentation of n tabs (plus the writer's base indent) when printed
+	struct Indent
+	{
+		explicit Indent(uint32_t n_r) : n(n_r) {}
+		uint32_t n;
+	};
+
+	// ------------------------------------------------------------------------
+	CodeWriter(size_t flush_size = 1 << 20) : m_flush_size(flush_size)
+	{
+		m_buf.reserve(flush_size + (flush_size >> 2));
+	}
+
+	~CodeWriter() { close(); }
+
+	// ------------------------------------------------------------------------
+	// write to path, or to stdout if path is nullptr or "-"
+	// returns false on failure
+	bool open(const char *path)
+	{
+		close();
+		m_ok = true;
+		m_changed = true;
+		if (nullptr == path || std::string("-") == path)
+		{
+			m_fp = stdout;
+			return true;
+		}
+		m_fp = fopen(path, "wb");
+		m_owns_fp = (nullptr != m_fp);
+		return m_owns_fp;
+	}
+
+	// ------------------------------------------------------------------------
+	// write to an already-open stream, e.g. stderr; not closed by close()
+	void open(FILE *fp)
+	{
+		close();
+		m_ok = true;
+		m_changed = true;
+		m_fp = fp;
+	}
+
+	// ------------------------------------------------------------------------
+	// hold all output in memory and on close() write it to path only if it
+	// differs from the file's current contents, so an unchanged file keeps
+	// its timestamp
+	void open_if_changed(const char *path)
+	{
+		close();
+		m_ok = true;
+		m_changed = false;
+		m_hold_path = path;
+		m_hold = true;
+	}
+
+	// ------------------------------------------------------------------------
+	// whether the last close() wrote anything
+	bool changed() { return m_changed; }
+
+	// ------------------------------------------------------------------------
+	// returns false if any write failed
+	bool close()
+	{
+		if (m_hold)
+		{
+			m_hold = false;
+			m_changed = !file_equals(m_hold_path.c_str(), m_buf);
+			if (m_changed)
+			{
+				FILE *fp = fopen(m_hold_path.c_str(), "wb");
+				m_ok &= (nullptr != fp);
+				if (nullptr != fp)
+				{
+					m_ok &= (fwrite(m_buf.data(), 1, m_buf.size(), fp) == m_buf.size());
+					m_ok &= (0 == fclose(fp));
+				}
+			}
+			m_buf.clear();
+			return m_ok;
+		}
+		flush();
+		if (m_owns_fp) m_ok &= (0 == fclose(m_fp));
+		m_fp = nullptr;
+		m_owns_fp = false;
+		return m_ok;
+	}
+
+	// ------------------------------------------------------------------------
+	void flush()
+	{
+		if (m_hold) return;
+		if (nullptr == m_fp) m_fp = stdout;
+		if (m_buf.size() > 0)
+		{
+			m_ok &= (fwrite(m_buf.data(), 1, m_buf.size(), m_fp) == m_buf.size());
+		}
+		m_buf.clear();
+	}
+
+	// ------------------------------------------------------------------------
+	// tabs added to (or, if negative, removed from) every Indent printed
+	int32_t &indent_base() { return m_indent_base; }
+
+	// ------------------------------------------------------------------------
+	// no separator, no terminator
+	template<typename T, typename... Args>
+	void prints(const T &t, const Args &... args)
+	{
+		put(t);
+		prints(args...);
+	}
+
+	// ------------------------------------------------------------------------
+	// no separator, newline-terminated
+	template<typename T, typename... Args>
+	void println(const T &t, const Args &... args)
+	{
+		prints(t, args...);
+		m_buf += '\n';
+		if (m_buf.size() >= m_flush_size) flush();
+	}
+
+private:
+	void prints() {}
+
+	// ------------------------------------------------------------------------
+	static bool file_equals(const char *path, const std::string &str)
+	{
+		FILE *fp = fopen(path, "rb");
+		if (nullptr == fp) return false;
+		fseek(fp, 0, SEEK_END);
+		size_t len = ftell(fp);
+		fseek(fp, 0, SEEK_SET);
+		bool equal = false;
+		if (len == str.size())
+		{
+			std::string contents(len, '\0');
+			equal = (fread(&contents[0], 1, len, fp) == len && contents == str);
+		}
+		fclose(fp);
+		return equal;
+	}
+
+	void put(const std::string &str) { m_buf += str; }
+	void put(const char *str) { m_buf += str; }
+	void put(char ch) { m_buf += ch; }
+
+	void put(const Indent &indent)
+	{
+		int32_t n = (int32_t)indent.n + m_indent_base;
+		if (n > 0) m_buf.append((size_t)n, '\t');
+	}
+
+	void put(int val) { put((long long)val); }
+	void put(long val) { put((long long)val); }
+	void put(unsigned val) { put((unsigned long long)val); }
+	void put(unsigned long val) { put((unsigned long long)val); }
+
+	void put(long long val)
+	{
+		if (val < 0)
+		{
+			m_buf += '-';
+			put(0ULL - (unsigned long long)val);
+		}
+		else put((unsigned long long)val);
+	}
+
+	void put(unsigned long long val)
+	{
+		char digits[20];
+		int32_t n = 0;
+		do
+		{
+			digits[n++] = (char)('0' + val % 10);
+			val /= 10;
+		}
+		while (val > 0);
+		while (n > 0) m_buf += digits[--n];
+	}
+
+	std::string m_buf;
+	size_t m_flush_size;
+	FILE *m_fp = nullptr;
+	bool m_owns_fp = false;
+	bool m_ok = true;
+	bool m_changed = false;
+	bool m_hold = false;
+	std::string m_hold_path;
+	int32_t m_indent_base = 0;
+};
+};
+
+#endif
@@ -0,0 +1,226 @@
+#ifndef Input_h
+#define Input_h
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace IPG
+{
+// ----------------------------------------------------------------------------
+// input cursors generated parsers (ParserT<Input>) read their text through
+//
+// positions are offsets from the start of the whole input, however it is
+// laid out in memory, so node positions do not depend on the layout. An
+// input gives:
+//   len()              its length in bytes
+//   in[pos]            the byte at pos, '\0' at len()
+//   span(pos, n)       pointer to the n bytes from pos, valid until the next
+//                      call; bytes past len() read as '\0' (TextInput only
+//                      guarantees the one at len())
+//   find(pos, str, n)  start of the first n bytes equal to str at or after
+//                      pos, or std::string::npos
+//   newlines(from, to, line_start)
+//                      number of '\n' from from to to; line_start is set
+//                      past the last one, if any
+
+// ----------------------------------------------------------------------------
+// one contiguous buffer, read with plain loads
+class TextInput
+{
+public:
+	// text[len] must be '\0'
+	TextInput(const char *text, size_t len) : m_text(text), m_len(len) {}
+
+	// ------------------------------------------------------------------------
+	size_t len() const { return m_len; }
+
+	// ------------------------------------------------------------------------
+	char operator[](size_t pos) const { return m_text[pos]; }
+
+	// ------------------------------------------------------------------------
+	const char *span(size_t pos, size_t n) const { (void)n; return m_text + pos; }
+
+	// ------------------------------------------------------------------------
+	// strstr() (a fast substring search in common C libraries) finds the
+	// first match before any '\0'; past one (see %bytes), candidates are
+	// found with memchr() and checked with memcmp()
+	size_t find(size_t pos, const char *str, size_t n) const
+	{
+		if (0 == n) return pos;
+		const char *end = m_text + m_len;
+		const char *from = m_text + pos;
+		if (strlen(str) == n)
+		{
+			const char *at = strstr(from, str);
+			if (nullptr != at) return at - m_text;
+			from += strlen(from);
+			if (from >= end) return std::string::npos;
+		}
+		for (const char *at = from; (size_t)(end - at) >= n; at++)
+		{
+			// only where a whole match still fits
+			at = (const char *)memchr(at, str[0], end - at - n + 1);
+			if (nullptr == at) break;
+			if (0 == memcmp(at, str, n)) return at - m_text;
+		}
+		return std::string::npos;
+	}
+
+	// ------------------------------------------------------------------------
+	uint32_t newlines(size_t from, size_t to, size_t &line_start) const
+	{
+		uint32_t lines = 0;
+		for (const char *nl; nullptr != (nl = (const char *)memchr(m_text + from, '\n', to - from)); lines++)
+		{
+			from = nl - m_text + 1;
+			line_start = from;
+		}
+		return lines;
+	}
+
+private:
+	const char *m_text;
+	size_t m_len;
+};
+
+// ----------------------------------------------------------------------------
+// one piece of an input held elsewhere, e.g. a leaf of a rope or a piece of
+// a piece table
+struct Chunk
+{
+	const char *data;
+	size_t len;
+};
+
+// ----------------------------------------------------------------------------
+// input made of chunks that are not contiguous in memory, read in place
+//
+// the chunk last read from is kept, so reading within it costs a range
+// check per byte; reading on into the next chunk is one more compare, and
+// anywhere else a binary search over chunk starts. Matches that cross a
+// chunk boundary are copied into a scratch buffer. The chunks must stay in
+// place while parsing
+class ChunkInput
+{
+public:
+	ChunkInput(const Chunk *chunks, size_t n_chunks)
+	{
+		for (size_t i = 0; i < n_chunks; i++)
+		{
+			if (0 == chunks[i].len) continue;
+			m_chunks.push_back(chunks[i]);
+			m_starts.push_back(m_len);
+			m_len += chunks[i].len;
+		}
+		m_starts.push_back(m_len);
+	}
+
+	ChunkInput(const std::vector<Chunk> &chunks) : ChunkInput(chunks.data(), chunks.size()) {}
+
+	// ------------------------------------------------------------------------
+	size_t len() const { return m_len; }
+
+	// ------------------------------------------------------------------------
+	char operator[](size_t pos)
+	{
+		if (pos - m_from < m_size || seek(pos)) return m_data[pos - m_from];
+		return '\0';
+	}
+
+	// ------------------------------------------------------------------------
+	const char *span(size_t pos, size_t n)
+	{
+		if (pos - m_from < m_size && n <= m_size - (pos - m_from)) return m_data + (pos - m_from);
+		m_scratch.assign(n, '\0');
+		for (size_t i = 0; i < n && seek(pos + i);)
+		{
+			size_t avail = m_size - (pos + i - m_from);
+			size_t copy = (n - i < avail) ? n - i : avail;
+			memcpy(&m_scratch[i], m_data + (pos + i - m_from), copy);
+			i += copy;
+		}
+		return m_scratch.c_str();
+	}
+
+	// ------------------------------------------------------------------------
+	// candidates for str[0] are found with memchr() in each chunk, then
+	// compared in place or, crossing into the next chunk, through span()
+	size_t find(size_t pos, const char *str, size_t n)
+	{
+		if (0 == n) return pos;
+		while (pos + n <= m_len && seek(pos))
+		{
+			const char *from = m_data + (pos - m_from);
+			const char *at = (const char *)memchr(from, str[0], m_size - (pos - m_from));
+			if (nullptr == at)
+			{
+				pos = m_from + m_size;
+				continue;
+			}
+			pos = m_from + (at - m_data);
+			if (pos + n > m_len) break;
+			if (0 == memcmp(span(pos, n), str, n)) return pos;
+			pos++;
+		}
+		return std::string::npos;
+	}
+
+	// ------------------------------------------------------------------------
+	uint32_t newlines(size_t from, size_t to, size_t &line_start)
+	{
+		uint32_t lines = 0;
+		while (from < to && seek(from))
+		{
+			size_t end = (m_from + m_size < to) ? m_from + m_size : to;
+			const char *nl = (const char *)memchr(m_data + (from - m_from), '\n', end - from);
+			if (nullptr == nl) from = end;
+			else
+			{
+				from = m_from + (nl - m_data) + 1;
+				line_start = from;
+				lines++;
+			}
+		}
+		return lines;
+	}
+
+private:
+	std::vector<Chunk> m_chunks;
+	// start of each chunk, plus len()
+	std::vector<size_t> m_starts;
+	size_t m_len = 0;
+	// current chunk
+	size_t m_index = 0;
+	const char *m_data = nullptr;
+	size_t m_from = 0;
+	size_t m_size = 0;
+	std::string m_scratch;
+
+	// ------------------------------------------------------------------------
+	// make the chunk holding pos current; false if pos is at or past len()
+	bool seek(size_t pos)
+	{
+		if (pos >= m_len) return false;
+		if (pos - m_from >= m_size)
+		{
+			if (m_index + 1 < m_chunks.size() && pos >= m_starts[m_index + 1] && pos < m_starts[m_index + 2])
+			{
+				m_index++;
+			}
+			else
+			{
+				m_index = std::upper_bound(m_starts.begin(), m_starts.end(), pos) - m_starts.begin() - 1;
+			}
+			m_data = m_chunks[m_index].data;
+			m_from = m_starts[m_index];
+			m_size = m_chunks[m_index].len;
+		}
+		return true;
+	}
+};
+};
+
+#endif
@@ -0,0 +1,252 @@
+#ifndef StructuralIndex_h
+#define StructuralIndex_h
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace IPG
+{
+// ----------------------------------------------------------------------------
+// bitmaps of the bytes of an input a parser stops at, built before parsing
+// for grammars declaring their structural characters (%structural)
+//
+// the first pass marks, 64 bytes at a time, every byte that is structural,
+// a quote, the escape character, '\n', the first byte of the line comment
+// start or, in UTF-8 text, past ASCII; with SSE2 each of these is compared
+// against 16 bytes at once. The second visits only quotes, escapes and
+// comment starts and ends, finding quoted strings and line comments the
+// way 'lazy' rules scan for them, and marks the structural characters
+// outside them plus the quotes each string starts and ends with. Parsers
+// then move from mark to mark instead of reading every byte. Two bits per
+// input byte
+class StructuralIndex
+{
+public:
+	// ------------------------------------------------------------------------
+	// index input in: chars are its structural characters, quotes its
+	// quote characters and comment its line comment start (all
+	// '\0'-terminated, so none may hold '\0'); escape, unless '\0', makes
+	// the byte after it in a string part of the string; utf8 marks bytes
+	// past ASCII
+	template<typename Input>
+	void build(Input &in, const char *chars, const char *quotes, const char *comment, char escape, bool utf8)
+	{
+		m_len = in.len();
+		m_marks.assign(m_len / 64 + 1, 0);
+		m_structural.assign(m_len / 64 + 1, 0);
+		memset(m_kind, 0, sizeof(m_kind));
+		for (const char *ch = chars; *ch != '\0'; ch++) m_kind[(uint8_t)*ch] |= 1 << STRUCTURAL;
+		for (const char *ch = quotes; *ch != '\0'; ch++) m_kind[(uint8_t)*ch] |= 1 << QUOTE;
+		m_kind[(uint8_t)comment[0]] |= 1 << COMMENT;
+		m_kind[(uint8_t)escape] |= 1 << ESCAPE;
+		m_kind['\n'] |= 1 << NEWLINE;
+		m_kind[0] = 0;
+		for (int32_t byte = 0x80; byte < 0x100 && utf8; byte++) m_kind[byte] |= 1 << NON_ASCII;
+		const size_t comment_len = strlen(comment);
+
+		// bytes that change what is structural: quotes, the escape, the
+		// comment start and, if there is one, the newline ending it
+		uint8_t special[256] = {};
+		for (int32_t byte = 1; byte < 0x100; byte++)
+		{
+			special[byte] = 0 != (m_kind[byte] & ((1 << QUOTE) | (1 << ESCAPE) | (1 << COMMENT)));
+		}
+		special['\n'] = comment_len > 0;
+#if defined(__SSE2__)
+		// structural, then special, then other marked bytes, compared one
+		// at a time; the rest of UTF-8 is found by its sign bit
+		__m128i splats[256];
+		uint32_t n_structural = 0, n_special = 0, n_splats = 0;
+		for (int32_t byte = 1; byte < 0x100; byte++)
+		{
+			if (m_kind[byte] & (1 << STRUCTURAL)) splats[n_splats++] = _mm_set1_epi8((char)byte);
+		}
+		n_structural = n_splats;
+		for (int32_t byte = 1; byte < 0x100; byte++)
+		{
+			if (special[byte]) splats[n_splats++] = _mm_set1_epi8((char)byte);
+		}
+		n_special = n_splats;
+		if (!special['\n']) splats[n_splats++] = _mm_set1_epi8('\n');
+#endif
+
+		// quote of the string being walked, '\0' outside any; position of
+		// the byte escaped in it
+		uint8_t quote = 0;
+		bool in_comment = false;
+		size_t escaped = m_len;
+		for (size_t from = 0; from < m_len; from += 64)
+		{
+			// past the end reads as '\0', which is never marked
+			uint8_t block[64] = {};
+			size_t n = (m_len - from < 64) ? m_len - from : 64;
+			memcpy(block, in.span(from, n), n);
+
+			// bytes of the block that are marked, structural and special
+			uint64_t marks = 0, structurals = 0, specials = 0;
+#if defined(__SSE2__)
+			for (uint32_t part = 0; part < 4; part++)
+			{
+				__m128i bytes = _mm_loadu_si128((const __m128i *)(block + 16 * part));
+				__m128i hits_structural = _mm_setzero_si128();
+				__m128i hits_special = _mm_setzero_si128();
+				__m128i hits = utf8 ? bytes : _mm_setzero_si128();
+				uint32_t s = 0;
+				for (; s < n_structural; s++) hits_structural = _mm_or_si128(hits_structural, _mm_cmpeq_epi8(bytes, splats[s]));
+				for (; s < n_special; s++) hits_special = _mm_or_si128(hits_special, _mm_cmpeq_epi8(bytes, splats[s]));
+				for (; s < n_splats; s++) hits = _mm_or_si128(hits, _mm_cmpeq_epi8(bytes, splats[s]));
+				hits = _mm_or_si128(hits, _mm_or_si128(hits_structural, hits_special));
+				marks |= (uint64_t)(uint32_t)_mm_movemask_epi8(hits) << (16 * part);
+				structurals |= (uint64_t)(uint32_t)_mm_movemask_epi8(hits_structural) << (16 * part);
+				specials |= (uint64_t)(uint32_t)_mm_movemask_epi8(hits_special) << (16 * part);
+			}
+#else
+			for (uint32_t i = 0; i < 64; i++)
+			{
+				marks |= (uint64_t)(0 != m_kind[block[i]]) << i;
+				structurals |= (uint64_t)((m_kind[block[i]] >> STRUCTURAL) & 1) << i;
+				specials |= (uint64_t)special[block[i]] << i;
+			}
+#endif
+			m_marks[from / 64] = marks;
+
+			// only special bytes change what is structural, so structural
+			// bytes between them are taken as a whole mask
+			uint64_t structural = 0;
+			for (uint32_t i = 0; i < 64;)
+			{
+				uint64_t ahead = ~(uint64_t)0 << i;
+				uint64_t bits = specials & ahead;
+				if (0 == quote && !in_comment)
+				{
+					bits &= ~structurals;
+					// up to the next special byte, if any
+					uint64_t upto = (0 == bits) ? ahead : ahead & (((uint64_t)2 << ctz(bits)) - 1);
+					structural |= structurals & upto;
+				}
+				if (0 == bits) break;
+				uint32_t bit = ctz(bits);
+				size_t pos = from + bit;
+				uint8_t ch = block[bit];
+				i = bit + 1;
+				if (0 != quote)
+				{
+					if (pos == escaped) continue;
+					if ((uint8_t)escape == ch) escaped = pos + 1;
+					else if (quote == ch)
+					{
+						quote = 0;
+						structural |= (uint64_t)1 << bit;
+					}
+				}
+				// a comment runs to its newline, which is read as usual
+				else if (in_comment)
+				{
+					if ('\n' != ch) continue;
+					in_comment = false;
+					i = bit;
+				}
+				else if ((m_kind[ch] & (1 << COMMENT)) && m_len - pos >= comment_len
+					&& 0 == memcmp(in.span(pos, comment_len), comment, comment_len))
+				{
+					in_comment = true;
+				}
+				else if (m_kind[ch] & (1 << QUOTE))
+				{
+					quote = ch;
+					structural |= (uint64_t)1 << bit;
+				}
+			}
+			m_structural[from / 64] = structural;
+		}
+		m_built = true;
+	}
+
+	// ------------------------------------------------------------------------
+	bool built() const { return m_built; }
+
+	// ------------------------------------------------------------------------
+	size_t len() const { return m_len; }
+
+	// ------------------------------------------------------------------------
+	// whether ch is one of the structural characters
+	bool structural_char(uint8_t ch) const { return 0 != (m_kind[ch] & (1 << STRUCTURAL)); }
+
+	// ------------------------------------------------------------------------
+	// whether pos holds a structural character outside strings and comments
+	// or a quote starting or ending a string
+	bool structural(size_t pos) const
+	{
+		return m_built && pos < m_len && ((m_structural[pos / 64] >> (pos % 64)) & 1);
+	}
+
+	// ------------------------------------------------------------------------
+	// first marked byte at or after pos, or len(); pos itself if the index
+	// is not built, so callers step byte by byte
+	size_t next_mark(size_t pos) const
+	{
+		if (!m_built) return pos;
+		return next(m_marks, pos);
+	}
+
+	// ------------------------------------------------------------------------
+	// first position at or after pos that structural() holds for, or len()
+	size_t next_structural(size_t pos) const
+	{
+		if (!m_built) return m_len;
+		return next(m_structural, pos);
+	}
+
+private:
+	// kinds of byte the index marks, as bit numbers in m_kind
+	enum
+	{
+		STRUCTURAL,
+		QUOTE,
+		COMMENT,
+		ESCAPE,
+		NEWLINE,
+		NON_ASCII,
+		N_KINDS
+	};
+
+	std::vector<uint64_t> m_marks;
+	std::vector<uint64_t> m_structural;
+	uint8_t m_kind[256] = {};
+	size_t m_len = 0;
+	bool m_built = false;
+
+	// ------------------------------------------------------------------------
+	static uint32_t ctz(uint64_t bits)
+	{
+#if defined(__GNUC__)
+		return (uint32_t)__builtin_ctzll(bits);
+#else
+		uint32_t n = 0;
+		for (; 0 == (bits & 1); bits >>= 1) n++;
+		return n;
+#endif
+	}
+
+	// ------------------------------------------------------------------------
+	// first set bit of words at or after pos, or len()
+	size_t next(const std::vector<uint64_t> &words, size_t pos) const
+	{
+		if (pos >= m_len) return m_len;
+		size_t word = pos / 64;
+		uint64_t bits = words[word] & (~(uint64_t)0 << (pos % 64));
+		while (0 == bits)
+		{
+			if (++word == words.size()) return m_len;
+			bits = words[word];
+		}
+		return word * 64 + ctz(bits);
+	}
+};
+};
+
+#endif
@@ -0,0 +1,154 @@
+#ifndef TypedAST_h
+#define TypedAST_h
+
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <vector>
+
+#include "utils.h"
+
+namespace IPG
+{
+// ----------------------------------------------------------------------------
+// bump allocator for typed AST nodes
+//
+// memory is taken from large blocks and only given back all at once, by
+// reset() to a mark() or by the destructor; blocks are kept for reuse, so
+// building tree after tree into the same arena stops allocating once it has
+// grown to fit the largest. Objects are never destroyed, so only trivially
+// destructible types (like the generated node structs) may be allocated
+class Arena
+{
+public:
+	// ------------------------------------------------------------------------
+	// position to reset() to
+	struct Mark
+	{
+		size_t block;
+		size_t used;
+	};
+
+	Arena(size_t block_size = 1 << 16) : m_block_size(block_size) {}
+	~Arena() { for (auto &block : m_blocks) free(block.data); }
+	Arena(const Arena &) = delete;
+	Arena &operator=(const Arena &) = delete;
+
+	// ------------------------------------------------------------------------
+	// size bytes, aligned for any type
+	void *alloc(size_t size)
+	{
+		const size_t align = alignof(std::max_align_t);
+		size = (size + align - 1) & ~(align - 1);
+		while (m_block < m_blocks.size() && m_used + size > m_blocks[m_block].size)
+		{
+			m_block++;
+			m_used = 0;
+		}
+		if (m_block == m_blocks.size())
+		{
+			Block block;
+			block.size = (size > m_block_size) ? size : m_block_size;
+			block.data = (char *)malloc(block.size);
+			if (nullptr == block.data) throw std::bad_alloc();
+			m_blocks.push_back(block);
+		}
+		void *ptr = m_blocks[m_block].data + m_used;
+		m_used += size;
+		return ptr;
+	}
+
+	// ------------------------------------------------------------------------
+	template<typename T>
+	T *make() { return new (alloc(sizeof(T))) T(); }
+
+	// ------------------------------------------------------------------------
+	// array of n null pointers
+	template<typename T>
+	T **ptrs(uint32_t n)
+	{
+		if (0 == n) return nullptr;
+		T **items = (T **)alloc(n * sizeof(T *));
+		memset(items, 0, n * sizeof(T *));
+		return items;
+	}
+
+	// ------------------------------------------------------------------------
+	// len chars plus a terminating '\0'
+	char *chars(size_t len)
+	{
+		char *str = (char *)alloc(len + 1);
+		str[len] = '\0';
+		return str;
+	}
+
+	// ------------------------------------------------------------------------
+	Mark mark() { return Mark{m_block, m_used}; }
+
+	// ------------------------------------------------------------------------
+	// drop everything allocated since mark was taken
+	void reset(Mark mark)
+	{
+		m_block = mark.block;
+		m_used = mark.used;
+	}
+
+	// ------------------------------------------------------------------------
+	void clear() { reset(Mark{0, 0}); }
+
+private:
+	struct Block
+	{
+		char *data;
+		size_t size;
+	};
+	std::vector<Block> m_blocks;
+	size_t m_block_size;
+	size_t m_block = 0;
+	size_t m_used = 0;
+};
+
+// ----------------------------------------------------------------------------
+// fixed-size list of node pointers held in an Arena
+template<typename T>
+struct NodeList
+{
+	T **items = nullptr;
+	uint32_t size = 0;
+
+	T *operator[](uint32_t index) const { return items[index]; }
+	T **begin() const { return items; }
+	T **end() const { return items + size; }
+};
+
+// ----------------------------------------------------------------------------
+// base of the node structs generated with ipg -t
+//
+// text is the text of the rule's own string and character class matches
+// (and those of 'inline' rules it calls), concatenated
+struct TypedNode
+{
+	// rule_id of text nodes
+	static const uint32_t NO_RULE = 0xffffffff;
+	// rule_id of operator level nodes (OpNode)
+	static const uint32_t OP_LEVEL = 0xfffffffe;
+
+	uint32_t rule_id = NO_RULE;
+	uint32_t pos = 0;
+	uint32_t line = 1;
+	uint32_t col = 1;
+	const char *text = "";
+	uint32_t text_len = 0;
+};
+
+// ----------------------------------------------------------------------------
+// node of one level of an 'operators' rule: its operands and operators (as
+// text nodes) in input order; text is the level's name
+struct OpNode : TypedNode
+{
+	NodeList<TypedNode> items;
+};
+};
+
+#endif
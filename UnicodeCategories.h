@@ -0,0 +1,820 @@
+#ifndef UnicodeCategories_h
+#define UnicodeCategories_h
+
+#include <cstddef>
+#include <cstdint>
+
+namespace IPG
+{
+// ----------------------------------------------------------------------------
+// general categories of Unicode 14.0.0, from the Unicode Character Database,
+// as runs of code points: each run starts at first and ends right before the
+// next one (the last at U+10FFFF); unassigned code points are "Cn"
+struct UnicodeRun
+{
+	int32_t first;
+	char category[3];
+};
+
+const UnicodeRun UNICODE_RUNS[] =
+{
+	{0x000000, "Cc"}, {0x000020, "Zs"}, {0x000021, "Po"}, {0x000024, "Sc"}, {0x000025, "Po"},
+	{0x000028, "Ps"}, {0x000029, "Pe"}, {0x00002a, "Po"}, {0x00002b, "Sm"}, {0x00002c, "Po"},
+	{0x00002d, "Pd"}, {0x00002e, "Po"}, {0x000030, "Nd"}, {0x00003a, "Po"}, {0x00003c, "Sm"},
+	{0x00003f, "Po"}, {0x000041, "Lu"}, {0x00005b, "Ps"}, {0x00005c, "Po"}, {0x00005d, "Pe"},
+	{0x00005e, "Sk"}, {0x00005f, "Pc"}, {0x000060, "Sk"}, {0x000061, "Ll"}, {0x00007b, "Ps"},
+	{0x00007c, "Sm"}, {0x00007d, "Pe"}, {0x00007e, "Sm"}, {0x00007f, "Cc"}, {0x0000a0, "Zs"},
+	{0x0000a1, "Po"}, {0x0000a2, "Sc"}, {0x0000a6, "So"}, {0x0000a7, "Po"}, {0x0000a8, "Sk"},
+	{0x0000a9, "So"}, {0x0000aa, "Lo"}, {0x0000ab, "Pi"}, {0x0000ac, "Sm"}, {0x0000ad, "Cf"},
+	{0x0000ae, "So"}, {0x0000af, "Sk"}, {0x0000b0, "So"}, {0x0000b1, "Sm"}, {0x0000b2, "No"},
+	{0x0000b4, "Sk"}, {0x0000b5, "Ll"}, {0x0000b6, "Po"}, {0x0000b8, "Sk"}, {0x0000b9, "No"},
+	{0x0000ba, "Lo"}, {0x0000bb, "Pf"}, {0x0000bc, "No"}, {0x0000bf, "Po"}, {0x0000c0, "Lu"},
+	{0x0000d7, "Sm"}, {0x0000d8, "Lu"}, {0x0000df, "Ll"}, {0x0000f7, "Sm"}, {0x0000f8, "Ll"},
+	{0x000100, "Lu"}, {0x000101, "Ll"}, {0x000102, "Lu"}, {0x000103, "Ll"}, {0x000104, "Lu"},
+	{0x000105, "Ll"}, {0x000106, "Lu"}, {0x000107, "Ll"}, {0x000108, "Lu"}, {0x000109, "Ll"},
+	{0x00010a, "Lu"}, {0x00010b, "Ll"}, {0x00010c, "Lu"}, {0x00010d, "Ll"}, {0x00010e, "Lu"},
+	{0x00010f, "Ll"}, {0x000110, "Lu"}, {0x000111, "Ll"}, {0x000112, "Lu"}, {0x000113, "Ll"},
+	{0x000114, "Lu"}, {0x000115, "Ll"}, {0x000116, "Lu"}, {0x000117, "Ll"}, {0x000118, "Lu"},
+	{0x000119, "Ll"}, {0x00011a, "Lu"}, {0x00011b, "Ll"}, {0x00011c, "Lu"}, {0x00011d, "Ll"},
+	{0x00011e, "Lu"}, {0x00011f, "Ll"}, {0x000120, "Lu"}, {0x000121, "Ll"}, {0x000122, "Lu"},
+	{0x000123, "Ll"}, {0x000124, "Lu"}, {0x000125, "Ll"}, {0x000126, "Lu"}, {0x000127, "Ll"},
+	{0x000128, "Lu"}, {0x000129, "Ll"}, {0x00012a, "Lu"}, {0x00012b, "Ll"}, {0x00012c, "Lu"},
+	{0x00012d, "Ll"}, {0x00012e, "Lu"}, {0x00012f, "Ll"}, {0x000130, "Lu"}, {0x000131, "Ll"},
+	{0x000132, "Lu"}, {0x000133, "Ll"}, {0x000134, "Lu"}, {0x000135, "Ll"}, {0x000136, "Lu"},
+	{0x000137, "Ll"}, {0x000139, "Lu"}, {0x00013a, "Ll"}, {0x00013b, "Lu"}, {0x00013c, "Ll"},
+	{0x00013d, "Lu"}, {0x00013e, "Ll"}, {0x00013f, "Lu"}, {0x000140, "Ll"}, {0x000141, "Lu"},
+	{0x000142, "Ll"}, {0x000143, "Lu"}, {0x000144, "Ll"}, {0x000145, "Lu"}, {0x000146, "Ll"},
+	{0x000147, "Lu"}, {0x000148, "Ll"}, {0x00014a, "Lu"}, {0x00014b, "Ll"}, {0x00014c, "Lu"},
+	{0x00014d, "Ll"}, {0x00014e, "Lu"}, {0x00014f, "Ll"}, {0x000150, "Lu"}, {0x000151, "Ll"},
+	{0x000152, "Lu"}, {0x000153, "Ll"}, {0x000154, "Lu"}, {0x000155, "Ll"}, {0x000156, "Lu"},
+	{0x000157, "Ll"}, {0x000158, "Lu"}, {0x000159, "Ll"}, {0x00015a, "Lu"}, {0x00015b, "Ll"},
+	{0x00015c, "Lu"}, {0x00015d, "Ll"}, {0x00015e, "Lu"}, {0x00015f, "Ll"}, {0x000160, "Lu"},
+	{0x000161, "Ll"}, {0x000162, "Lu"}, {0x000163, "Ll"}, {0x000164, "Lu"}, {0x000165, "Ll"},
+	{0x000166, "Lu"}, {0x000167, "Ll"}, {0x000168, "Lu"}, {0x000169, "Ll"}, {0x00016a, "Lu"},
+	{0x00016b, "Ll"}, {0x00016c, "Lu"}, {0x00016d, "Ll"}, {0x00016e, "Lu"}, {0x00016f, "Ll"},
+	{0x000170, "Lu"}, {0x000171, "Ll"}, {0x000172, "Lu"}, {0x000173, "Ll"}, {0x000174, "Lu"},
+	{0x000175, "Ll"}, {0x000176, "Lu"}, {0x000177, "Ll"}, {0x000178, "Lu"}, {0x00017a, "Ll"},
+	{0x00017b, "Lu"}, {0x00017c, "Ll"}, {0x00017d, "Lu"}, {0x00017e, "Ll"}, {0x000181, "Lu"},
+	{0x000183, "Ll"}, {0x000184, "Lu"}, {0x000185, "Ll"}, {0x000186, "Lu"}, {0x000188, "Ll"},
+	{0x000189, "Lu"}, {0x00018c, "Ll"}, {0x00018e, "Lu"}, {0x000192, "Ll"}, {0x000193, "Lu"},
+	{0x000195, "Ll"}, {0x000196, "Lu"}, {0x000199, "Ll"}, {0x00019c, "Lu"}, {0x00019e, "Ll"},
+	{0x00019f, "Lu"}, {0x0001a1, "Ll"}, {0x0001a2, "Lu"}, {0x0001a3, "Ll"}, {0x0001a4, "Lu"},
+	{0x0001a5, "Ll"}, {0x0001a6, "Lu"}, {0x0001a8, "Ll"}, {0x0001a9, "Lu"}, {0x0001aa, "Ll"},
+	{0x0001ac, "Lu"}, {0x0001ad, "Ll"}, {0x0001ae, "Lu"}, {0x0001b0, "Ll"}, {0x0001b1, "Lu"},
+	{0x0001b4, "Ll"}, {0x0001b5, "Lu"}, {0x0001b6, "Ll"}, {0x0001b7, "Lu"}, {0x0001b9, "Ll"},
+	{0x0001bb, "Lo"}, {0x0001bc, "Lu"}, {0x0001bd, "Ll"}, {0x0001c0, "Lo"}, {0x0001c4, "Lu"},
+	{0x0001c5, "Lt"}, {0x0001c6, "Ll"}, {0x0001c7, "Lu"}, {0x0001c8, "Lt"}, {0x0001c9, "Ll"},
+	{0x0001ca, "Lu"}, {0x0001cb, "Lt"}, {0x0001cc, "Ll"}, {0x0001cd, "Lu"}, {0x0001ce, "Ll"},
+	{0x0001cf, "Lu"}, {0x0001d0, "Ll"}, {0x0001d1, "Lu"}, {0x0001d2, "Ll"}, {0x0001d3, "Lu"},
+	{0x0001d4, "Ll"}, {0x0001d5, "Lu"}, {0x0001d6, "Ll"}, {0x0001d7, "Lu"}, {0x0001d8, "Ll"},
+	{0x0001d9, "Lu"}, {0x0001da, "Ll"}, {0x0001db, "Lu"}, {0x0001dc, "Ll"}, {0x0001de, "Lu"},
+	{0x0001df, "Ll"}, {0x0001e0, "Lu"}, {0x0001e1, "Ll"}, {0x0001e2, "Lu"}, {0x0001e3, "Ll"},
+	{0x0001e4, "Lu"}, {0x0001e5, "Ll"}, {0x0001e6, "Lu"}, {0x0001e7, "Ll"}, {0x0001e8, "Lu"},
+	{0x0001e9, "Ll"}, {0x0001ea, "Lu"}, {0x0001eb, "Ll"}, {0x0001ec, "Lu"}, {0x0001ed, "Ll"},
+	{0x0001ee, "Lu"}, {0x0001ef, "Ll"}, {0x0001f1, "Lu"}, {0x0001f2, "Lt"}, {0x0001f3, "Ll"},
+	{0x0001f4, "Lu"}, {0x0001f5, "Ll"}, {0x0001f6, "Lu"}, {0x0001f9, "Ll"}, {0x0001fa, "Lu"},
+	{0x0001fb, "Ll"}, {0x0001fc, "Lu"}, {0x0001fd, "Ll"}, {0x0001fe, "Lu"}, {0x0001ff, "Ll"},
+	{0x000200, "Lu"}, {0x000201, "Ll"}, {0x000202, "Lu"}, {0x000203, "Ll"}, {0x000204, "Lu"},
+	{0x000205, "Ll"}, {0x000206, "Lu"}, {0x000207, "Ll"}, {0x000208, "Lu"}, {0x000209, "Ll"},
+	{0x00020a, "Lu"}, {0x00020b, "Ll"}, {0x00020c, "Lu"}, {0x00020d, "Ll"}, {0x00020e, "Lu"},
+	{0x00020f, "Ll"}, {0x000210, "Lu"}, {0x000211, "Ll"}, {0x000212, "Lu"}, {0x000213, "Ll"},
+	{0x000214, "Lu"}, {0x000215, "Ll"}, {0x000216, "Lu"}, {0x000217, "Ll"}, {0x000218, "Lu"},
+	{0x000219, "Ll"}, {0x00021a, "Lu"}, {0x00021b, "Ll"}, {0x00021c, "Lu"}, {0x00021d, "Ll"},
+	{0x00021e, "Lu"}, {0x00021f, "Ll"}, {0x000220, "Lu"}, {0x000221, "Ll"}, {0x000222, "Lu"},
+	{0x000223, "Ll"}, {0x000224, "Lu"}, {0x000225, "Ll"}, {0x000226, "Lu"}, {0x000227, "Ll"},
+	{0x000228, "Lu"}, {0x000229, "Ll"}, {0x00022a, "Lu"}, {0x00022b, "Ll"}, {0x00022c, "Lu"},
+	{0x00022d, "Ll"}, {0x00022e, "Lu"}, {0x00022f, "Ll"}, {0x000230, "Lu"}, {0x000231, "Ll"},
+	{0x000232, "Lu"}, {0x000233, "Ll"}, {0x00023a, "Lu"}, {0x00023c, "Ll"}, {0x00023d, "Lu"},
+	{0x00023f, "Ll"}, {0x000241, "Lu"}, {0x000242, "Ll"}, {0x000243, "Lu"}, {0x000247, "Ll"},
+	{0x000248, "Lu"}, {0x000249, "Ll"}, {0x00024a, "Lu"}, {0x00024b, "Ll"}, {0x00024c, "Lu"},
+	{0x00024d, "Ll"}, {0x00024e, "Lu"}, {0x00024f, "Ll"}, {0x000294, "Lo"}, {0x000295, "Ll"},
+	{0x0002b0, "Lm"}, {0x0002c2, "Sk"}, {0x0002c6, "Lm"}, {0x0002d2, "Sk"}, {0x0002e0, "Lm"},
+	{0x0002e5, "Sk"}, {0x0002ec, "Lm"}, {0x0002ed, "Sk"}, {0x0002ee, "Lm"}, {0x0002ef, "Sk"},
+	{0x000300, "Mn"}, {0x000370, "Lu"}, {0x000371, "Ll"}, {0x000372, "Lu"}, {0x000373, "Ll"},
+	{0x000374, "Lm"}, {0x000375, "Sk"}, {0x000376, "Lu"}, {0x000377, "Ll"}, {0x000378, "Cn"},
+	{0x00037a, "Lm"}, {0x00037b, "Ll"}, {0x00037e, "Po"}, {0x00037f, "Lu"}, {0x000380, "Cn"},
+	{0x000384, "Sk"}, {0x000386, "Lu"}, {0x000387, "Po"}, {0x000388, "Lu"}, {0x00038b, "Cn"},
+	{0x00038c, "Lu"}, {0x00038d, "Cn"}, {0x00038e, "Lu"}, {0x000390, "Ll"}, {0x000391, "Lu"},
+	{0x0003a2, "Cn"}, {0x0003a3, "Lu"}, {0x0003ac, "Ll"}, {0x0003cf, "Lu"}, {0x0003d0, "Ll"},
+	{0x0003d2, "Lu"}, {0x0003d5, "Ll"}, {0x0003d8, "Lu"}, {0x0003d9, "Ll"}, {0x0003da, "Lu"},
+	{0x0003db, "Ll"}, {0x0003dc, "Lu"}, {0x0003dd, "Ll"}, {0x0003de, "Lu"}, {0x0003df, "Ll"},
+	{0x0003e0, "Lu"}, {0x0003e1, "Ll"}, {0x0003e2, "Lu"}, {0x0003e3, "Ll"}, {0x0003e4, "Lu"},
+	{0x0003e5, "Ll"}, {0x0003e6, "Lu"}, {0x0003e7, "Ll"}, {0x0003e8, "Lu"}, {0x0003e9, "Ll"},
+	{0x0003ea, "Lu"}, {0x0003eb, "Ll"}, {0x0003ec, "Lu"}, {0x0003ed, "Ll"}, {0x0003ee, "Lu"},
+	{0x0003ef, "Ll"}, {0x0003f4, "Lu"}, {0x0003f5, "Ll"}, {0x0003f6, "Sm"}, {0x0003f7, "Lu"},
+	{0x0003f8, "Ll"}, {0x0003f9, "Lu"}, {0x0003fb, "Ll"}, {0x0003fd, "Lu"}, {0x000430, "Ll"},
+	{0x000460, "Lu"}, {0x000461, "Ll"}, {0x000462, "Lu"}, {0x000463, "Ll"}, {0x000464, "Lu"},
+	{0x000465, "Ll"}, {0x000466, "Lu"}, {0x000467, "Ll"}, {0x000468, "Lu"}, {0x000469, "Ll"},
+	{0x00046a, "Lu"}, {0x00046b, "Ll"}, {0x00046c, "Lu"}, {0x00046d, "Ll"}, {0x00046e, "Lu"},
+	{0x00046f, "Ll"}, {0x000470, "Lu"}, {0x000471, "Ll"}, {0x000472, "Lu"}, {0x000473, "Ll"},
+	{0x000474, "Lu"}, {0x000475, "Ll"}, {0x000476, "Lu"}, {0x000477, "Ll"}, {0x000478, "Lu"},
+	{0x000479, "Ll"}, {0x00047a, "Lu"}, {0x00047b, "Ll"}, {0x00047c, "Lu"}, {0x00047d, "Ll"},
+	{0x00047e, "Lu"}, {0x00047f, "Ll"}, {0x000480, "Lu"}, {0x000481, "Ll"}, {0x000482, "So"},
+	{0x000483, "Mn"}, {0x000488, "Me"}, {0x00048a, "Lu"}, {0x00048b, "Ll"}, {0x00048c, "Lu"},
+	{0x00048d, "Ll"}, {0x00048e, "Lu"}, {0x00048f, "Ll"}, {0x000490, "Lu"}, {0x000491, "Ll"},
+	{0x000492, "Lu"}, {0x000493, "Ll"}, {0x000494, "Lu"}, {0x000495, "Ll"}, {0x000496, "Lu"},
+	{0x000497, "Ll"}, {0x000498, "Lu"}, {0x000499, "Ll"}, {0x00049a, "Lu"}, {0x00049b, "Ll"},
+	{0x00049c, "Lu"}, {0x00049d, "Ll"}, {0x00049e, "Lu"}, {0x00049f, "Ll"}, {0x0004a0, "Lu"},
+	{0x0004a1, "Ll"}, {0x0004a2, "Lu"}, {0x0004a3, "Ll"}, {0x0004a4, "Lu"}, {0x0004a5, "Ll"},
+	{0x0004a6, "Lu"}, {0x0004a7, "Ll"}, {0x0004a8, "Lu"}, {0x0004a9, "Ll"}, {0x0004aa, "Lu"},
+	{0x0004ab, "Ll"}, {0x0004ac, "Lu"}, {0x0004ad, "Ll"}, {0x0004ae, "Lu"}, {0x0004af, "Ll"},
+	{0x0004b0, "Lu"}, {0x0004b1, "Ll"}, {0x0004b2, "Lu"}, {0x0004b3, "Ll"}, {0x0004b4, "Lu"},
+	{0x0004b5, "Ll"}, {0x0004b6, "Lu"}, {0x0004b7, "Ll"}, {0x0004b8, "Lu"}, {0x0004b9, "Ll"},
+	{0x0004ba, "Lu"}, {0x0004bb, "Ll"}, {0x0004bc, "Lu"}, {0x0004bd, "Ll"}, {0x0004be, "Lu"},
+	{0x0004bf, "Ll"}, {0x0004c0, "Lu"}, {0x0004c2, "Ll"}, {0x0004c3, "Lu"}, {0x0004c4, "Ll"},
+	{0x0004c5, "Lu"}, {0x0004c6, "Ll"}, {0x0004c7, "Lu"}, {0x0004c8, "Ll"}, {0x0004c9, "Lu"},
+	{0x0004ca, "Ll"}, {0x0004cb, "Lu"}, {0x0004cc, "Ll"}, {0x0004cd, "Lu"}, {0x0004ce, "Ll"},
+	{0x0004d0, "Lu"}, {0x0004d1, "Ll"}, {0x0004d2, "Lu"}, {0x0004d3, "Ll"}, {0x0004d4, "Lu"},
+	{0x0004d5, "Ll"}, {0x0004d6, "Lu"}, {0x0004d7, "Ll"}, {0x0004d8, "Lu"}, {0x0004d9, "Ll"},
+	{0x0004da, "Lu"}, {0x0004db, "Ll"}, {0x0004dc, "Lu"}, {0x0004dd, "Ll"}, {0x0004de, "Lu"},
+	{0x0004df, "Ll"}, {0x0004e0, "Lu"}, {0x0004e1, "Ll"}, {0x0004e2, "Lu"}, {0x0004e3, "Ll"},
+	{0x0004e4, "Lu"}, {0x0004e5, "Ll"}, {0x0004e6, "Lu"}, {0x0004e7, "Ll"}, {0x0004e8, "Lu"},
+	{0x0004e9, "Ll"}, {0x0004ea, "Lu"}, {0x0004eb, "Ll"}, {0x0004ec, "Lu"}, {0x0004ed, "Ll"},
+	{0x0004ee, "Lu"}, {0x0004ef, "Ll"}, {0x0004f0, "Lu"}, {0x0004f1, "Ll"}, {0x0004f2, "Lu"},
+	{0x0004f3, "Ll"}, {0x0004f4, "Lu"}, {0x0004f5, "Ll"}, {0x0004f6, "Lu"}, {0x0004f7, "Ll"},
+	{0x0004f8, "Lu"}, {0x0004f9, "Ll"}, {0x0004fa, "Lu"}, {0x0004fb, "Ll"}, {0x0004fc, "Lu"},
+	{0x0004fd, "Ll"}, {0x0004fe, "Lu"}, {0x0004ff, "Ll"}, {0x000500, "Lu"}, {0x000501, "Ll"},
+	{0x000502, "Lu"}, {0x000503, "Ll"}, {0x000504, "Lu"}, {0x000505, "Ll"}, {0x000506, "Lu"},
+	{0x000507, "Ll"}, {0x000508, "Lu"}, {0x000509, "Ll"}, {0x00050a, "Lu"}, {0x00050b, "Ll"},
+	{0x00050c, "Lu"}, {0x00050d, "Ll"}, {0x00050e, "Lu"}, {0x00050f, "Ll"}, {0x000510, "Lu"},
+	{0x000511, "Ll"}, {0x000512, "Lu"}, {0x000513, "Ll"}, {0x000514, "Lu"}, {0x000515, "Ll"},
+	{0x000516, "Lu"}, {0x000517, "Ll"}, {0x000518, "Lu"}, {0x000519, "Ll"}, {0x00051a, "Lu"},
+	{0x00051b, "Ll"}, {0x00051c, "Lu"}, {0x00051d, "Ll"}, {0x00051e, "Lu"}, {0x00051f, "Ll"},
+	{0x000520, "Lu"}, {0x000521, "Ll"}, {0x000522, "Lu"}, {0x000523, "Ll"}, {0x000524, "Lu"},
+	{0x000525, "Ll"}, {0x000526, "Lu"}, {0x000527, "Ll"}, {0x000528, "Lu"}, {0x000529, "Ll"},
+	{0x00052a, "Lu"}, {0x00052b, "Ll"}, {0x00052c, "Lu"}, {0x00052d, "Ll"}, {0x00052e, "Lu"},
+	{0x00052f, "Ll"}, {0x000530, "Cn"}, {0x000531, "Lu"}, {0x000557, "Cn"}, {0x000559, "Lm"},
+	{0x00055a, "Po"}, {0x000560, "Ll"}, {0x000589, "Po"}, {0x00058a, "Pd"}, {0x00058b, "Cn"},
+	{0x00058d, "So"}, {0x00058f, "Sc"}, {0x000590, "Cn"}, {0x000591, "Mn"}, {0x0005be, "Pd"},
+	{0x0005bf, "Mn"}, {0x0005c0, "Po"}, {0x0005c1, "Mn"}, {0x0005c3, "Po"}, {0x0005c4, "Mn"},
+	{0x0005c6, "Po"}, {0x0005c7, "Mn"}, {0x0005c8, "Cn"}, {0x0005d0, "Lo"}, {0x0005eb, "Cn"},
+	{0x0005ef, "Lo"}, {0x0005f3, "Po"}, {0x0005f5, "Cn"}, {0x000600, "Cf"}, {0x000606, "Sm"},
+	{0x000609, "Po"}, {0x00060b, "Sc"}, {0x00060c, "Po"}, {0x00060e, "So"}, {0x000610, "Mn"},
+	{0x00061b, "Po"}, {0x00061c, "Cf"}, {0x00061d, "Po"}, {0x000620, "Lo"}, {0x000640, "Lm"},
+	{0x000641, "Lo"}, {0x00064b, "Mn"}, {0x000660, "Nd"}, {0x00066a, "Po"}, {0x00066e, "Lo"},
+	{0x000670, "Mn"}, {0x000671, "Lo"}, {0x0006d4, "Po"}, {0x0006d5, "Lo"}, {0x0006d6, "Mn"},
+	{0x0006dd, "Cf"}, {0x0006de, "So"}, {0x0006df, "Mn"}, {0x0006e5, "Lm"}, {0x0006e7, "Mn"},
+	{0x0006e9, "So"}, {0x0006ea, "Mn"}, {0x0006ee, "Lo"}, {0x0006f0, "Nd"}, {0x0006fa, "Lo"},
+	{0x0006fd, "So"}, {0x0006ff, "Lo"}, {0x000700, "Po"}, {0x00070e, "Cn"}, {0x00070f, "Cf"},
+	{0x000710, "Lo"}, {0x000711, "Mn"}, {0x000712, "Lo"}, {0x000730, "Mn"}, {0x00074b, "Cn"},
+	{0x00074d, "Lo"}, {0x0007a6, "Mn"}, {0x0007b1, "Lo"}, {0x0007b2, "Cn"}, {0x0007c0, "Nd"},
+	{0x0007ca, "Lo"}, {0x0007eb, "Mn"}, {0x0007f4, "Lm"}, {0x0007f6, "So"}, {0x0007f7, "Po"},
+	{0x0007fa, "Lm"}, {0x0007fb, "Cn"}, {0x0007fd, "Mn"}, {0x0007fe, "Sc"}, {0x000800, "Lo"},
+	{0x000816, "Mn"}, {0x00081a, "Lm"}, {0x00081b, "Mn"}, {0x000824, "Lm"}, {0x000825, "Mn"},
+	{0x000828, "Lm"}, {0x000829, "Mn"}, {0x00082e, "Cn"}, {0x000830, "Po"}, {0x00083f, "Cn"},
+	{0x000840, "Lo"}, {0x000859, "Mn"}, {0x00085c, "Cn"}, {0x00085e, "Po"}, {0x00085f, "Cn"},
+	{0x000860, "Lo"}, {0x00086b, "Cn"}, {0x000870, "Lo"}, {0x000888, "Sk"}, {0x000889, "Lo"},
+	{0x00088f, "Cn"}, {0x000890, "Cf"}, {0x000892, "Cn"}, {0x000898, "Mn"}, {0x0008a0, "Lo"},
+	{0x0008c9, "Lm"}, {0x0008ca, "Mn"}, {0x0008e2, "Cf"}, {0x0008e3, "Mn"}, {0x000903, "Mc"},
+	{0x000904, "Lo"}, {0x00093a, "Mn"}, {0x00093b, "Mc"}, {0x00093c, "Mn"}, {0x00093d, "Lo"},
+	{0x00093e, "Mc"}, {0x000941, "Mn"}, {0x000949, "Mc"}, {0x00094d, "Mn"}, {0x00094e, "Mc"},
+	{0x000950, "Lo"}, {0x000951, "Mn"}, {0x000958, "Lo"}, {0x000962, "Mn"}, {0x000964, "Po"},
+	{0x000966, "Nd"}, {0x000970, "Po"}, {0x000971, "Lm"}, {0x000972, "Lo"}, {0x000981, "Mn"},
+	{0x000982, "Mc"}, {0x000984, "Cn"}, {0x000985, "Lo"}, {0x00098d, "Cn"}, {0x00098f, "Lo"},
+	{0x000991, "Cn"}, {0x000993, "Lo"}, {0x0009a9, "Cn"}, {0x0009aa, "Lo"}, {0x0009b1, "Cn"},
+	{0x0009b2, "Lo"}, {0x0009b3, "Cn"}, {0x0009b6, "Lo"}, {0x0009ba, "Cn"}, {0x0009bc, "Mn"},
+	{0x0009bd, "Lo"}, {0x0009be, "Mc"}, {0x0009c1, "Mn"}, {0x0009c5, "Cn"}, {0x0009c7, "Mc"},
+	{0x0009c9, "Cn"}, {0x0009cb, "Mc"}, {0x0009cd, "Mn"}, {0x0009ce, "Lo"}, {0x0009cf, "Cn"},
+	{0x0009d7, "Mc"}, {0x0009d8, "Cn"}, {0x0009dc, "Lo"}, {0x0009de, "Cn"}, {0x0009df, "Lo"},
+	{0x0009e2, "Mn"}, {0x0009e4, "Cn"}, {0x0009e6, "Nd"}, {0x0009f0, "Lo"}, {0x0009f2, "Sc"},
+	{0x0009f4, "No"}, {0x0009fa, "So"}, {0x0009fb, "Sc"}, {0x0009fc, "Lo"}, {0x0009fd, "Po"},
+	{0x0009fe, "Mn"}, {0x0009ff, "Cn"}, {0x000a01, "Mn"}, {0x000a03, "Mc"}, {0x000a04, "Cn"},
+	{0x000a05, "Lo"}, {0x000a0b, "Cn"}, {0x000a0f, "Lo"}, {0x000a11, "Cn"}, {0x000a13, "Lo"},
+	{0x000a29, "Cn"}, {0x000a2a, "Lo"}, {0x000a31, "Cn"}, {0x000a32, "Lo"}, {0x000a34, "Cn"},
+	{0x000a35, "Lo"}, {0x000a37, "Cn"}, {0x000a38, "Lo"}, {0x000a3a, "Cn"}, {0x000a3c, "Mn"},
+	{0x000a3d, "Cn"}, {0x000a3e, "Mc"}, {0x000a41, "Mn"}, {0x000a43, "Cn"}, {0x000a47, "Mn"},
+	{0x000a49, "Cn"}, {0x000a4b, "Mn"}, {0x000a4e, "Cn"}, {0x000a51, "Mn"}, {0x000a52, "Cn"},
+	{0x000a59, "Lo"}, {0x000a5d, "Cn"}, {0x000a5e, "Lo"}, {0x000a5f, "Cn"}, {0x000a66, "Nd"},
+	{0x000a70, "Mn"}, {0x000a72, "Lo"}, {0x000a75, "Mn"}, {0x000a76, "Po"}, {0x000a77, "Cn"},
+	{0x000a81, "Mn"}, {0x000a83, "Mc"}, {0x000a84, "Cn"}, {0x000a85, "Lo"}, {0x000a8e, "Cn"},
+	{0x000a8f, "Lo"}, {0x000a92, "Cn"}, {0x000a93, "Lo"}, {0x000aa9, "Cn"}, {0x000aaa, "Lo"},
+	{0x000ab1, "Cn"}, {0x000ab2, "Lo"}, {0x000ab4, "Cn"}, {0x000ab5, "Lo"}, {0x000aba, "Cn"},
+	{0x000abc, "Mn"}, {0x000abd, "Lo"}, {0x000abe, "Mc"}, {0x000ac1, "Mn"}, {0x000ac6, "Cn"},
+	{0x000ac7, "Mn"}, {0x000ac9, "Mc"}, {0x000aca, "Cn"}, {0x000acb, "Mc"}, {0x000acd, "Mn"},
+	{0x000ace, "Cn"}, {0x000ad0, "Lo"}, {0x000ad1, "Cn"}, {0x000ae0, "Lo"}, {0x000ae2, "Mn"},
+	{0x000ae4, "Cn"}, {0x000ae6, "Nd"}, {0x000af0, "Po"}, {0x000af1, "Sc"}, {0x000af2, "Cn"},
+	{0x000af9, "Lo"}, {0x000afa, "Mn"}, {0x000b00, "Cn"}, {0x000b01, "Mn"}, {0x000b02, "Mc"},
+	{0x000b04, "Cn"}, {0x000b05, "Lo"}, {0x000b0d, "Cn"}, {0x000b0f, "Lo"}, {0x000b11, "Cn"},
+	{0x000b13, "Lo"}, {0x000b29, "Cn"}, {0x000b2a, "Lo"}, {0x000b31, "Cn"}, {0x000b32, "Lo"},
+	{0x000b34, "Cn"}, {0x000b35, "Lo"}, {0x000b3a, "Cn"}, {0x000b3c, "Mn"}, {0x000b3d, "Lo"},
+	{0x000b3e, "Mc"}, {0x000b3f, "Mn"}, {0x000b40, "Mc"}, {0x000b41, "Mn"}, {0x000b45, "Cn"},
+	{0x000b47, "Mc"}, {0x000b49, "Cn"}, {0x000b4b, "Mc"}, {0x000b4d, "Mn"}, {0x000b4e, "Cn"},
+	{0x000b55, "Mn"}, {0x000b57, "Mc"}, {0x000b58, "Cn"}, {0x000b5c, "Lo"}, {0x000b5e, "Cn"},
+	{0x000b5f, "Lo"}, {0x000b62, "Mn"}, {0x000b64, "Cn"}, {0x000b66, "Nd"}, {0x000b70, "So"},
+	{0x000b71, "Lo"}, {0x000b72, "No"}, {0x000b78, "Cn"}, {0x000b82, "Mn"}, {0x000b83, "Lo"},
+	{0x000b84, "Cn"}, {0x000b85, "Lo"}, {0x000b8b, "Cn"}, {0x000b8e, "Lo"}, {0x000b91, "Cn"},
+	{0x000b92, "Lo"}, {0x000b96, "Cn"}, {0x000b99, "Lo"}, {0x000b9b, "Cn"}, {0x000b9c, "Lo"},
+	{0x000b9d, "Cn"}, {0x000b9e, "Lo"}, {0x000ba0, "Cn"}, {0x000ba3, "Lo"}, {0x000ba5, "Cn"},
+	{0x000ba8, "Lo"}, {0x000bab, "Cn"}, {0x000bae, "Lo"}, {0x000bba, "Cn"}, {0x000bbe, "Mc"},
+	{0x000bc0, "Mn"}, {0x000bc1, "Mc"}, {0x000bc3, "Cn"}, {0x000bc6, "Mc"}, {0x000bc9, "Cn"},
+	{0x000bca, "Mc"}, {0x000bcd, "Mn"}, {0x000bce, "Cn"}, {0x000bd0, "Lo"}, {0x000bd1, "Cn"},
+	{0x000bd7, "Mc"}, {0x000bd8, "Cn"}, {0x000be6, "Nd"}, {0x000bf0, "No"}, {0x000bf3, "So"},
+	{0x000bf9, "Sc"}, {0x000bfa, "So"}, {0x000bfb, "Cn"}, {0x000c00, "Mn"}, {0x000c01, "Mc"},
+	{0x000c04, "Mn"}, {0x000c05, "Lo"}, {0x000c0d, "Cn"}, {0x000c0e, "Lo"}, {0x000c11, "Cn"},
+	{0x000c12, "Lo"}, {0x000c29, "Cn"}, {0x000c2a, "Lo"}, {0x000c3a, "Cn"}, {0x000c3c, "Mn"},
+	{0x000c3d, "Lo"}, {0x000c3e, "Mn"}, {0x000c41, "Mc"}, {0x000c45, "Cn"}, {0x000c46, "Mn"},
+	{0x000c49, "Cn"}, {0x000c4a, "Mn"}, {0x000c4e, "Cn"}, {0x000c55, "Mn"}, {0x000c57, "Cn"},
+	{0x000c58, "Lo"}, {0x000c5b, "Cn"}, {0x000c5d, "Lo"}, {0x000c5e, "Cn"}, {0x000c60, "Lo"},
+	{0x000c62, "Mn"}, {0x000c64, "Cn"}, {0x000c66, "Nd"}, {0x000c70, "Cn"}, {0x000c77, "Po"},
+	{0x000c78, "No"}, {0x000c7f, "So"}, {0x000c80, "Lo"}, {0x000c81, "Mn"}, {0x000c82, "Mc"},
+	{0x000c84, "Po"}, {0x000c85, "Lo"}, {0x000c8d, "Cn"}, {0x000c8e, "Lo"}, {0x000c91, "Cn"},
+	{0x000c92, "Lo"}, {0x000ca9, "Cn"}, {0x000caa, "Lo"}, {0x000cb4, "Cn"}, {0x000cb5, "Lo"},
+	{0x000cba, "Cn"}, {0x000cbc, "Mn"}, {0x000cbd, "Lo"}, {0x000cbe, "Mc"}, {0x000cbf, "Mn"},
+	{0x000cc0, "Mc"}, {0x000cc5, "Cn"}, {0x000cc6, "Mn"}, {0x000cc7, "Mc"}, {0x000cc9, "Cn"},
+	{0x000cca, "Mc"}, {0x000ccc, "Mn"}, {0x000cce, "Cn"}, {0x000cd5, "Mc"}, {0x000cd7, "Cn"},
+	{0x000cdd, "Lo"}, {0x000cdf, "Cn"}, {0x000ce0, "Lo"}, {0x000ce2, "Mn"}, {0x000ce4, "Cn"},
+	{0x000ce6, "Nd"}, {0x000cf0, "Cn"}, {0x000cf1, "Lo"}, {0x000cf3, "Cn"}, {0x000d00, "Mn"},
+	{0x000d02, "Mc"}, {0x000d04, "Lo"}, {0x000d0d, "Cn"}, {0x000d0e, "Lo"}, {0x000d11, "Cn"},
+	{0x000d12, "Lo"}, {0x000d3b, "Mn"}, {0x000d3d, "Lo"}, {0x000d3e, "Mc"}, {0x000d41, "Mn"},
+	{0x000d45, "Cn"}, {0x000d46, "Mc"}, {0x000d49, "Cn"}, {0x000d4a, "Mc"}, {0x000d4d, "Mn"},
+	{0x000d4e, "Lo"}, {0x000d4f, "So"}, {0x000d50, "Cn"}, {0x000d54, "Lo"}, {0x000d57, "Mc"},
+	{0x000d58, "No"}, {0x000d5f, "Lo"}, {0x000d62, "Mn"}, {0x000d64, "Cn"}, {0x000d66, "Nd"},
+	{0x000d70, "No"}, {0x000d79, "So"}, {0x000d7a, "Lo"}, {0x000d80, "Cn"}, {0x000d81, "Mn"},
+	{0x000d82, "Mc"}, {0x000d84, "Cn"}, {0x000d85, "Lo"}, {0x000d97, "Cn"}, {0x000d9a, "Lo"},
+	{0x000db2, "Cn"}, {0x000db3, "Lo"}, {0x000dbc, "Cn"}, {0x000dbd, "Lo"}, {0x000dbe, "Cn"},
+	{0x000dc0, "Lo"}, {0x000dc7, "Cn"}, {0x000dca, "Mn"}, {0x000dcb, "Cn"}, {0x000dcf, "Mc"},
+	{0x000dd2, "Mn"}, {0x000dd5, "Cn"}, {0x000dd6, "Mn"}, {0x000dd7, "Cn"}, {0x000dd8, "Mc"},
+	{0x000de0, "Cn"}, {0x000de6, "Nd"}, {0x000df0, "Cn"}, {0x000df2, "Mc"}, {0x000df4, "Po"},
+	{0x000df5, "Cn"}, {0x000e01, "Lo"}, {0x000e31, "Mn"}, {0x000e32, "Lo"}, {0x000e34, "Mn"},
+	{0x000e3b, "Cn"}, {0x000e3f, "Sc"}, {0x000e40, "Lo"}, {0x000e46, "Lm"}, {0x000e47, "Mn"},
+	{0x000e4f, "Po"}, {0x000e50, "Nd"}, {0x000e5a, "Po"}, {0x000e5c, "Cn"}, {0x000e81, "Lo"},
+	{0x000e83, "Cn"}, {0x000e84, "Lo"}, {0x000e85, "Cn"}, {0x000e86, "Lo"}, {0x000e8b, "Cn"},
+	{0x000e8c, "Lo"}, {0x000ea4, "Cn"}, {0x000ea5, "Lo"}, {0x000ea6, "Cn"}, {0x000ea7, "Lo"},
+	{0x000eb1, "Mn"}, {0x000eb2, "Lo"}, {0x000eb4, "Mn"}, {0x000ebd, "Lo"}, {0x000ebe, "Cn"},
+	{0x000ec0, "Lo"}, {0x000ec5, "Cn"}, {0x000ec6, "Lm"}, {0x000ec7, "Cn"}, {0x000ec8, "Mn"},
+	{0x000ece, "Cn"}, {0x000ed0, "Nd"}, {0x000eda, "Cn"}, {0x000edc, "Lo"}, {0x000ee0, "Cn"},
+	{0x000f00, "Lo"}, {0x000f01, "So"}, {0x000f04, "Po"}, {0x000f13, "So"}, {0x000f14, "Po"},
+	{0x000f15, "So"}, {0x000f18, "Mn"}, {0x000f1a, "So"}, {0x000f20, "Nd"}, {0x000f2a, "No"},
+	{0x000f34, "So"}, {0x000f35, "Mn"}, {0x000f36, "So"}, {0x000f37, "Mn"}, {0x000f38, "So"},
+	{0x000f39, "Mn"}, {0x000f3a, "Ps"}, {0x000f3b, "Pe"}, {0x000f3c, "Ps"}, {0x000f3d, "Pe"},
+	{0x000f3e, "Mc"}, {0x000f40, "Lo"}, {0x000f48, "Cn"}, {0x000f49, "Lo"}, {0x000f6d, "Cn"},
+	{0x000f71, "Mn"}, {0x000f7f, "Mc"}, {0x000f80, "Mn"}, {0x000f85, "Po"}, {0x000f86, "Mn"},
+	{0x000f88, "Lo"}, {0x000f8d, "Mn"}, {0x000f98, "Cn"}, {0x000f99, "Mn"}, {0x000fbd, "Cn"},
+	{0x000fbe, "So"}, {0x000fc6, "Mn"}, {0x000fc7, "So"}, {0x000fcd, "Cn"}, {0x000fce, "So"},
+	{0x000fd0, "Po"}, {0x000fd5, "So"}, {0x000fd9, "Po"}, {0x000fdb, "Cn"}, {0x001000, "Lo"},
+	{0x00102b, "Mc"}, {0x00102d, "Mn"}, {0x001031, "Mc"}, {0x001032, "Mn"}, {0x001038, "Mc"},
+	{0x001039, "Mn"}, {0x00103b, "Mc"}, {0x00103d, "Mn"}, {0x00103f, "Lo"}, {0x001040, "Nd"},
+	{0x00104a, "Po"}, {0x001050, "Lo"}, {0x001056, "Mc"}, {0x001058, "Mn"}, {0x00105a, "Lo"},
+	{0x00105e, "Mn"}, {0x001061, "Lo"}, {0x001062, "Mc"}, {0x001065, "Lo"}, {0x001067, "Mc"},
+	{0x00106e, "Lo"}, {0x001071, "Mn"}, {0x001075, "Lo"}, {0x001082, "Mn"}, {0x001083, "Mc"},
+	{0x001085, "Mn"}, {0x001087, "Mc"}, {0x00108d, "Mn"}, {0x00108e, "Lo"}, {0x00108f, "Mc"},
+	{0x001090, "Nd"}, {0x00109a, "Mc"}, {0x00109d, "Mn"}, {0x00109e, "So"}, {0x0010a0, "Lu"},
+	{0x0010c6, "Cn"}, {0x0010c7, "Lu"}, {0x0010c8, "Cn"}, {0x0010cd, "Lu"}, {0x0010ce, "Cn"},
+	{0x0010d0, "Ll"}, {0x0010fb, "Po"}, {0x0010fc, "Lm"}, {0x0010fd, "Ll"}, {0x001100, "Lo"},
+	{0x001249, "Cn"}, {0x00124a, "Lo"}, {0x00124e, "Cn"}, {0x001250, "Lo"}, {0x001257, "Cn"},
+	{0x001258, "Lo"}, {0x001259, "Cn"}, {0x00125a, "Lo"}, {0x00125e, "Cn"}, {0x001260, "Lo"},
+	{0x001289, "Cn"}, {0x00128a, "Lo"}, {0x00128e, "Cn"}, {0x001290, "Lo"}, {0x0012b1, "Cn"},
+	{0x0012b2, "Lo"}, {0x0012b6, "Cn"}, {0x0012b8, "Lo"}, {0x0012bf, "Cn"}, {0x0012c0, "Lo"},
+	{0x0012c1, "Cn"}, {0x0012c2, "Lo"}, {0x0012c6, "Cn"}, {0x0012c8, "Lo"}, {0x0012d7, "Cn"},
+	{0x0012d8, "Lo"}, {0x001311, "Cn"}, {0x001312, "Lo"}, {0x001316, "Cn"}, {0x001318, "Lo"},
+	{0x00135b, "Cn"}, {0x00135d, "Mn"}, {0x001360, "Po"}, {0x001369, "No"}, {0x00137d, "Cn"},
+	{0x001380, "Lo"}, {0x001390, "So"}, {0x00139a, "Cn"}, {0x0013a0, "Lu"}, {0x0013f6, "Cn"},
+	{0x0013f8, "Ll"}, {0x0013fe, "Cn"}, {0x001400, "Pd"}, {0x001401, "Lo"}, {0x00166d, "So"},
+	{0x00166e, "Po"}, {0x00166f, "Lo"}, {0x001680, "Zs"}, {0x001681, "Lo"}, {0x00169b, "Ps"},
+	{0x00169c, "Pe"}, {0x00169d, "Cn"}, {0x0016a0, "Lo"}, {0x0016eb, "Po"}, {0x0016ee, "Nl"},
+	{0x0016f1, "Lo"}, {0x0016f9, "Cn"}, {0x001700, "Lo"}, {0x001712, "Mn"}, {0x001715, "Mc"},
+	{0x001716, "Cn"}, {0x00171f, "Lo"}, {0x001732, "Mn"}, {0x001734, "Mc"}, {0x001735, "Po"},
+	{0x001737, "Cn"}, {0x001740, "Lo"}, {0x001752, "Mn"}, {0x001754, "Cn"}, {0x001760, "Lo"},
+	{0x00176d, "Cn"}, {0x00176e, "Lo"}, {0x001771, "Cn"}, {0x001772, "Mn"}, {0x001774, "Cn"},
+	{0x001780, "Lo"}, {0x0017b4, "Mn"}, {0x0017b6, "Mc"}, {0x0017b7, "Mn"}, {0x0017be, "Mc"},
+	{0x0017c6, "Mn"}, {0x0017c7, "Mc"}, {0x0017c9, "Mn"}, {0x0017d4, "Po"}, {0x0017d7, "Lm"},
+	{0x0017d8, "Po"}, {0x0017db, "Sc"}, {0x0017dc, "Lo"}, {0x0017dd, "Mn"}, {0x0017de, "Cn"},
+	{0x0017e0, "Nd"}, {0x0017ea, "Cn"}, {0x0017f0, "No"}, {0x0017fa, "Cn"}, {0x001800, "Po"},
+	{0x001806, "Pd"}, {0x001807, "Po"}, {0x00180b, "Mn"}, {0x00180e, "Cf"}, {0x00180f, "Mn"},
+	{0x001810, "Nd"}, {0x00181a, "Cn"}, {0x001820, "Lo"}, {0x001843, "Lm"}, {0x001844, "Lo"},
+	{0x001879, "Cn"}, {0x001880, "Lo"}, {0x001885, "Mn"}, {0x001887, "Lo"}, {0x0018a9, "Mn"},
+	{0x0018aa, "Lo"}, {0x0018ab, "Cn"}, {0x0018b0, "Lo"}, {0x0018f6, "Cn"}, {0x001900, "Lo"},
+	{0x00191f, "Cn"}, {0x001920, "Mn"}, {0x001923, "Mc"}, {0x001927, "Mn"}, {0x001929, "Mc"},
+	{0x00192c, "Cn"}, {0x001930, "Mc"}, {0x001932, "Mn"}, {0x001933, "Mc"}, {0x001939, "Mn"},
+	{0x00193c, "Cn"}, {0x001940, "So"}, {0x001941, "Cn"}, {0x001944, "Po"}, {0x001946, "Nd"},
+	{0x001950, "Lo"}, {0x00196e, "Cn"}, {0x001970, "Lo"}, {0x001975, "Cn"}, {0x001980, "Lo"},
+	{0x0019ac, "Cn"}, {0x0019b0, "Lo"}, {0x0019ca, "Cn"}, {0x0019d0, "Nd"}, {0x0019da, "No"},
+	{0x0019db, "Cn"}, {0x0019de, "So"}, {0x001a00, "Lo"}, {0x001a17, "Mn"}, {0x001a19, "Mc"},
+	{0x001a1b, "Mn"}, {0x001a1c, "Cn"}, {0x001a1e, "Po"}, {0x001a20, "Lo"}, {0x001a55, "Mc"},
+	{0x001a56, "Mn"}, {0x001a57, "Mc"}, {0x001a58, "Mn"}, {0x001a5f, "Cn"}, {0x001a60, "Mn"},
+	{0x001a61, "Mc"}, {0x001a62, "Mn"}, {0x001a63, "Mc"}, {0x001a65, "Mn"}, {0x001a6d, "Mc"},
+	{0x001a73, "Mn"}, {0x001a7d, "Cn"}, {0x001a7f, "Mn"}, {0x001a80, "Nd"}, {0x001a8a, "Cn"},
+	{0x001a90, "Nd"}, {0x001a9a, "Cn"}, {0x001aa0, "Po"}, {0x001aa7, "Lm"}, {0x001aa8, "Po"},
+	{0x001aae, "Cn"}, {0x001ab0, "Mn"}, {0x001abe, "Me"}, {0x001abf, "Mn"}, {0x001acf, "Cn"},
+	{0x001b00, "Mn"}, {0x001b04, "Mc"}, {0x001b05, "Lo"}, {0x001b34, "Mn"}, {0x001b35, "Mc"},
+	{0x001b36, "Mn"}, {0x001b3b, "Mc"}, {0x001b3c, "Mn"}, {0x001b3d, "Mc"}, {0x001b42, "Mn"},
+	{0x001b43, "Mc"}, {0x001b45, "Lo"}, {0x001b4d, "Cn"}, {0x001b50, "Nd"}, {0x001b5a, "Po"},
+	{0x001b61, "So"}, {0x001b6b, "Mn"}, {0x001b74, "So"}, {0x001b7d, "Po"}, {0x001b7f, "Cn"},
+	{0x001b80, "Mn"}, {0x001b82, "Mc"}, {0x001b83, "Lo"}, {0x001ba1, "Mc"}, {0x001ba2, "Mn"},
+	{0x001ba6, "Mc"}, {0x001ba8, "Mn"}, {0x001baa, "Mc"}, {0x001bab, "Mn"}, {0x001bae, "Lo"},
+	{0x001bb0, "Nd"}, {0x001bba, "Lo"}, {0x001be6, "Mn"}, {0x001be7, "Mc"}, {0x001be8, "Mn"},
+	{0x001bea, "Mc"}, {0x001bed, "Mn"}, {0x001bee, "Mc"}, {0x001bef, "Mn"}, {0x001bf2, "Mc"},
+	{0x001bf4, "Cn"}, {0x001bfc, "Po"}, {0x001c00, "Lo"}, {0x001c24, "Mc"}, {0x001c2c, "Mn"},
+	{0x001c34, "Mc"}, {0x001c36, "Mn"}, {0x001c38, "Cn"}, {0x001c3b, "Po"}, {0x001c40, "Nd"},
+	{0x001c4a, "Cn"}, {0x001c4d, "Lo"}, {0x001c50, "Nd"}, {0x001c5a, "Lo"}, {0x001c78, "Lm"},
+	{0x001c7e, "Po"}, {0x001c80, "Ll"}, {0x001c89, "Cn"}, {0x001c90, "Lu"}, {0x001cbb, "Cn"},
+	{0x001cbd, "Lu"}, {0x001cc0, "Po"}, {0x001cc8, "Cn"}, {0x001cd0, "Mn"}, {0x001cd3, "Po"},
+	{0x001cd4, "Mn"}, {0x001ce1, "Mc"}, {0x001ce2, "Mn"}, {0x001ce9, "Lo"}, {0x001ced, "Mn"},
+	{0x001cee, "Lo"}, {0x001cf4, "Mn"}, {0x001cf5, "Lo"}, {0x001cf7, "Mc"}, {0x001cf8, "Mn"},
+	{0x001cfa, "Lo"}, {0x001cfb, "Cn"}, {0x001d00, "Ll"}, {0x001d2c, "Lm"}, {0x001d6b, "Ll"},
+	{0x001d78, "Lm"}, {0x001d79, "Ll"}, {0x001d9b, "Lm"}, {0x001dc0, "Mn"}, {0x001e00, "Lu"},
+	{0x001e01, "Ll"}, {0x001e02, "Lu"}, {0x001e03, "Ll"}, {0x001e04, "Lu"}, {0x001e05, "Ll"},
+	{0x001e06, "Lu"}, {0x001e07, "Ll"}, {0x001e08, "Lu"}, {0x001e09, "Ll"}, {0x001e0a, "Lu"},
+	{0x001e0b, "Ll"}, {0x001e0c, "Lu"}, {0x001e0d, "Ll"}, {0x001e0e, "Lu"}, {0x001e0f, "Ll"},
+	{0x001e10, "Lu"}, {0x001e11, "Ll"}, {0x001e12, "Lu"}, {0x001e13, "Ll"}, {0x001e14, "Lu"},
+	{0x001e15, "Ll"}, {0x001e16, "Lu"}, {0x001e17, "Ll"}, {0x001e18, "Lu"}, {0x001e19, "Ll"},
+	{0x001e1a, "Lu"}, {0x001e1b, "Ll"}, {0x001e1c, "Lu"}, {0x001e1d, "Ll"}, {0x001e1e, "Lu"},
+	{0x001e1f, "Ll"}, {0x001e20, "Lu"}, {0x001e21, "Ll"}, {0x001e22, "Lu"}, {0x001e23, "Ll"},
+	{0x001e24, "Lu"}, {0x001e25, "Ll"}, {0x001e26, "Lu"}, {0x001e27, "Ll"}, {0x001e28, "Lu"},
+	{0x001e29, "Ll"}, {0x001e2a, "Lu"}, {0x001e2b, "Ll"}, {0x001e2c, "Lu"}, {0x001e2d, "Ll"},
+	{0x001e2e, "Lu"}, {0x001e2f, "Ll"}, {0x001e30, "Lu"}, {0x001e31, "Ll"}, {0x001e32, "Lu"},
+	{0x001e33, "Ll"}, {0x001e34, "Lu"}, {0x001e35, "Ll"}, {0x001e36, "Lu"}, {0x001e37, "Ll"},
+	{0x001e38, "Lu"}, {0x001e39, "Ll"}, {0x001e3a, "Lu"}, {0x001e3b, "Ll"}, {0x001e3c, "Lu"},
+	{0x001e3d, "Ll"}, {0x001e3e, "Lu"}, {0x001e3f, "Ll"}, {0x001e40, "Lu"}, {0x001e41, "Ll"},
+	{0x001e42, "Lu"}, {0x001e43, "Ll"}, {0x001e44, "Lu"}, {0x001e45, "Ll"}, {0x001e46, "Lu"},
+	{0x001e47, "Ll"}, {0x001e48, "Lu"}, {0x001e49, "Ll"}, {0x001e4a, "Lu"}, {0x001e4b, "Ll"},
+	{0x001e4c, "Lu"}, {0x001e4d, "Ll"}, {0x001e4e, "Lu"}, {0x001e4f, "Ll"}, {0x001e50, "Lu"},
+	{0x001e51, "Ll"}, {0x001e52, "Lu"}, {0x001e53, "Ll"}, {0x001e54, "Lu"}, {0x001e55, "Ll"},
+	{0x001e56, "Lu"}, {0x001e57, "Ll"}, {0x001e58, "Lu"}, {0x001e59, "Ll"}, {0x001e5a, "Lu"},
+	{0x001e5b, "Ll"}, {0x001e5c, "Lu"}, {0x001e5d, "Ll"}, {0x001e5e, "Lu"}, {0x001e5f, "Ll"},
+	{0x001e60, "Lu"}, {0x001e61, "Ll"}, {0x001e62, "Lu"}, {0x001e63, "Ll"}, {0x001e64, "Lu"},
+	{0x001e65, "Ll"}, {0x001e66, "Lu"}, {0x001e67, "Ll"}, {0x001e68, "Lu"}, {0x001e69, "Ll"},
+	{0x001e6a, "Lu"}, {0x001e6b, "Ll"}, {0x001e6c, "Lu"}, {0x001e6d, "Ll"}, {0x001e6e, "Lu"},
+	{0x001e6f, "Ll"}, {0x001e70, "Lu"}, {0x001e71, "Ll"}, {0x001e72, "Lu"}, {0x001e73, "Ll"},
+	{0x001e74, "Lu"}, {0x001e75, "Ll"}, {0x001e76, "Lu"}, {0x001e77, "Ll"}, {0x001e78, "Lu"},
+	{0x001e79, "Ll"}, {0x001e7a, "Lu"}, {0x001e7b, "Ll"}, {0x001e7c, "Lu"}, {0x001e7d, "Ll"},
+	{0x001e7e, "Lu"}, {0x001e7f, "Ll"}, {0x001e80, "Lu"}, {0x001e81, "Ll"}, {0x001e82, "Lu"},
+	{0x001e83, "Ll"}, {0x001e84, "Lu"}, {0x001e85, "Ll"}, {0x001e86, "Lu"}, {0x001e87, "Ll"},
+	{0x001e88, "Lu"}, {0x001e89, "Ll"}, {0x001e8a, "Lu"}, {0x001e8b, "Ll"}, {0x001e8c, "Lu"},
+	{0x001e8d, "Ll"}, {0x001e8e, "Lu"}, {0x001e8f, "Ll"}, {0x001e90, "Lu"}, {0x001e91, "Ll"},
+	{0x001e92, "Lu"}, {0x001e93, "Ll"}, {0x001e94, "Lu"}, {0x001e95, "Ll"}, {0x001e9e, "Lu"},
+	{0x001e9f, "Ll"}, {0x001ea0, "Lu"}, {0x001ea1, "Ll"}, {0x001ea2, "Lu"}, {0x001ea3, "Ll"},
+	{0x001ea4, "Lu"}, {0x001ea5, "Ll"}, {0x001ea6, "Lu"}, {0x001ea7, "Ll"}, {0x001ea8, "Lu"},
+	{0x001ea9, "Ll"}, {0x001eaa, "Lu"}, {0x001eab, "Ll"}, {0x001eac, "Lu"}, {0x001ead, "Ll"},
+	{0x001eae, "Lu"}, {0x001eaf, "Ll"}, {0x001eb0, "Lu"}, {0x001eb1, "Ll"}, {0x001eb2, "Lu"},
+	{0x001eb3, "Ll"}, {0x001eb4, "Lu"}, {0x001eb5, "Ll"}, {0x001eb6, "Lu"}, {0x001eb7, "Ll"},
+	{0x001eb8, "Lu"}, {0x001eb9, "Ll"}, {0x001eba, "Lu"}, {0x001ebb, "Ll"}, {0x001ebc, "Lu"},
+	{0x001ebd, "Ll"}, {0x001ebe, "Lu"}, {0x001ebf, "Ll"}, {0x001ec0, "Lu"}, {0x001ec1, "Ll"},
+	{0x001ec2, "Lu"}, {0x001ec3, "Ll"}, {0x001ec4, "Lu"}, {0x001ec5, "Ll"}, {0x001ec6, "Lu"},
+	{0x001ec7, "Ll"}, {0x001ec8, "Lu"}, {0x001ec9, "Ll"}, {0x001eca, "Lu"}, {0x001ecb, "Ll"},
+	{0x001ecc, "Lu"}, {0x001ecd, "Ll"}, {0x001ece, "Lu"}, {0x001ecf, "Ll"}, {0x001ed0, "Lu"},
+	{0x001ed1, "Ll"}, {0x001ed2, "Lu"}, {0x001ed3, "Ll"}, {0x001ed4, "Lu"}, {0x001ed5, "Ll"},
+	{0x001ed6, "Lu"}, {0x001ed7, "Ll"}, {0x001ed8, "Lu"}, {0x001ed9, "Ll"}, {0x001eda, "Lu"},
+	{0x001edb, "Ll"}, {0x001edc, "Lu"}, {0x001edd, "Ll"}, {0x001ede, "Lu"}, {0x001edf, "Ll"},
+	{0x001ee0, "Lu"}, {0x001ee1, "Ll"}, {0x001ee2, "Lu"}, {0x001ee3, "Ll"}, {0x001ee4, "Lu"},
+	{0x001ee5, "Ll"}, {0x001ee6, "Lu"}, {0x001ee7, "Ll"}, {0x001ee8, "Lu"}, {0x001ee9, "Ll"},
+	{0x001eea, "Lu"}, {0x001eeb, "Ll"}, {0x001eec, "Lu"}, {0x001eed, "Ll"}, {0x001eee, "Lu"},
+	{0x001eef, "Ll"}, {0x001ef0, "Lu"}, {0x001ef1, "Ll"}, {0x001ef2, "Lu"}, {0x001ef3, "Ll"},
+	{0x001ef4, "Lu"}, {0x001ef5, "Ll"}, {0x001ef6, "Lu"}, {0x001ef7, "Ll"}, {0x001ef8, "Lu"},
+	{0x001ef9, "Ll"}, {0x001efa, "Lu"}, {0x001efb, "Ll"}, {0x001efc, "Lu"}, {0x001efd, "Ll"},
+	{0x001efe, "Lu"}, {0x001eff, "Ll"}, {0x001f08, "Lu"}, {0x001f10, "Ll"}, {0x001f16, "Cn"},
+	{0x001f18, "Lu"}, {0x001f1e, "Cn"}, {0x001f20, "Ll"}, {0x001f28, "Lu"}, {0x001f30, "Ll"},
+	{0x001f38, "Lu"}, {0x001f40, "Ll"}, {0x001f46, "Cn"}, {0x001f48, "Lu"}, {0x001f4e, "Cn"},
+	{0x001f50, "Ll"}, {0x001f58, "Cn"}, {0x001f59, "Lu"}, {0x001f5a, "Cn"}, {0x001f5b, "Lu"},
+	{0x001f5c, "Cn"}, {0x001f5d, "Lu"}, {0x001f5e, "Cn"}, {0x001f5f, "Lu"}, {0x001f60, "Ll"},
+	{0x001f68, "Lu"}, {0x001f70, "Ll"}, {0x001f7e, "Cn"}, {0x001f80, "Ll"}, {0x001f88, "Lt"},
+	{0x001f90, "Ll"}, {0x001f98, "Lt"}, {0x001fa0, "Ll"}, {0x001fa8, "Lt"}, {0x001fb0, "Ll"},
+	{0x001fb5, "Cn"}, {0x001fb6, "Ll"}, {0x001fb8, "Lu"}, {0x001fbc, "Lt"}, {0x001fbd, "Sk"},
+	{0x001fbe, "Ll"}, {0x001fbf, "Sk"}, {0x001fc2, "Ll"}, {0x001fc5, "Cn"}, {0x001fc6, "Ll"},
+	{0x001fc8, "Lu"}, {0x001fcc, "Lt"}, {0x001fcd, "Sk"}, {0x001fd0, "Ll"}, {0x001fd4, "Cn"},
+	{0x001fd6, "Ll"}, {0x001fd8, "Lu"}, {0x001fdc, "Cn"}, {0x001fdd, "Sk"}, {0x001fe0, "Ll"},
+	{0x001fe8, "Lu"}, {0x001fed, "Sk"}, {0x001ff0, "Cn"}, {0x001ff2, "Ll"}, {0x001ff5, "Cn"},
+	{0x001ff6, "Ll"}, {0x001ff8, "Lu"}, {0x001ffc, "Lt"}, {0x001ffd, "Sk"}, {0x001fff, "Cn"},
+	{0x002000, "Zs"}, {0x00200b, "Cf"}, {0x002010, "Pd"}, {0x002016, "Po"}, {0x002018, "Pi"},
+	{0x002019, "Pf"}, {0x00201a, "Ps"}, {0x00201b, "Pi"}, {0x00201d, "Pf"}, {0x00201e, "Ps"},
+	{0x00201f, "Pi"}, {0x002020, "Po"}, {0x002028, "Zl"}, {0x002029, "Zp"}, {0x00202a, "Cf"},
+	{0x00202f, "Zs"}, {0x002030, "Po"}, {0x002039, "Pi"}, {0x00203a, "Pf"}, {0x00203b, "Po"},
+	{0x00203f, "Pc"}, {0x002041, "Po"}, {0x002044, "Sm"}, {0x002045, "Ps"}, {0x002046, "Pe"},
+	{0x002047, "Po"}, {0x002052, "Sm"}, {0x002053, "Po"}, {0x002054, "Pc"}, {0x002055, "Po"},
+	{0x00205f, "Zs"}, {0x002060, "Cf"}, {0x002065, "Cn"}, {0x002066, "Cf"}, {0x002070, "No"},
+	{0x002071, "Lm"}, {0x002072, "Cn"}, {0x002074, "No"}, {0x00207a, "Sm"}, {0x00207d, "Ps"},
+	{0x00207e, "Pe"}, {0x00207f, "Lm"}, {0x002080, "No"}, {0x00208a, "Sm"}, {0x00208d, "Ps"},
+	{0x00208e, "Pe"}, {0x00208f, "Cn"}, {0x002090, "Lm"}, {0x00209d, "Cn"}, {0x0020a0, "Sc"},
+	{0x0020c1, "Cn"}, {0x0020d0, "Mn"}, {0x0020dd, "Me"}, {0x0020e1, "Mn"}, {0x0020e2, "Me"},
+	{0x0020e5, "Mn"}, {0x0020f1, "Cn"}, {0x002100, "So"}, {0x002102, "Lu"}, {0x002103, "So"},
+	{0x002107, "Lu"}, {0x002108, "So"}, {0x00210a, "Ll"}, {0x00210b, "Lu"}, {0x00210e, "Ll"},
+	{0x002110, "Lu"}, {0x002113, "Ll"}, {0x002114, "So"}, {0x002115, "Lu"}, {0x002116, "So"},
+	{0x002118, "Sm"}, {0x002119, "Lu"}, {0x00211e, "So"}, {0x002124, "Lu"}, {0x002125, "So"},
+	{0x002126, "Lu"}, {0x002127, "So"}, {0x002128, "Lu"}, {0x002129, "So"}, {0x00212a, "Lu"},
+	{0x00212e, "So"}, {0x00212f, "Ll"}, {0x002130, "Lu"}, {0x002134, "Ll"}, {0x002135, "Lo"},
+	{0x002139, "Ll"}, {0x00213a, "So"}, {0x00213c, "Ll"}, {0x00213e, "Lu"}, {0x002140, "Sm"},
+	{0x002145, "Lu"}, {0x002146, "Ll"}, {0x00214a, "So"}, {0x00214b, "Sm"}, {0x00214c, "So"},
+	{0x00214e, "Ll"}, {0x00214f, "So"}, {0x002150, "No"}, {0x002160, "Nl"}, {0x002183, "Lu"},
+	{0x002184, "Ll"}, {0x002185, "Nl"}, {0x002189, "No"}, {0x00218a, "So"}, {0x00218c, "Cn"},
+	{0x002190, "Sm"}, {0x002195, "So"}, {0x00219a, "Sm"}, {0x00219c, "So"}, {0x0021a0, "Sm"},
+	{0x0021a1, "So"}, {0x0021a3, "Sm"}, {0x0021a4, "So"}, {0x0021a6, "Sm"}, {0x0021a7, "So"},
+	{0x0021ae, "Sm"}, {0x0021af, "So"}, {0x0021ce, "Sm"}, {0x0021d0, "So"}, {0x0021d2, "Sm"},
+	{0x0021d3, "So"}, {0x0021d4, "Sm"}, {0x0021d5, "So"}, {0x0021f4, "Sm"}, {0x002300, "So"},
+	{0x002308, "Ps"}, {0x002309, "Pe"}, {0x00230a, "Ps"}, {0x00230b, "Pe"}, {0x00230c, "So"},
+	{0x002320, "Sm"}, {0x002322, "So"}, {0x002329, "Ps"}, {0x00232a, "Pe"}, {0x00232b, "So"},
+	{0x00237c, "Sm"}, {0x00237d, "So"}, {0x00239b, "Sm"}, {0x0023b4, "So"}, {0x0023dc, "Sm"},
+	{0x0023e2, "So"}, {0x002427, "Cn"}, {0x002440, "So"}, {0x00244b, "Cn"}, {0x002460, "No"},
+	{0x00249c, "So"}, {0x0024ea, "No"}, {0x002500, "So"}, {0x0025b7, "Sm"}, {0x0025b8, "So"},
+	{0x0025c1, "Sm"}, {0x0025c2, "So"}, {0x0025f8, "Sm"}, {0x002600, "So"}, {0x00266f, "Sm"},
+	{0x002670, "So"}, {0x002768, "Ps"}, {0x002769, "Pe"}, {0x00276a, "Ps"}, {0x00276b, "Pe"},
+	{0x00276c, "Ps"}, {0x00276d, "Pe"}, {0x00276e, "Ps"}, {0x00276f, "Pe"}, {0x002770, "Ps"},
+	{0x002771, "Pe"}, {0x002772, "Ps"}, {0x002773, "Pe"}, {0x002774, "Ps"}, {0x002775, "Pe"},
+	{0x002776, "No"}, {0x002794, "So"}, {0x0027c0, "Sm"}, {0x0027c5, "Ps"}, {0x0027c6, "Pe"},
+	{0x0027c7, "Sm"}, {0x0027e6, "Ps"}, {0x0027e7, "Pe"}, {0x0027e8, "Ps"}, {0x0027e9, "Pe"},
+	{0x0027ea, "Ps"}, {0x0027eb, "Pe"}, {0x0027ec, "Ps"}, {0x0027ed, "Pe"}, {0x0027ee, "Ps"},
+	{0x0027ef, "Pe"}, {0x0027f0, "Sm"}, {0x002800, "So"}, {0x002900, "Sm"}, {0x002983, "Ps"},
+	{0x002984, "Pe"}, {0x002985, "Ps"}, {0x002986, "Pe"}, {0x002987, "Ps"}, {0x002988, "Pe"},
+	{0x002989, "Ps"}, {0x00298a, "Pe"}, {0x00298b, "Ps"}, {0x00298c, "Pe"}, {0x00298d, "Ps"},
+	{0x00298e, "Pe"}, {0x00298f, "Ps"}, {0x002990, "Pe"}, {0x002991, "Ps"}, {0x002992, "Pe"},
+	{0x002993, "Ps"}, {0x002994, "Pe"}, {0x002995, "Ps"}, {0x002996, "Pe"}, {0x002997, "Ps"},
+	{0x002998, "Pe"}, {0x002999, "Sm"}, {0x0029d8, "Ps"}, {0x0029d9, "Pe"}, {0x0029da, "Ps"},
+	{0x0029db, "Pe"}, {0x0029dc, "Sm"}, {0x0029fc, "Ps"}, {0x0029fd, "Pe"}, {0x0029fe, "Sm"},
+	{0x002b00, "So"}, {0x002b30, "Sm"}, {0x002b45, "So"}, {0x002b47, "Sm"}, {0x002b4d, "So"},
+	{0x002b74, "Cn"}, {0x002b76, "So"}, {0x002b96, "Cn"}, {0x002b97, "So"}, {0x002c00, "Lu"},
+	{0x002c30, "Ll"}, {0x002c60, "Lu"}, {0x002c61, "Ll"}, {0x002c62, "Lu"}, {0x002c65, "Ll"},
+	{0x002c67, "Lu"}, {0x002c68, "Ll"}, {0x002c69, "Lu"}, {0x002c6a, "Ll"}, {0x002c6b, "Lu"},
+	{0x002c6c, "Ll"}, {0x002c6d, "Lu"}, {0x002c71, "Ll"}, {0x002c72, "Lu"}, {0x002c73, "Ll"},
+	{0x002c75, "Lu"}, {0x002c76, "Ll"}, {0x002c7c, "Lm"}, {0x002c7e, "Lu"}, {0x002c81, "Ll"},
+	{0x002c82, "Lu"}, {0x002c83, "Ll"}, {0x002c84, "Lu"}, {0x002c85, "Ll"}, {0x002c86, "Lu"},
+	{0x002c87, "Ll"}, {0x002c88, "Lu"}, {0x002c89, "Ll"}, {0x002c8a, "Lu"}, {0x002c8b, "Ll"},
+	{0x002c8c, "Lu"}, {0x002c8d, "Ll"}, {0x002c8e, "Lu"}, {0x002c8f, "Ll"}, {0x002c90, "Lu"},
+	{0x002c91, "Ll"}, {0x002c92, "Lu"}, {0x002c93, "Ll"}, {0x002c94, "Lu"}, {0x002c95, "Ll"},
+	{0x002c96, "Lu"}, {0x002c97, "Ll"}, {0x002c98, "Lu"}, {0x002c99, "Ll"}, {0x002c9a, "Lu"},
+	{0x002c9b, "Ll"}, {0x002c9c, "Lu"}, {0x002c9d, "Ll"}, {0x002c9e, "Lu"}, {0x002c9f, "Ll"},
+	{0x002ca0, "Lu"}, {0x002ca1, "Ll"}, {0x002ca2, "Lu"}, {0x002ca3, "Ll"}, {0x002ca4, "Lu"},
+	{0x002ca5, "Ll"}, {0x002ca6, "Lu"}, {0x002ca7, "Ll"}, {0x002ca8, "Lu"}, {0x002ca9, "Ll"},
+	{0x002caa, "Lu"}, {0x002cab, "Ll"}, {0x002cac, "Lu"}, {0x002cad, "Ll"}, {0x002cae, "Lu"},
+	{0x002caf, "Ll"}, {0x002cb0, "Lu"}, {0x002cb1, "Ll"}, {0x002cb2, "Lu"}, {0x002cb3, "Ll"},
+	{0x002cb4, "Lu"}, {0x002cb5, "Ll"}, {0x002cb6, "Lu"}, {0x002cb7, "Ll"}, {0x002cb8, "Lu"},
+	{0x002cb9, "Ll"}, {0x002cba, "Lu"}, {0x002cbb, "Ll"}, {0x002cbc, "Lu"}, {0x002cbd, "Ll"},
+	{0x002cbe, "Lu"}, {0x002cbf, "Ll"}, {0x002cc0, "Lu"}, {0x002cc1, "Ll"}, {0x002cc2, "Lu"},
+	{0x002cc3, "Ll"}, {0x002cc4, "Lu"}, {0x002cc5, "Ll"}, {0x002cc6, "Lu"}, {0x002cc7, "Ll"},
+	{0x002cc8, "Lu"}, {0x002cc9, "Ll"}, {0x002cca, "Lu"}, {0x002ccb, "Ll"}, {0x002ccc, "Lu"},
+	{0x002ccd, "Ll"}, {0x002cce, "Lu"}, {0x002ccf, "Ll"}, {0x002cd0, "Lu"}, {0x002cd1, "Ll"},
+	{0x002cd2, "Lu"}, {0x002cd3, "Ll"}, {0x002cd4, "Lu"}, {0x002cd5, "Ll"}, {0x002cd6, "Lu"},
+	{0x002cd7, "Ll"}, {0x002cd8, "Lu"}, {0x002cd9, "Ll"}, {0x002cda, "Lu"}, {0x002cdb, "Ll"},
+	{0x002cdc, "Lu"}, {0x002cdd, "Ll"}, {0x002cde, "Lu"}, {0x002cdf, "Ll"}, {0x002ce0, "Lu"},
+	{0x002ce1, "Ll"}, {0x002ce2, "Lu"}, {0x002ce3, "Ll"}, {0x002ce5, "So"}, {0x002ceb, "Lu"},
+	{0x002cec, "Ll"}, {0x002ced, "Lu"}, {0x002cee, "Ll"}, {0x002cef, "Mn"}, {0x002cf2, "Lu"},
+	{0x002cf3, "Ll"}, {0x002cf4, "Cn"}, {0x002cf9, "Po"}, {0x002cfd, "No"}, {0x002cfe, "Po"},
+	{0x002d00, "Ll"}, {0x002d26, "Cn"}, {0x002d27, "Ll"}, {0x002d28, "Cn"}, {0x002d2d, "Ll"},
+	{0x002d2e, "Cn"}, {0x002d30, "Lo"}, {0x002d68, "Cn"}, {0x002d6f, "Lm"}, {0x002d70, "Po"},
+	{0x002d71, "Cn"}, {0x002d7f, "Mn"}, {0x002d80, "Lo"}, {0x002d97, "Cn"}, {0x002da0, "Lo"},
+	{0x002da7, "Cn"}, {0x002da8, "Lo"}, {0x002daf, "Cn"}, {0x002db0, "Lo"}, {0x002db7, "Cn"},
+	{0x002db8, "Lo"}, {0x002dbf, "Cn"}, {0x002dc0, "Lo"}, {0x002dc7, "Cn"}, {0x002dc8, "Lo"},
+	{0x002dcf, "Cn"}, {0x002dd0, "Lo"}, {0x002dd7, "Cn"}, {0x002dd8, "Lo"}, {0x002ddf, "Cn"},
+	{0x002de0, "Mn"}, {0x002e00, "Po"}, {0x002e02, "Pi"}, {0x002e03, "Pf"}, {0x002e04, "Pi"},
+	{0x002e05, "Pf"}, {0x002e06, "Po"}, {0x002e09, "Pi"}, {0x002e0a, "Pf"}, {0x002e0b, "Po"},
+	{0x002e0c, "Pi"}, {0x002e0d, "Pf"}, {0x002e0e, "Po"}, {0x002e17, "Pd"}, {0x002e18, "Po"},
+	{0x002e1a, "Pd"}, {0x002e1b, "Po"}, {0x002e1c, "Pi"}, {0x002e1d, "Pf"}, {0x002e1e, "Po"},
+	{0x002e20, "Pi"}, {0x002e21, "Pf"}, {0x002e22, "Ps"}, {0x002e23, "Pe"}, {0x002e24, "Ps"},
+	{0x002e25, "Pe"}, {0x002e26, "Ps"}, {0x002e27, "Pe"}, {0x002e28, "Ps"}, {0x002e29, "Pe"},
+	{0x002e2a, "Po"}, {0x002e2f, "Lm"}, {0x002e30, "Po"}, {0x002e3a, "Pd"}, {0x002e3c, "Po"},
+	{0x002e40, "Pd"}, {0x002e41, "Po"}, {0x002e42, "Ps"}, {0x002e43, "Po"}, {0x002e50, "So"},
+	{0x002e52, "Po"}, {0x002e55, "Ps"}, {0x002e56, "Pe"}, {0x002e57, "Ps"}, {0x002e58, "Pe"},
+	{0x002e59, "Ps"}, {0x002e5a, "Pe"}, {0x002e5b, "Ps"}, {0x002e5c, "Pe"}, {0x002e5d, "Pd"},
+	{0x002e5e, "Cn"}, {0x002e80, "So"}, {0x002e9a, "Cn"}, {0x002e9b, "So"}, {0x002ef4, "Cn"},
+	{0x002f00, "So"}, {0x002fd6, "Cn"}, {0x002ff0, "So"}, {0x002ffc, "Cn"}, {0x003000, "Zs"},
+	{0x003001, "Po"}, {0x003004, "So"}, {0x003005, "Lm"}, {0x003006, "Lo"}, {0x003007, "Nl"},
+	{0x003008, "Ps"}, {0x003009, "Pe"}, {0x00300a, "Ps"}, {0x00300b, "Pe"}, {0x00300c, "Ps"},
+	{0x00300d, "Pe"}, {0x00300e, "Ps"}, {0x00300f, "Pe"}, {0x003010, "Ps"}, {0x003011, "Pe"},
+	{0x003012, "So"}, {0x003014, "Ps"}, {0x003015, "Pe"}, {0x003016, "Ps"}, {0x003017, "Pe"},
+	{0x003018, "Ps"}, {0x003019, "Pe"}, {0x00301a, "Ps"}, {0x00301b, "Pe"}, {0x00301c, "Pd"},
+	{0x00301d, "Ps"}, {0x00301e, "Pe"}, {0x003020, "So"}, {0x003021, "Nl"}, {0x00302a, "Mn"},
+	{0x00302e, "Mc"}, {0x003030, "Pd"}, {0x003031, "Lm"}, {0x003036, "So"}, {0x003038, "Nl"},
+	{0x00303b, "Lm"}, {0x00303c, "Lo"}, {0x00303d, "Po"}, {0x00303e, "So"}, {0x003040, "Cn"},
+	{0x003041, "Lo"}, {0x003097, "Cn"}, {0x003099, "Mn"}, {0x00309b, "Sk"}, {0x00309d, "Lm"},
+	{0x00309f, "Lo"}, {0x0030a0, "Pd"}, {0x0030a1, "Lo"}, {0x0030fb, "Po"}, {0x0030fc, "Lm"},
+	{0x0030ff, "Lo"}, {0x003100, "Cn"}, {0x003105, "Lo"}, {0x003130, "Cn"}, {0x003131, "Lo"},
+	{0x00318f, "Cn"}, {0x003190, "So"}, {0x003192, "No"}, {0x003196, "So"}, {0x0031a0, "Lo"},
+	{0x0031c0, "So"}, {0x0031e4, "Cn"}, {0x0031f0, "Lo"}, {0x003200, "So"}, {0x00321f, "Cn"},
+	{0x003220, "No"}, {0x00322a, "So"}, {0x003248, "No"}, {0x003250, "So"}, {0x003251, "No"},
+	{0x003260, "So"}, {0x003280, "No"}, {0x00328a, "So"}, {0x0032b1, "No"}, {0x0032c0, "So"},
+	{0x003400, "Lo"}, {0x004dc0, "So"}, {0x004e00, "Lo"}, {0x00a015, "Lm"}, {0x00a016, "Lo"},
+	{0x00a48d, "Cn"}, {0x00a490, "So"}, {0x00a4c7, "Cn"}, {0x00a4d0, "Lo"}, {0x00a4f8, "Lm"},
+	{0x00a4fe, "Po"}, {0x00a500, "Lo"}, {0x00a60c, "Lm"}, {0x00a60d, "Po"}, {0x00a610, "Lo"},
+	{0x00a620, "Nd"}, {0x00a62a, "Lo"}, {0x00a62c, "Cn"}, {0x00a640, "Lu"}, {0x00a641, "Ll"},
+	{0x00a642, "Lu"}, {0x00a643, "Ll"}, {0x00a644, "Lu"}, {0x00a645, "Ll"}, {0x00a646, "Lu"},
+	{0x00a647, "Ll"}, {0x00a648, "Lu"}, {0x00a649, "Ll"}, {0x00a64a, "Lu"}, {0x00a64b, "Ll"},
+	{0x00a64c, "Lu"}, {0x00a64d, "Ll"}, {0x00a64e, "Lu"}, {0x00a64f, "Ll"}, {0x00a650, "Lu"},
+	{0x00a651, "Ll"}, {0x00a652, "Lu"}, {0x00a653, "Ll"}, {0x00a654, "Lu"}, {0x00a655, "Ll"},
+	{0x00a656, "Lu"}, {0x00a657, "Ll"}, {0x00a658, "Lu"}, {0x00a659, "Ll"}, {0x00a65a, "Lu"},
+	{0x00a65b, "Ll"}, {0x00a65c, "Lu"}, {0x00a65d, "Ll"}, {0x00a65e, "Lu"}, {0x00a65f, "Ll"},
+	{0x00a660, "Lu"}, {0x00a661, "Ll"}, {0x00a662, "Lu"}, {0x00a663, "Ll"}, {0x00a664, "Lu"},
+	{0x00a665, "Ll"}, {0x00a666, "Lu"}, {0x00a667, "Ll"}, {0x00a668, "Lu"}, {0x00a669, "Ll"},
+	{0x00a66a, "Lu"}, {0x00a66b, "Ll"}, {0x00a66c, "Lu"}, {0x00a66d, "Ll"}, {0x00a66e, "Lo"},
+	{0x00a66f, "Mn"}, {0x00a670, "Me"}, {0x00a673, "Po"}, {0x00a674, "Mn"}, {0x00a67e, "Po"},
+	{0x00a67f, "Lm"}, {0x00a680, "Lu"}, {0x00a681, "Ll"}, {0x00a682, "Lu"}, {0x00a683, "Ll"},
+	{0x00a684, "Lu"}, {0x00a685, "Ll"}, {0x00a686, "Lu"}, {0x00a687, "Ll"}, {0x00a688, "Lu"},
+	{0x00a689, "Ll"}, {0x00a68a, "Lu"}, {0x00a68b, "Ll"}, {0x00a68c, "Lu"}, {0x00a68d, "Ll"},
+	{0x00a68e, "Lu"}, {0x00a68f, "Ll"}, {0x00a690, "Lu"}, {0x00a691, "Ll"}, {0x00a692, "Lu"},
+	{0x00a693, "Ll"}, {0x00a694, "Lu"}, {0x00a695, "Ll"}, {0x00a696, "Lu"}, {0x00a697, "Ll"},
+	{0x00a698, "Lu"}, {0x00a699, "Ll"}, {0x00a69a, "Lu"}, {0x00a69b, "Ll"}, {0x00a69c, "Lm"},
+	{0x00a69e, "Mn"}, {0x00a6a0, "Lo"}, {0x00a6e6, "Nl"}, {0x00a6f0, "Mn"}, {0x00a6f2, "Po"},
+	{0x00a6f8, "Cn"}, {0x00a700, "Sk"}, {0x00a717, "Lm"}, {0x00a720, "Sk"}, {0x00a722, "Lu"},
+	{0x00a723, "Ll"}, {0x00a724, "Lu"}, {0x00a725, "Ll"}, {0x00a726, "Lu"}, {0x00a727, "Ll"},
+	{0x00a728, "Lu"}, {0x00a729, "Ll"}, {0x00a72a, "Lu"}, {0x00a72b, "Ll"}, {0x00a72c, "Lu"},
+	{0x00a72d, "Ll"}, {0x00a72e, "Lu"}, {0x00a72f, "Ll"}, {0x00a732, "Lu"}, {0x00a733, "Ll"},
+	{0x00a734, "Lu"}, {0x00a735, "Ll"}, {0x00a736, "Lu"}, {0x00a737, "Ll"}, {0x00a738, "Lu"},
+	{0x00a739, "Ll"}, {0x00a73a, "Lu"}, {0x00a73b, "Ll"}, {0x00a73c, "Lu"}, {0x00a73d, "Ll"},
+	{0x00a73e, "Lu"}, {0x00a73f, "Ll"}, {0x00a740, "Lu"}, {0x00a741, "Ll"}, {0x00a742, "Lu"},
+	{0x00a743, "Ll"}, {0x00a744, "Lu"}, {0x00a745, "Ll"}, {0x00a746, "Lu"}, {0x00a747, "Ll"},
+	{0x00a748, "Lu"}, {0x00a749, "Ll"}, {0x00a74a, "Lu"}, {0x00a74b, "Ll"}, {0x00a74c, "Lu"},
+	{0x00a74d, "Ll"}, {0x00a74e, "Lu"}, {0x00a74f, "Ll"}, {0x00a750, "Lu"}, {0x00a751, "Ll"},
+	{0x00a752, "Lu"}, {0x00a753, "Ll"}, {0x00a754, "Lu"}, {0x00a755, "Ll"}, {0x00a756, "Lu"},
+	{0x00a757, "Ll"}, {0x00a758, "Lu"}, {0x00a759, "Ll"}, {0x00a75a, "Lu"}, {0x00a75b, "Ll"},
+	{0x00a75c, "Lu"}, {0x00a75d, "Ll"}, {0x00a75e, "Lu"}, {0x00a75f, "Ll"}, {0x00a760, "Lu"},
+	{0x00a761, "Ll"}, {0x00a762, "Lu"}, {0x00a763, "Ll"}, {0x00a764, "Lu"}, {0x00a765, "Ll"},
+	{0x00a766, "Lu"}, {0x00a767, "Ll"}, {0x00a768, "Lu"}, {0x00a769, "Ll"}, {0x00a76a, "Lu"},
+	{0x00a76b, "Ll"}, {0x00a76c, "Lu"}, {0x00a76d, "Ll"}, {0x00a76e, "Lu"}, {0x00a76f, "Ll"},
+	{0x00a770, "Lm"}, {0x00a771, "Ll"}, {0x00a779, "Lu"}, {0x00a77a, "Ll"}, {0x00a77b, "Lu"},
+	{0x00a77c, "Ll"}, {0x00a77d, "Lu"}, {0x00a77f, "Ll"}, {0x00a780, "Lu"}, {0x00a781, "Ll"},
+	{0x00a782, "Lu"}, {0x00a783, "Ll"}, {0x00a784, "Lu"}, {0x00a785, "Ll"}, {0x00a786, "Lu"},
+	{0x00a787, "Ll"}, {0x00a788, "Lm"}, {0x00a789, "Sk"}, {0x00a78b, "Lu"}, {0x00a78c, "Ll"},
+	{0x00a78d, "Lu"}, {0x00a78e, "Ll"}, {0x00a78f, "Lo"}, {0x00a790, "Lu"}, {0x00a791, "Ll"},
+	{0x00a792, "Lu"}, {0x00a793, "Ll"}, {0x00a796, "Lu"}, {0x00a797, "Ll"}, {0x00a798, "Lu"},
+	{0x00a799, "Ll"}, {0x00a79a, "Lu"}, {0x00a79b, "Ll"}, {0x00a79c, "Lu"}, {0x00a79d, "Ll"},
+	{0x00a79e, "Lu"}, {0x00a79f, "Ll"}, {0x00a7a0, "Lu"}, {0x00a7a1, "Ll"}, {0x00a7a2, "Lu"},
+	{0x00a7a3, "Ll"}, {0x00a7a4, "Lu"}, {0x00a7a5, "Ll"}, {0x00a7a6, "Lu"}, {0x00a7a7, "Ll"},
+	{0x00a7a8, "Lu"}, {0x00a7a9, "Ll"}, {0x00a7aa, "Lu"}, {0x00a7af, "Ll"}, {0x00a7b0, "Lu"},
+	{0x00a7b5, "Ll"}, {0x00a7b6, "Lu"}, {0x00a7b7, "Ll"}, {0x00a7b8, "Lu"}, {0x00a7b9, "Ll"},
+	{0x00a7ba, "Lu"}, {0x00a7bb, "Ll"}, {0x00a7bc, "Lu"}, {0x00a7bd, "Ll"}, {0x00a7be, "Lu"},
+	{0x00a7bf, "Ll"}, {0x00a7c0, "Lu"}, {0x00a7c1, "Ll"}, {0x00a7c2, "Lu"}, {0x00a7c3, "Ll"},
+	{0x00a7c4, "Lu"}, {0x00a7c8, "Ll"}, {0x00a7c9, "Lu"}, {0x00a7ca, "Ll"}, {0x00a7cb, "Cn"},
+	{0x00a7d0, "Lu"}, {0x00a7d1, "Ll"}, {0x00a7d2, "Cn"}, {0x00a7d3, "Ll"}, {0x00a7d4, "Cn"},
+	{0x00a7d5, "Ll"}, {0x00a7d6, "Lu"}, {0x00a7d7, "Ll"}, {0x00a7d8, "Lu"}, {0x00a7d9, "Ll"},
+	{0x00a7da, "Cn"}, {0x00a7f2, "Lm"}, {0x00a7f5, "Lu"}, {0x00a7f6, "Ll"}, {0x00a7f7, "Lo"},
+	{0x00a7f8, "Lm"}, {0x00a7fa, "Ll"}, {0x00a7fb, "Lo"}, {0x00a802, "Mn"}, {0x00a803, "Lo"},
+	{0x00a806, "Mn"}, {0x00a807, "Lo"}, {0x00a80b, "Mn"}, {0x00a80c, "Lo"}, {0x00a823, "Mc"},
+	{0x00a825, "Mn"}, {0x00a827, "Mc"}, {0x00a828, "So"}, {0x00a82c, "Mn"}, {0x00a82d, "Cn"},
+	{0x00a830, "No"}, {0x00a836, "So"}, {0x00a838, "Sc"}, {0x00a839, "So"}, {0x00a83a, "Cn"},
+	{0x00a840, "Lo"}, {0x00a874, "Po"}, {0x00a878, "Cn"}, {0x00a880, "Mc"}, {0x00a882, "Lo"},
+	{0x00a8b4, "Mc"}, {0x00a8c4, "Mn"}, {0x00a8c6, "Cn"}, {0x00a8ce, "Po"}, {0x00a8d0, "Nd"},
+	{0x00a8da, "Cn"}, {0x00a8e0, "Mn"}, {0x00a8f2, "Lo"}, {0x00a8f8, "Po"}, {0x00a8fb, "Lo"},
+	{0x00a8fc, "Po"}, {0x00a8fd, "Lo"}, {0x00a8ff, "Mn"}, {0x00a900, "Nd"}, {0x00a90a, "Lo"},
+	{0x00a926, "Mn"}, {0x00a92e, "Po"}, {0x00a930, "Lo"}, {0x00a947, "Mn"}, {0x00a952, "Mc"},
+	{0x00a954, "Cn"}, {0x00a95f, "Po"}, {0x00a960, "Lo"}, {0x00a97d, "Cn"}, {0x00a980, "Mn"},
+	{0x00a983, "Mc"}, {0x00a984, "Lo"}, {0x00a9b3, "Mn"}, {0x00a9b4, "Mc"}, {0x00a9b6, "Mn"},
+	{0x00a9ba, "Mc"}, {0x00a9bc, "Mn"}, {0x00a9be, "Mc"}, {0x00a9c1, "Po"}, {0x00a9ce, "Cn"},
+	{0x00a9cf, "Lm"}, {0x00a9d0, "Nd"}, {0x00a9da, "Cn"}, {0x00a9de, "Po"}, {0x00a9e0, "Lo"},
+	{0x00a9e5, "Mn"}, {0x00a9e6, "Lm"}, {0x00a9e7, "Lo"}, {0x00a9f0, "Nd"}, {0x00a9fa, "Lo"},
+	{0x00a9ff, "Cn"}, {0x00aa00, "Lo"}, {0x00aa29, "Mn"}, {0x00aa2f, "Mc"}, {0x00aa31, "Mn"},
+	{0x00aa33, "Mc"}, {0x00aa35, "Mn"}, {0x00aa37, "Cn"}, {0x00aa40, "Lo"}, {0x00aa43, "Mn"},
+	{0x00aa44, "Lo"}, {0x00aa4c, "Mn"}, {0x00aa4d, "Mc"}, {0x00aa4e, "Cn"}, {0x00aa50, "Nd"},
+	{0x00aa5a, "Cn"}, {0x00aa5c, "Po"}, {0x00aa60, "Lo"}, {0x00aa70, "Lm"}, {0x00aa71, "Lo"},
+	{0x00aa77, "So"}, {0x00aa7a, "Lo"}, {0x00aa7b, "Mc"}, {0x00aa7c, "Mn"}, {0x00aa7d, "Mc"},
+	{0x00aa7e, "Lo"}, {0x00aab0, "Mn"}, {0x00aab1, "Lo"}, {0x00aab2, "Mn"}, {0x00aab5, "Lo"},
+	{0x00aab7, "Mn"}, {0x00aab9, "Lo"}, {0x00aabe, "Mn"}, {0x00aac0, "Lo"}, {0x00aac1, "Mn"},
+	{0x00aac2, "Lo"}, {0x00aac3, "Cn"}, {0x00aadb, "Lo"}, {0x00aadd, "Lm"}, {0x00aade, "Po"},
+	{0x00aae0, "Lo"}, {0x00aaeb, "Mc"}, {0x00aaec, "Mn"}, {0x00aaee, "Mc"}, {0x00aaf0, "Po"},
+	{0x00aaf2, "Lo"}, {0x00aaf3, "Lm"}, {0x00aaf5, "Mc"}, {0x00aaf6, "Mn"}, {0x00aaf7, "Cn"},
+	{0x00ab01, "Lo"}, {0x00ab07, "Cn"}, {0x00ab09, "Lo"}, {0x00ab0f, "Cn"}, {0x00ab11, "Lo"},
+	{0x00ab17, "Cn"}, {0x00ab20, "Lo"}, {0x00ab27, "Cn"}, {0x00ab28, "Lo"}, {0x00ab2f, "Cn"},
+	{0x00ab30, "Ll"}, {0x00ab5b, "Sk"}, {0x00ab5c, "Lm"}, {0x00ab60, "Ll"}, {0x00ab69, "Lm"},
+	{0x00ab6a, "Sk"}, {0x00ab6c, "Cn"}, {0x00ab70, "Ll"}, {0x00abc0, "Lo"}, {0x00abe3, "Mc"},
+	{0x00abe5, "Mn"}, {0x00abe6, "Mc"}, {0x00abe8, "Mn"}, {0x00abe9, "Mc"}, {0x00abeb, "Po"},
+	{0x00abec, "Mc"}, {0x00abed, "Mn"}, {0x00abee, "Cn"}, {0x00abf0, "Nd"}, {0x00abfa, "Cn"},
+	{0x00ac00, "Lo"}, {0x00d7a4, "Cn"}, {0x00d7b0, "Lo"}, {0x00d7c7, "Cn"}, {0x00d7cb, "Lo"},
+	{0x00d7fc, "Cn"}, {0x00d800, "Cs"}, {0x00e000, "Co"}, {0x00f900, "Lo"}, {0x00fa6e, "Cn"},
+	{0x00fa70, "Lo"}, {0x00fada, "Cn"}, {0x00fb00, "Ll"}, {0x00fb07, "Cn"}, {0x00fb13, "Ll"},
+	{0x00fb18, "Cn"}, {0x00fb1d, "Lo"}, {0x00fb1e, "Mn"}, {0x00fb1f, "Lo"}, {0x00fb29, "Sm"},
+	{0x00fb2a, "Lo"}, {0x00fb37, "Cn"}, {0x00fb38, "Lo"}, {0x00fb3d, "Cn"}, {0x00fb3e, "Lo"},
+	{0x00fb3f, "Cn"}, {0x00fb40, "Lo"}, {0x00fb42, "Cn"}, {0x00fb43, "Lo"}, {0x00fb45, "Cn"},
+	{0x00fb46, "Lo"}, {0x00fbb2, "Sk"}, {0x00fbc3, "Cn"}, {0x00fbd3, "Lo"}, {0x00fd3e, "Pe"},
+	{0x00fd3f, "Ps"}, {0x00fd40, "So"}, {0x00fd50, "Lo"}, {0x00fd90, "Cn"}, {0x00fd92, "Lo"},
+	{0x00fdc8, "Cn"}, {0x00fdcf, "So"}, {0x00fdd0, "Cn"}, {0x00fdf0, "Lo"}, {0x00fdfc, "Sc"},
+	{0x00fdfd, "So"}, {0x00fe00, "Mn"}, {0x00fe10, "Po"}, {0x00fe17, "Ps"}, {0x00fe18, "Pe"},
+	{0x00fe19, "Po"}, {0x00fe1a, "Cn"}, {0x00fe20, "Mn"}, {0x00fe30, "Po"}, {0x00fe31, "Pd"},
+	{0x00fe33, "Pc"}, {0x00fe35, "Ps"}, {0x00fe36, "Pe"}, {0x00fe37, "Ps"}, {0x00fe38, "Pe"},
+	{0x00fe39, "Ps"}, {0x00fe3a, "Pe"}, {0x00fe3b, "Ps"}, {0x00fe3c, "Pe"}, {0x00fe3d, "Ps"},
+	{0x00fe3e, "Pe"}, {0x00fe3f, "Ps"}, {0x00fe40, "Pe"}, {0x00fe41, "Ps"}, {0x00fe42, "Pe"},
+	{0x00fe43, "Ps"}, {0x00fe44, "Pe"}, {0x00fe45, "Po"}, {0x00fe47, "Ps"}, {0x00fe48, "Pe"},
+	{0x00fe49, "Po"}, {0x00fe4d, "Pc"}, {0x00fe50, "Po"}, {0x00fe53, "Cn"}, {0x00fe54, "Po"},
+	{0x00fe58, "Pd"}, {0x00fe59, "Ps"}, {0x00fe5a, "Pe"}, {0x00fe5b, "Ps"}, {0x00fe5c, "Pe"},
+	{0x00fe5d, "Ps"}, {0x00fe5e, "Pe"}, {0x00fe5f, "Po"}, {0x00fe62, "Sm"}, {0x00fe63, "Pd"},
+	{0x00fe64, "Sm"}, {0x00fe67, "Cn"}, {0x00fe68, "Po"}, {0x00fe69, "Sc"}, {0x00fe6a, "Po"},
+	{0x00fe6c, "Cn"}, {0x00fe70, "Lo"}, {0x00fe75, "Cn"}, {0x00fe76, "Lo"}, {0x00fefd, "Cn"},
+	{0x00feff, "Cf"}, {0x00ff00, "Cn"}, {0x00ff01, "Po"}, {0x00ff04, "Sc"}, {0x00ff05, "Po"},
+	{0x00ff08, "Ps"}, {0x00ff09, "Pe"}, {0x00ff0a, "Po"}, {0x00ff0b, "Sm"}, {0x00ff0c, "Po"},
+	{0x00ff0d, "Pd"}, {0x00ff0e, "Po"}, {0x00ff10, "Nd"}, {0x00ff1a, "Po"}, {0x00ff1c, "Sm"},
+	{0x00ff1f, "Po"}, {0x00ff21, "Lu"}, {0x00ff3b, "Ps"}, {0x00ff3c, "Po"}, {0x00ff3d, "Pe"},
+	{0x00ff3e, "Sk"}, {0x00ff3f, "Pc"}, {0x00ff40, "Sk"}, {0x00ff41, "Ll"}, {0x00ff5b, "Ps"},
+	{0x00ff5c, "Sm"}, {0x00ff5d, "Pe"}, {0x00ff5e, "Sm"}, {0x00ff5f, "Ps"}, {0x00ff60, "Pe"},
+	{0x00ff61, "Po"}, {0x00ff62, "Ps"}, {0x00ff63, "Pe"}, {0x00ff64, "Po"}, {0x00ff66, "Lo"},
+	{0x00ff70, "Lm"}, {0x00ff71, "Lo"}, {0x00ff9e, "Lm"}, {0x00ffa0, "Lo"}, {0x00ffbf, "Cn"},
+	{0x00ffc2, "Lo"}, {0x00ffc8, "Cn"}, {0x00ffca, "Lo"}, {0x00ffd0, "Cn"}, {0x00ffd2, "Lo"},
+	{0x00ffd8, "Cn"}, {0x00ffda, "Lo"}, {0x00ffdd, "Cn"}, {0x00ffe0, "Sc"}, {0x00ffe2, "Sm"},
+	{0x00ffe3, "Sk"}, {0x00ffe4, "So"}, {0x00ffe5, "Sc"}, {0x00ffe7, "Cn"}, {0x00ffe8, "So"},
+	{0x00ffe9, "Sm"}, {0x00ffed, "So"}, {0x00ffef, "Cn"}, {0x00fff9, "Cf"}, {0x00fffc, "So"},
+	{0x00fffe, "Cn"}, {0x010000, "Lo"}, {0x01000c, "Cn"}, {0x01000d, "Lo"}, {0x010027, "Cn"},
+	{0x010028, "Lo"}, {0x01003b, "Cn"}, {0x01003c, "Lo"}, {0x01003e, "Cn"}, {0x01003f, "Lo"},
+	{0x01004e, "Cn"}, {0x010050, "Lo"}, {0x01005e, "Cn"}, {0x010080, "Lo"}, {0x0100fb, "Cn"},
+	{0x010100, "Po"}, {0x010103, "Cn"}, {0x010107, "No"}, {0x010134, "Cn"}, {0x010137, "So"},
+	{0x010140, "Nl"}, {0x010175, "No"}, {0x010179, "So"}, {0x01018a, "No"}, {0x01018c, "So"},
+	{0x01018f, "Cn"}, {0x010190, "So"}, {0x01019d, "Cn"}, {0x0101a0, "So"}, {0x0101a1, "Cn"},
+	{0x0101d0, "So"}, {0x0101fd, "Mn"}, {0x0101fe, "Cn"}, {0x010280, "Lo"}, {0x01029d, "Cn"},
+	{0x0102a0, "Lo"}, {0x0102d1, "Cn"}, {0x0102e0, "Mn"}, {0x0102e1, "No"}, {0x0102fc, "Cn"},
+	{0x010300, "Lo"}, {0x010320, "No"}, {0x010324, "Cn"}, {0x01032d, "Lo"}, {0x010341, "Nl"},
+	{0x010342, "Lo"}, {0x01034a, "Nl"}, {0x01034b, "Cn"}, {0x010350, "Lo"}, {0x010376, "Mn"},
+	{0x01037b, "Cn"}, {0x010380, "Lo"}, {0x01039e, "Cn"}, {0x01039f, "Po"}, {0x0103a0, "Lo"},
+	{0x0103c4, "Cn"}, {0x0103c8, "Lo"}, {0x0103d0, "Po"}, {0x0103d1, "Nl"}, {0x0103d6, "Cn"},
+	{0x010400, "Lu"}, {0x010428, "Ll"}, {0x010450, "Lo"}, {0x01049e, "Cn"}, {0x0104a0, "Nd"},
+	{0x0104aa, "Cn"}, {0x0104b0, "Lu"}, {0x0104d4, "Cn"}, {0x0104d8, "Ll"}, {0x0104fc, "Cn"},
+	{0x010500, "Lo"}, {0x010528, "Cn"}, {0x010530, "Lo"}, {0x010564, "Cn"}, {0x01056f, "Po"},
+	{0x010570, "Lu"}, {0x01057b, "Cn"}, {0x01057c, "Lu"}, {0x01058b, "Cn"}, {0x01058c, "Lu"},
+	{0x010593, "Cn"}, {0x010594, "Lu"}, {0x010596, "Cn"}, {0x010597, "Ll"}, {0x0105a2, "Cn"},
+	{0x0105a3, "Ll"}, {0x0105b2, "Cn"}, {0x0105b3, "Ll"}, {0x0105ba, "Cn"}, {0x0105bb, "Ll"},
+	{0x0105bd, "Cn"}, {0x010600, "Lo"}, {0x010737, "Cn"}, {0x010740, "Lo"}, {0x010756, "Cn"},
+	{0x010760, "Lo"}, {0x010768, "Cn"}, {0x010780, "Lm"}, {0x010786, "Cn"}, {0x010787, "Lm"},
+	{0x0107b1, "Cn"}, {0x0107b2, "Lm"}, {0x0107bb, "Cn"}, {0x010800, "Lo"}, {0x010806, "Cn"},
+	{0x010808, "Lo"}, {0x010809, "Cn"}, {0x01080a, "Lo"}, {0x010836, "Cn"}, {0x010837, "Lo"},
+	{0x010839, "Cn"}, {0x01083c, "Lo"}, {0x01083d, "Cn"}, {0x01083f, "Lo"}, {0x010856, "Cn"},
+	{0x010857, "Po"}, {0x010858, "No"}, {0x010860, "Lo"}, {0x010877, "So"}, {0x010879, "No"},
+	{0x010880, "Lo"}, {0x01089f, "Cn"}, {0x0108a7, "No"}, {0x0108b0, "Cn"}, {0x0108e0, "Lo"},
+	{0x0108f3, "Cn"}, {0x0108f4, "Lo"}, {0x0108f6, "Cn"}, {0x0108fb, "No"}, {0x010900, "Lo"},
+	{0x010916, "No"}, {0x01091c, "Cn"}, {0x01091f, "Po"}, {0x010920, "Lo"}, {0x01093a, "Cn"},
+	{0x01093f, "Po"}, {0x010940, "Cn"}, {0x010980, "Lo"}, {0x0109b8, "Cn"}, {0x0109bc, "No"},
+	{0x0109be, "Lo"}, {0x0109c0, "No"}, {0x0109d0, "Cn"}, {0x0109d2, "No"}, {0x010a00, "Lo"},
+	{0x010a01, "Mn"}, {0x010a04, "Cn"}, {0x010a05, "Mn"}, {0x010a07, "Cn"}, {0x010a0c, "Mn"},
+	{0x010a10, "Lo"}, {0x010a14, "Cn"}, {0x010a15, "Lo"}, {0x010a18, "Cn"}, {0x010a19, "Lo"},
+	{0x010a36, "Cn"}, {0x010a38, "Mn"}, {0x010a3b, "Cn"}, {0x010a3f, "Mn"}, {0x010a40, "No"},
+	{0x010a49, "Cn"}, {0x010a50, "Po"}, {0x010a59, "Cn"}, {0x010a60, "Lo"}, {0x010a7d, "No"},
+	{0x010a7f, "Po"}, {0x010a80, "Lo"}, {0x010a9d, "No"}, {0x010aa0, "Cn"}, {0x010ac0, "Lo"},
+	{0x010ac8, "So"}, {0x010ac9, "Lo"}, {0x010ae5, "Mn"}, {0x010ae7, "Cn"}, {0x010aeb, "No"},
+	{0x010af0, "Po"}, {0x010af7, "Cn"}, {0x010b00, "Lo"}, {0x010b36, "Cn"}, {0x010b39, "Po"},
+	{0x010b40, "Lo"}, {0x010b56, "Cn"}, {0x010b58, "No"}, {0x010b60, "Lo"}, {0x010b73, "Cn"},
+	{0x010b78, "No"}, {0x010b80, "Lo"}, {0x010b92, "Cn"}, {0x010b99, "Po"}, {0x010b9d, "Cn"},
+	{0x010ba9, "No"}, {0x010bb0, "Cn"}, {0x010c00, "Lo"}, {0x010c49, "Cn"}, {0x010c80, "Lu"},
+	{0x010cb3, "Cn"}, {0x010cc0, "Ll"}, {0x010cf3, "Cn"}, {0x010cfa, "No"}, {0x010d00, "Lo"},
+	{0x010d24, "Mn"}, {0x010d28, "Cn"}, {0x010d30, "Nd"}, {0x010d3a, "Cn"}, {0x010e60, "No"},
+	{0x010e7f, "Cn"}, {0x010e80, "Lo"}, {0x010eaa, "Cn"}, {0x010eab, "Mn"}, {0x010ead, "Pd"},
+	{0x010eae, "Cn"}, {0x010eb0, "Lo"}, {0x010eb2, "Cn"}, {0x010f00, "Lo"}, {0x010f1d, "No"},
+	{0x010f27, "Lo"}, {0x010f28, "Cn"}, {0x010f30, "Lo"}, {0x010f46, "Mn"}, {0x010f51, "No"},
+	{0x010f55, "Po"}, {0x010f5a, "Cn"}, {0x010f70, "Lo"}, {0x010f82, "Mn"}, {0x010f86, "Po"},
+	{0x010f8a, "Cn"}, {0x010fb0, "Lo"}, {0x010fc5, "No"}, {0x010fcc, "Cn"}, {0x010fe0, "Lo"},
+	{0x010ff7, "Cn"}, {0x011000, "Mc"}, {0x011001, "Mn"}, {0x011002, "Mc"}, {0x011003, "Lo"},
+	{0x011038, "Mn"}, {0x011047, "Po"}, {0x01104e, "Cn"}, {0x011052, "No"}, {0x011066, "Nd"},
+	{0x011070, "Mn"}, {0x011071, "Lo"}, {0x011073, "Mn"}, {0x011075, "Lo"}, {0x011076, "Cn"},
+	{0x01107f, "Mn"}, {0x011082, "Mc"}, {0x011083, "Lo"}, {0x0110b0, "Mc"}, {0x0110b3, "Mn"},
+	{0x0110b7, "Mc"}, {0x0110b9, "Mn"}, {0x0110bb, "Po"}, {0x0110bd, "Cf"}, {0x0110be, "Po"},
+	{0x0110c2, "Mn"}, {0x0110c3, "Cn"}, {0x0110cd, "Cf"}, {0x0110ce, "Cn"}, {0x0110d0, "Lo"},
+	{0x0110e9, "Cn"}, {0x0110f0, "Nd"}, {0x0110fa, "Cn"}, {0x011100, "Mn"}, {0x011103, "Lo"},
+	{0x011127, "Mn"}, {0x01112c, "Mc"}, {0x01112d, "Mn"}, {0x011135, "Cn"}, {0x011136, "Nd"},
+	{0x011140, "Po"}, {0x011144, "Lo"}, {0x011145, "Mc"}, {0x011147, "Lo"}, {0x011148, "Cn"},
+	{0x011150, "Lo"}, {0x011173, "Mn"}, {0x011174, "Po"}, {0x011176, "Lo"}, {0x011177, "Cn"},
+	{0x011180, "Mn"}, {0x011182, "Mc"}, {0x011183, "Lo"}, {0x0111b3, "Mc"}, {0x0111b6, "Mn"},
+	{0x0111bf, "Mc"}, {0x0111c1, "Lo"}, {0x0111c5, "Po"}, {0x0111c9, "Mn"}, {0x0111cd, "Po"},
+	{0x0111ce, "Mc"}, {0x0111cf, "Mn"}, {0x0111d0, "Nd"}, {0x0111da, "Lo"}, {0x0111db, "Po"},
+	{0x0111dc, "Lo"}, {0x0111dd, "Po"}, {0x0111e0, "Cn"}, {0x0111e1, "No"}, {0x0111f5, "Cn"},
+	{0x011200, "Lo"}, {0x011212, "Cn"}, {0x011213, "Lo"}, {0x01122c, "Mc"}, {0x01122f, "Mn"},
+	{0x011232, "Mc"}, {0x011234, "Mn"}, {0x011235, "Mc"}, {0x011236, "Mn"}, {0x011238, "Po"},
+	{0x01123e, "Mn"}, {0x01123f, "Cn"}, {0x011280, "Lo"}, {0x011287, "Cn"}, {0x011288, "Lo"},
+	{0x011289, "Cn"}, {0x01128a, "Lo"}, {0x01128e, "Cn"}, {0x01128f, "Lo"}, {0x01129e, "Cn"},
+	{0x01129f, "Lo"}, {0x0112a9, "Po"}, {0x0112aa, "Cn"}, {0x0112b0, "Lo"}, {0x0112df, "Mn"},
+	{0x0112e0, "Mc"}, {0x0112e3, "Mn"}, {0x0112eb, "Cn"}, {0x0112f0, "Nd"}, {0x0112fa, "Cn"},
+	{0x011300, "Mn"}, {0x011302, "Mc"}, {0x011304, "Cn"}, {0x011305, "Lo"}, {0x01130d, "Cn"},
+	{0x01130f, "Lo"}, {0x011311, "Cn"}, {0x011313, "Lo"}, {0x011329, "Cn"}, {0x01132a, "Lo"},
+	{0x011331, "Cn"}, {0x011332, "Lo"}, {0x011334, "Cn"}, {0x011335, "Lo"}, {0x01133a, "Cn"},
+	{0x01133b, "Mn"}, {0x01133d, "Lo"}, {0x01133e, "Mc"}, {0x011340, "Mn"}, {0x011341, "Mc"},
+	{0x011345, "Cn"}, {0x011347, "Mc"}, {0x011349, "Cn"}, {0x01134b, "Mc"}, {0x01134e, "Cn"},
+	{0x011350, "Lo"}, {0x011351, "Cn"}, {0x011357, "Mc"}, {0x011358, "Cn"}, {0x01135d, "Lo"},
+	{0x011362, "Mc"}, {0x011364, "Cn"}, {0x011366, "Mn"}, {0x01136d, "Cn"}, {0x011370, "Mn"},
+	{0x011375, "Cn"}, {0x011400, "Lo"}, {0x011435, "Mc"}, {0x011438, "Mn"}, {0x011440, "Mc"},
+	{0x011442, "Mn"}, {0x011445, "Mc"}, {0x011446, "Mn"}, {0x011447, "Lo"}, {0x01144b, "Po"},
+	{0x011450, "Nd"}, {0x01145a, "Po"}, {0x01145c, "Cn"}, {0x01145d, "Po"}, {0x01145e, "Mn"},
+	{0x01145f, "Lo"}, {0x011462, "Cn"}, {0x011480, "Lo"}, {0x0114b0, "Mc"}, {0x0114b3, "Mn"},
+	{0x0114b9, "Mc"}, {0x0114ba, "Mn"}, {0x0114bb, "Mc"}, {0x0114bf, "Mn"}, {0x0114c1, "Mc"},
+	{0x0114c2, "Mn"}, {0x0114c4, "Lo"}, {0x0114c6, "Po"}, {0x0114c7, "Lo"}, {0x0114c8, "Cn"},
+	{0x0114d0, "Nd"}, {0x0114da, "Cn"}, {0x011580, "Lo"}, {0x0115af, "Mc"}, {0x0115b2, "Mn"},
+	{0x0115b6, "Cn"}, {0x0115b8, "Mc"}, {0x0115bc, "Mn"}, {0x0115be, "Mc"}, {0x0115bf, "Mn"},
+	{0x0115c1, "Po"}, {0x0115d8, "Lo"}, {0x0115dc, "Mn"}, {0x0115de, "Cn"}, {0x011600, "Lo"},
+	{0x011630, "Mc"}, {0x011633, "Mn"}, {0x01163b, "Mc"}, {0x01163d, "Mn"}, {0x01163e, "Mc"},
+	{0x01163f, "Mn"}, {0x011641, "Po"}, {0x011644, "Lo"}, {0x011645, "Cn"}, {0x011650, "Nd"},
+	{0x01165a, "Cn"}, {0x011660, "Po"}, {0x01166d, "Cn"}, {0x011680, "Lo"}, {0x0116ab, "Mn"},
+	{0x0116ac, "Mc"}, {0x0116ad, "Mn"}, {0x0116ae, "Mc"}, {0x0116b0, "Mn"}, {0x0116b6, "Mc"},
+	{0x0116b7, "Mn"}, {0x0116b8, "Lo"}, {0x0116b9, "Po"}, {0x0116ba, "Cn"}, {0x0116c0, "Nd"},
+	{0x0116ca, "Cn"}, {0x011700, "Lo"}, {0x01171b, "Cn"}, {0x01171d, "Mn"}, {0x011720, "Mc"},
+	{0x011722, "Mn"}, {0x011726, "Mc"}, {0x011727, "Mn"}, {0x01172c, "Cn"}, {0x011730, "Nd"},
+	{0x01173a, "No"}, {0x01173c, "Po"}, {0x01173f, "So"}, {0x011740, "Lo"}, {0x011747, "Cn"},
+	{0x011800, "Lo"}, {0x01182c, "Mc"}, {0x01182f, "Mn"}, {0x011838, "Mc"}, {0x011839, "Mn"},
+	{0x01183b, "Po"}, {0x01183c, "Cn"}, {0x0118a0, "Lu"}, {0x0118c0, "Ll"}, {0x0118e0, "Nd"},
+	{0x0118ea, "No"}, {0x0118f3, "Cn"}, {0x0118ff, "Lo"}, {0x011907, "Cn"}, {0x011909, "Lo"},
+	{0x01190a, "Cn"}, {0x01190c, "Lo"}, {0x011914, "Cn"}, {0x011915, "Lo"}, {0x011917, "Cn"},
+	{0x011918, "Lo"}, {0x011930, "Mc"}, {0x011936, "Cn"}, {0x011937, "Mc"}, {0x011939, "Cn"},
+	{0x01193b, "Mn"}, {0x01193d, "Mc"}, {0x01193e, "Mn"}, {0x01193f, "Lo"}, {0x011940, "Mc"},
+	{0x011941, "Lo"}, {0x011942, "Mc"}, {0x011943, "Mn"}, {0x011944, "Po"}, {0x011947, "Cn"},
+	{0x011950, "Nd"}, {0x01195a, "Cn"}, {0x0119a0, "Lo"}, {0x0119a8, "Cn"}, {0x0119aa, "Lo"},
+	{0x0119d1, "Mc"}, {0x0119d4, "Mn"}, {0x0119d8, "Cn"}, {0x0119da, "Mn"}, {0x0119dc, "Mc"},
+	{0x0119e0, "Mn"}, {0x0119e1, "Lo"}, {0x0119e2, "Po"}, {0x0119e3, "Lo"}, {0x0119e4, "Mc"},
+	{0x0119e5, "Cn"}, {0x011a00, "Lo"}, {0x011a01, "Mn"}, {0x011a0b, "Lo"}, {0x011a33, "Mn"},
+	{0x011a39, "Mc"}, {0x011a3a, "Lo"}, {0x011a3b, "Mn"}, {0x011a3f, "Po"}, {0x011a47, "Mn"},
+	{0x011a48, "Cn"}, {0x011a50, "Lo"}, {0x011a51, "Mn"}, {0x011a57, "Mc"}, {0x011a59, "Mn"},
+	{0x011a5c, "Lo"}, {0x011a8a, "Mn"}, {0x011a97, "Mc"}, {0x011a98, "Mn"}, {0x011a9a, "Po"},
+	{0x011a9d, "Lo"}, {0x011a9e, "Po"}, {0x011aa3, "Cn"}, {0x011ab0, "Lo"}, {0x011af9, "Cn"},
+	{0x011c00, "Lo"}, {0x011c09, "Cn"}, {0x011c0a, "Lo"}, {0x011c2f, "Mc"}, {0x011c30, "Mn"},
+	{0x011c37, "Cn"}, {0x011c38, "Mn"}, {0x011c3e, "Mc"}, {0x011c3f, "Mn"}, {0x011c40, "Lo"},
+	{0x011c41, "Po"}, {0x011c46, "Cn"}, {0x011c50, "Nd"}, {0x011c5a, "No"}, {0x011c6d, "Cn"},
+	{0x011c70, "Po"}, {0x011c72, "Lo"}, {0x011c90, "Cn"}, {0x011c92, "Mn"}, {0x011ca8, "Cn"},
+	{0x011ca9, "Mc"}, {0x011caa, "Mn"}, {0x011cb1, "Mc"}, {0x011cb2, "Mn"}, {0x011cb4, "Mc"},
+	{0x011cb5, "Mn"}, {0x011cb7, "Cn"}, {0x011d00, "Lo"}, {0x011d07, "Cn"}, {0x011d08, "Lo"},
+	{0x011d0a, "Cn"}, {0x011d0b, "Lo"}, {0x011d31, "Mn"}, {0x011d37, "Cn"}, {0x011d3a, "Mn"},
+	{0x011d3b, "Cn"}, {0x011d3c, "Mn"}, {0x011d3e, "Cn"}, {0x011d3f, "Mn"}, {0x011d46, "Lo"},
+	{0x011d47, "Mn"}, {0x011d48, "Cn"}, {0x011d50, "Nd"}, {0x011d5a, "Cn"}, {0x011d60, "Lo"},
+	{0x011d66, "Cn"}, {0x011d67, "Lo"}, {0x011d69, "Cn"}, {0x011d6a, "Lo"}, {0x011d8a, "Mc"},
+	{0x011d8f, "Cn"}, {0x011d90, "Mn"}, {0x011d92, "Cn"}, {0x011d93, "Mc"}, {0x011d95, "Mn"},
+	{0x011d96, "Mc"}, {0x011d97, "Mn"}, {0x011d98, "Lo"}, {0x011d99, "Cn"}, {0x011da0, "Nd"},
+	{0x011daa, "Cn"}, {0x011ee0, "Lo"}, {0x011ef3, "Mn"}, {0x011ef5, "Mc"}, {0x011ef7, "Po"},
+	{0x011ef9, "Cn"}, {0x011fb0, "Lo"}, {0x011fb1, "Cn"}, {0x011fc0, "No"}, {0x011fd5, "So"},
+	{0x011fdd, "Sc"}, {0x011fe1, "So"}, {0x011ff2, "Cn"}, {0x011fff, "Po"}, {0x012000, "Lo"},
+	{0x01239a, "Cn"}, {0x012400, "Nl"}, {0x01246f, "Cn"}, {0x012470, "Po"}, {0x012475, "Cn"},
+	{0x012480, "Lo"}, {0x012544, "Cn"}, {0x012f90, "Lo"}, {0x012ff1, "Po"}, {0x012ff3, "Cn"},
+	{0x013000, "Lo"}, {0x01342f, "Cn"}, {0x013430, "Cf"}, {0x013439, "Cn"}, {0x014400, "Lo"},
+	{0x014647, "Cn"}, {0x016800, "Lo"}, {0x016a39, "Cn"}, {0x016a40, "Lo"}, {0x016a5f, "Cn"},
+	{0x016a60, "Nd"}, {0x016a6a, "Cn"}, {0x016a6e, "Po"}, {0x016a70, "Lo"}, {0x016abf, "Cn"},
+	{0x016ac0, "Nd"}, {0x016aca, "Cn"}, {0x016ad0, "Lo"}, {0x016aee, "Cn"}, {0x016af0, "Mn"},
+	{0x016af5, "Po"}, {0x016af6, "Cn"}, {0x016b00, "Lo"}, {0x016b30, "Mn"}, {0x016b37, "Po"},
+	{0x016b3c, "So"}, {0x016b40, "Lm"}, {0x016b44, "Po"}, {0x016b45, "So"}, {0x016b46, "Cn"},
+	{0x016b50, "Nd"}, {0x016b5a, "Cn"}, {0x016b5b, "No"}, {0x016b62, "Cn"}, {0x016b63, "Lo"},
+	{0x016b78, "Cn"}, {0x016b7d, "Lo"}, {0x016b90, "Cn"}, {0x016e40, "Lu"}, {0x016e60, "Ll"},
+	{0x016e80, "No"}, {0x016e97, "Po"}, {0x016e9b, "Cn"}, {0x016f00, "Lo"}, {0x016f4b, "Cn"},
+	{0x016f4f, "Mn"}, {0x016f50, "Lo"}, {0x016f51, "Mc"}, {0x016f88, "Cn"}, {0x016f8f, "Mn"},
+	{0x016f93, "Lm"}, {0x016fa0, "Cn"}, {0x016fe0, "Lm"}, {0x016fe2, "Po"}, {0x016fe3, "Lm"},
+	{0x016fe4, "Mn"}, {0x016fe5, "Cn"}, {0x016ff0, "Mc"}, {0x016ff2, "Cn"}, {0x017000, "Lo"},
+	{0x0187f8, "Cn"}, {0x018800, "Lo"}, {0x018cd6, "Cn"}, {0x018d00, "Lo"}, {0x018d09, "Cn"},
+	{0x01aff0, "Lm"}, {0x01aff4, "Cn"}, {0x01aff5, "Lm"}, {0x01affc, "Cn"}, {0x01affd, "Lm"},
+	{0x01afff, "Cn"}, {0x01b000, "Lo"}, {0x01b123, "Cn"}, {0x01b150, "Lo"}, {0x01b153, "Cn"},
+	{0x01b164, "Lo"}, {0x01b168, "Cn"}, {0x01b170, "Lo"}, {0x01b2fc, "Cn"}, {0x01bc00, "Lo"},
+	{0x01bc6b, "Cn"}, {0x01bc70, "Lo"}, {0x01bc7d, "Cn"}, {0x01bc80, "Lo"}, {0x01bc89, "Cn"},
+	{0x01bc90, "Lo"}, {0x01bc9a, "Cn"}, {0x01bc9c, "So"}, {0x01bc9d, "Mn"}, {0x01bc9f, "Po"},
+	{0x01bca0, "Cf"}, {0x01bca4, "Cn"}, {0x01cf00, "Mn"}, {0x01cf2e, "Cn"}, {0x01cf30, "Mn"},
+	{0x01cf47, "Cn"}, {0x01cf50, "So"}, {0x01cfc4, "Cn"}, {0x01d000, "So"}, {0x01d0f6, "Cn"},
+	{0x01d100, "So"}, {0x01d127, "Cn"}, {0x01d129, "So"}, {0x01d165, "Mc"}, {0x01d167, "Mn"},
+	{0x01d16a, "So"}, {0x01d16d, "Mc"}, {0x01d173, "Cf"}, {0x01d17b, "Mn"}, {0x01d183, "So"},
+	{0x01d185, "Mn"}, {0x01d18c, "So"}, {0x01d1aa, "Mn"}, {0x01d1ae, "So"}, {0x01d1eb, "Cn"},
+	{0x01d200, "So"}, {0x01d242, "Mn"}, {0x01d245, "So"}, {0x01d246, "Cn"}, {0x01d2e0, "No"},
+	{0x01d2f4, "Cn"}, {0x01d300, "So"}, {0x01d357, "Cn"}, {0x01d360, "No"}, {0x01d379, "Cn"},
+	{0x01d400, "Lu"}, {0x01d41a, "Ll"}, {0x01d434, "Lu"}, {0x01d44e, "Ll"}, {0x01d455, "Cn"},
+	{0x01d456, "Ll"}, {0x01d468, "Lu"}, {0x01d482, "Ll"}, {0x01d49c, "Lu"}, {0x01d49d, "Cn"},
+	{0x01d49e, "Lu"}, {0x01d4a0, "Cn"}, {0x01d4a2, "Lu"}, {0x01d4a3, "Cn"}, {0x01d4a5, "Lu"},
+	{0x01d4a7, "Cn"}, {0x01d4a9, "Lu"}, {0x01d4ad, "Cn"}, {0x01d4ae, "Lu"}, {0x01d4b6, "Ll"},
+	{0x01d4ba, "Cn"}, {0x01d4bb, "Ll"}, {0x01d4bc, "Cn"}, {0x01d4bd, "Ll"}, {0x01d4c4, "Cn"},
+	{0x01d4c5, "Ll"}, {0x01d4d0, "Lu"}, {0x01d4ea, "Ll"}, {0x01d504, "Lu"}, {0x01d506, "Cn"},
+	{0x01d507, "Lu"}, {0x01d50b, "Cn"}, {0x01d50d, "Lu"}, {0x01d515, "Cn"}, {0x01d516, "Lu"},
+	{0x01d51d, "Cn"}, {0x01d51e, "Ll"}, {0x01d538, "Lu"}, {0x01d53a, "Cn"}, {0x01d53b, "Lu"},
+	{0x01d53f, "Cn"}, {0x01d540, "Lu"}, {0x01d545, "Cn"}, {0x01d546, "Lu"}, {0x01d547, "Cn"},
+	{0x01d54a, "Lu"}, {0x01d551, "Cn"}, {0x01d552, "Ll"}, {0x01d56c, "Lu"}, {0x01d586, "Ll"},
+	{0x01d5a0, "Lu"}, {0x01d5ba, "Ll"}, {0x01d5d4, "Lu"}, {0x01d5ee, "Ll"}, {0x01d608, "Lu"},
+	{0x01d622, "Ll"}, {0x01d63c, "Lu"}, {0x01d656, "Ll"}, {0x01d670, "Lu"}, {0x01d68a, "Ll"},
+	{0x01d6a6, "Cn"}, {0x01d6a8, "Lu"}, {0x01d6c1, "Sm"}, {0x01d6c2, "Ll"}, {0x01d6db, "Sm"},
+	{0x01d6dc, "Ll"}, {0x01d6e2, "Lu"}, {0x01d6fb, "Sm"}, {0x01d6fc, "Ll"}, {0x01d715, "Sm"},
+	{0x01d716, "Ll"}, {0x01d71c, "Lu"}, {0x01d735, "Sm"}, {0x01d736, "Ll"}, {0x01d74f, "Sm"},
+	{0x01d750, "Ll"}, {0x01d756, "Lu"}, {0x01d76f, "Sm"}, {0x01d770, "Ll"}, {0x01d789, "Sm"},
+	{0x01d78a, "Ll"}, {0x01d790, "Lu"}, {0x01d7a9, "Sm"}, {0x01d7aa, "Ll"}, {0x01d7c3, "Sm"},
+	{0x01d7c4, "Ll"}, {0x01d7ca, "Lu"}, {0x01d7cb, "Ll"}, {0x01d7cc, "Cn"}, {0x01d7ce, "Nd"},
+	{0x01d800, "So"}, {0x01da00, "Mn"}, {0x01da37, "So"}, {0x01da3b, "Mn"}, {0x01da6d, "So"},
+	{0x01da75, "Mn"}, {0x01da76, "So"}, {0x01da84, "Mn"}, {0x01da85, "So"}, {0x01da87, "Po"},
+	{0x01da8c, "Cn"}, {0x01da9b, "Mn"}, {0x01daa0, "Cn"}, {0x01daa1, "Mn"}, {0x01dab0, "Cn"},
+	{0x01df00, "Ll"}, {0x01df0a, "Lo"}, {0x01df0b, "Ll"}, {0x01df1f, "Cn"}, {0x01e000, "Mn"},
+	{0x01e007, "Cn"}, {0x01e008, "Mn"}, {0x01e019, "Cn"}, {0x01e01b, "Mn"}, {0x01e022, "Cn"},
+	{0x01e023, "Mn"}, {0x01e025, "Cn"}, {0x01e026, "Mn"}, {0x01e02b, "Cn"}, {0x01e100, "Lo"},
+	{0x01e12d, "Cn"}, {0x01e130, "Mn"}, {0x01e137, "Lm"}, {0x01e13e, "Cn"}, {0x01e140, "Nd"},
+	{0x01e14a, "Cn"}, {0x01e14e, "Lo"}, {0x01e14f, "So"}, {0x01e150, "Cn"}, {0x01e290, "Lo"},
+	{0x01e2ae, "Mn"}, {0x01e2af, "Cn"}, {0x01e2c0, "Lo"}, {0x01e2ec, "Mn"}, {0x01e2f0, "Nd"},
+	{0x01e2fa, "Cn"}, {0x01e2ff, "Sc"}, {0x01e300, "Cn"}, {0x01e7e0, "Lo"}, {0x01e7e7, "Cn"},
+	{0x01e7e8, "Lo"}, {0x01e7ec, "Cn"}, {0x01e7ed, "Lo"}, {0x01e7ef, "Cn"}, {0x01e7f0, "Lo"},
+	{0x01e7ff, "Cn"}, {0x01e800, "Lo"}, {0x01e8c5, "Cn"}, {0x01e8c7, "No"}, {0x01e8d0, "Mn"},
+	{0x01e8d7, "Cn"}, {0x01e900, "Lu"}, {0x01e922, "Ll"}, {0x01e944, "Mn"}, {0x01e94b, "Lm"},
+	{0x01e94c, "Cn"}, {0x01e950, "Nd"}, {0x01e95a, "Cn"}, {0x01e95e, "Po"}, {0x01e960, "Cn"},
+	{0x01ec71, "No"}, {0x01ecac, "So"}, {0x01ecad, "No"}, {0x01ecb0, "Sc"}, {0x01ecb1, "No"},
+	{0x01ecb5, "Cn"}, {0x01ed01, "No"}, {0x01ed2e, "So"}, {0x01ed2f, "No"}, {0x01ed3e, "Cn"},
+	{0x01ee00, "Lo"}, {0x01ee04, "Cn"}, {0x01ee05, "Lo"}, {0x01ee20, "Cn"}, {0x01ee21, "Lo"},
+	{0x01ee23, "Cn"}, {0x01ee24, "Lo"}, {0x01ee25, "Cn"}, {0x01ee27, "Lo"}, {0x01ee28, "Cn"},
+	{0x01ee29, "Lo"}, {0x01ee33, "Cn"}, {0x01ee34, "Lo"}, {0x01ee38, "Cn"}, {0x01ee39, "Lo"},
+	{0x01ee3a, "Cn"}, {0x01ee3b, "Lo"}, {0x01ee3c, "Cn"}, {0x01ee42, "Lo"}, {0x01ee43, "Cn"},
+	{0x01ee47, "Lo"}, {0x01ee48, "Cn"}, {0x01ee49, "Lo"}, {0x01ee4a, "Cn"}, {0x01ee4b, "Lo"},
+	{0x01ee4c, "Cn"}, {0x01ee4d, "Lo"}, {0x01ee50, "Cn"}, {0x01ee51, "Lo"}, {0x01ee53, "Cn"},
+	{0x01ee54, "Lo"}, {0x01ee55, "Cn"}, {0x01ee57, "Lo"}, {0x01ee58, "Cn"}, {0x01ee59, "Lo"},
+	{0x01ee5a, "Cn"}, {0x01ee5b, "Lo"}, {0x01ee5c, "Cn"}, {0x01ee5d, "Lo"}, {0x01ee5e, "Cn"},
+	{0x01ee5f, "Lo"}, {0x01ee60, "Cn"}, {0x01ee61, "Lo"}, {0x01ee63, "Cn"}, {0x01ee64, "Lo"},
+	{0x01ee65, "Cn"}, {0x01ee67, "Lo"}, {0x01ee6b, "Cn"}, {0x01ee6c, "Lo"}, {0x01ee73, "Cn"},
+	{0x01ee74, "Lo"}, {0x01ee78, "Cn"}, {0x01ee79, "Lo"}, {0x01ee7d, "Cn"}, {0x01ee7e, "Lo"},
+	{0x01ee7f, "Cn"}, {0x01ee80, "Lo"}, {0x01ee8a, "Cn"}, {0x01ee8b, "Lo"}, {0x01ee9c, "Cn"},
+	{0x01eea1, "Lo"}, {0x01eea4, "Cn"}, {0x01eea5, "Lo"}, {0x01eeaa, "Cn"}, {0x01eeab, "Lo"},
+	{0x01eebc, "Cn"}, {0x01eef0, "Sm"}, {0x01eef2, "Cn"}, {0x01f000, "So"}, {0x01f02c, "Cn"},
+	{0x01f030, "So"}, {0x01f094, "Cn"}, {0x01f0a0, "So"}, {0x01f0af, "Cn"}, {0x01f0b1, "So"},
+	{0x01f0c0, "Cn"}, {0x01f0c1, "So"}, {0x01f0d0, "Cn"}, {0x01f0d1, "So"}, {0x01f0f6, "Cn"},
+	{0x01f100, "No"}, {0x01f10d, "So"}, {0x01f1ae, "Cn"}, {0x01f1e6, "So"}, {0x01f203, "Cn"},
+	{0x01f210, "So"}, {0x01f23c, "Cn"}, {0x01f240, "So"}, {0x01f249, "Cn"}, {0x01f250, "So"},
+	{0x01f252, "Cn"}, {0x01f260, "So"}, {0x01f266, "Cn"}, {0x01f300, "So"}, {0x01f3fb, "Sk"},
+	{0x01f400, "So"}, {0x01f6d8, "Cn"}, {0x01f6dd, "So"}, {0x01f6ed, "Cn"}, {0x01f6f0, "So"},
+	{0x01f6fd, "Cn"}, {0x01f700, "So"}, {0x01f774, "Cn"}, {0x01f780, "So"}, {0x01f7d9, "Cn"},
+	{0x01f7e0, "So"}, {0x01f7ec, "Cn"}, {0x01f7f0, "So"}, {0x01f7f1, "Cn"}, {0x01f800, "So"},
+	{0x01f80c, "Cn"}, {0x01f810, "So"}, {0x01f848, "Cn"}, {0x01f850, "So"}, {0x01f85a, "Cn"},
+	{0x01f860, "So"}, {0x01f888, "Cn"}, {0x01f890, "So"}, {0x01f8ae, "Cn"}, {0x01f8b0, "So"},
+	{0x01f8b2, "Cn"}, {0x01f900, "So"}, {0x01fa54, "Cn"}, {0x01fa60, "So"}, {0x01fa6e, "Cn"},
+	{0x01fa70, "So"}, {0x01fa75, "Cn"}, {0x01fa78, "So"}, {0x01fa7d, "Cn"}, {0x01fa80, "So"},
+	{0x01fa87, "Cn"}, {0x01fa90, "So"}, {0x01faad, "Cn"}, {0x01fab0, "So"}, {0x01fabb, "Cn"},
+	{0x01fac0, "So"}, {0x01fac6, "Cn"}, {0x01fad0, "So"}, {0x01fada, "Cn"}, {0x01fae0, "So"},
+	{0x01fae8, "Cn"}, {0x01faf0, "So"}, {0x01faf7, "Cn"}, {0x01fb00, "So"}, {0x01fb93, "Cn"},
+	{0x01fb94, "So"}, {0x01fbcb, "Cn"}, {0x01fbf0, "Nd"}, {0x01fbfa, "Cn"}, {0x020000, "Lo"},
+	{0x02a6e0, "Cn"}, {0x02a700, "Lo"}, {0x02b739, "Cn"}, {0x02b740, "Lo"}, {0x02b81e, "Cn"},
+	{0x02b820, "Lo"}, {0x02cea2, "Cn"}, {0x02ceb0, "Lo"}, {0x02ebe1, "Cn"}, {0x02f800, "Lo"},
+	{0x02fa1e, "Cn"}, {0x030000, "Lo"}, {0x03134b, "Cn"}, {0x0e0001, "Cf"}, {0x0e0002, "Cn"},
+	{0x0e0020, "Cf"}, {0x0e0080, "Cn"}, {0x0e0100, "Mn"}, {0x0e01f0, "Cn"}, {0x0f0000, "Co"},
+	{0x0ffffe, "Cn"}, {0x100000, "Co"}, {0x10fffe, "Cn"},
+};
+
+const size_t N_UNICODE_RUNS = sizeof(UNICODE_RUNS) / sizeof(UNICODE_RUNS[0]);
+};
+
+#endif
@@ -0,0 +1,100 @@
+// ----------------------------------------------------------------------------
+// micro-benchmark driver for a generated parser
+//
+// times Parser::parse() over an input file and prints key=value results;
+// built with -DIPG_PROFILE it instead counts calls to the rule named
+// "target" during one parse, and writes all counters to profile_file (for
+// ipg -p) if given
+//
+// normally built and run by bench/run_bench.sh
+//
+//  NOTE: assumes parser saved to "bench_parser.h"
+
+#include <chrono>
+
+#include "bench_parser.h"
+
+using namespace IPG;
+
+int main(int argc, char **argv)
+{
+	if (argc < 2)
+	{
+		eprintln("Usage: ", argv[0], " <filename> [min_seconds] [profile_file]");
+		return 1;
+	}
+	double min_seconds = (argc > 2) ? atof(argv[2]) : 1.0;
+
+	FILE *fp;
+	fp = fopen(argv[1], "rb");
+	if (nullptr == fp)
+	{
+		eprintln("ERROR opening file: ", argv[1]);
+		return 1;
+	}
+	fseek(fp, 0, SEEK_END);
+	size_t file_len = ftell(fp);
+	fseek(fp, 0, SEEK_SET);
+	char *buf = new char[file_len + 1];
+	buf[file_len] = '\0';
+	size_t bytes_read = fread(buf, 1, file_len, fp);
+	fclose(fp);
+	if (bytes_read != file_len)
+	{
+		eprintln("ERROR reading file");
+		return 1;
+	}
+
+#ifdef IPG_PROFILE
+	ASTNode astn(0, 1, 1, "ROOT");
+	Parser p(buf, file_len);
+	if (RET_OK != p.parse(astn))
+	{
+		eprintln("ERROR parsing near line ", p.line_ok(), ", col ", p.col_ok());
+		return 1;
+	}
+	uint64_t attempts = 0;
+	for (uint32_t id = 0; id < Parser::N_RULES; id++)
+	{
+		if (std::string("target") == Parser::rule_name(id)) attempts = p.prof_calls(id);
+	}
+	println("attempts=", attempts);
+	if (argc > 3)
+	{
+		FILE *fp_prof = fopen(argv[3], "wb");
+		if (nullptr == fp_prof)
+		{
+			eprintln("ERROR opening file: ", argv[3]);
+			return 1;
+		}
+		p.write_profile(fp_prof);
+		fclose(fp_prof);
+	}
+#else
+	// best of repeated runs, at least 3 and at least min_seconds in total
+	double best_ns = 0.0;
+	double total_s = 0.0;
+	uint32_t iters = 0;
+	while (iters < 3 || total_s < min_seconds)
+	{
+		auto t0 = std::chrono::steady_clock::now();
+		ASTNode astn(0, 1, 1, "ROOT");
+		Parser p(buf, file_len);
+		int32_t retval = p.parse(astn);
+		auto t1 = std::chrono::steady_clock::now();
+		if (RET_OK != retval)
+		{
+			eprintln("ERROR parsing near line ", p.line_ok(), ", col ", p.col_ok());
+			return 1;
+		}
+		double ns = std::chrono::duration<double, std::nano>(t1 - t0).count();
+		if (0 == iters || ns < best_ns) best_ns = ns;
+		total_s += ns * 1e-9;
+		iters++;
+	}
+	println("bytes=", file_len, " iters=", iters, " ns=", (uint64_t)best_ns);
+#endif
+
+	delete[] buf;
+	return 0;
+}
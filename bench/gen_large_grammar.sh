@@ -0,0 +1,17 @@
+#!/bin/sh
+# ----------------------------------------------------------------------------
+# write a synthetic grammar with N rules (default 10000) to stdout, for
+# timing parser generation on large machine-produced grammars, e.g.:
+#  bench/gen_large_grammar.sh 20000 > big.grammar
+#  time ./ipg.exe big.grammar > big_parser.h
+
+N=${1:-10000}
+awk -v n="$N" 'BEGIN {
+	print "r0 : ws (r1 ws)*;"
+	print "ws discard : [ \\t\\r\\n]*;"
+	for (i = 1; i < n; i++) {
+		nx = (i + 1 < n) ? "r" (i + 1) : "tok"
+		printf "r%d : %s (ws \"op%d\" ws %s)* | \"(\" ws r%d ws \")\" | [a-z_\\u00c0-\\u00ff]+ ([0-9]? \"x\")*;\n", i, nx, i, nx, (i % 7) % (n - 1) + 1
+	}
+	print "tok inline : [0-9]+;"
+}'
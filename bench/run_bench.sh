@@ -0,0 +1,53 @@
+#!/bin/sh
+# ----------------------------------------------------------------------------
+# per-construct micro-benchmarks for generated parser code
+#
+# each grammar in bench/grammars isolates one construct in a rule named
+# "target"; its input is generated from the grammar itself with ipg -g.
+# reports ns per input byte and ns per call of parse_target()
+#
+# usage (from any directory):
+#  bench/run_bench.sh [SIZE] [NAME...]
+#
+#  SIZE  input size per grammar, ipg -g syntax (default 1M)
+#  NAME  grammar names without extension (default: all)
+#
+# environment: CXX (default g++), CXXFLAGS (default -O2), BENCH_SECONDS
+# (minimum timed seconds per grammar, default 1)
+
+set -e
+
+ROOT=$(cd "$(dirname "$0")/.." && pwd)
+BUILD="$ROOT/bench/build"
+CXX=${CXX:-g++}
+CXXFLAGS=${CXXFLAGS:--O2}
+SECONDS_MIN=${BENCH_SECONDS:-1}
+SIZE=${1:-1M}
+[ $# -gt 0 ] && shift
+
+mkdir -p "$BUILD"
+$CXX --std=c++11 -O2 "$ROOT/ipg.cpp" -o "$BUILD/ipg.exe"
+
+if [ $# -eq 0 ]; then
+	set -- $(cd "$ROOT/bench/grammars" && ls *.grammar | sed 's/\.grammar$//')
+fi
+
+printf '%-16s %10s %10s %12s %12s\n' construct bytes ns/byte attempts ns/attempt
+for NAME in "$@"; do
+	GRAMMAR="$ROOT/bench/grammars/$NAME.grammar"
+	DIR="$BUILD/$NAME"
+	mkdir -p "$DIR"
+	"$BUILD/ipg.exe" -g "$SIZE" -s 1 "$GRAMMAR" > "$DIR/input.txt" 2>/dev/null
+	"$BUILD/ipg.exe" "$GRAMMAR" > "$DIR/bench_parser.h" 2>/dev/null
+	$CXX --std=c++11 $CXXFLAGS -I"$ROOT" -I"$DIR" "$ROOT/bench/bench_main.cpp" -o "$DIR/bench.exe"
+	$CXX --std=c++11 $CXXFLAGS -DIPG_PROFILE -I"$ROOT" -I"$DIR" "$ROOT/bench/bench_main.cpp" -o "$DIR/bench_prof.exe"
+	TIMING=$("$DIR/bench.exe" "$DIR/input.txt" "$SECONDS_MIN")
+	COUNTS=$("$DIR/bench_prof.exe" "$DIR/input.txt")
+	echo "$TIMING $COUNTS" | tr ' ' '\n' | awk -F= -v name="$NAME" '
+		{ v[$1] = $2 }
+		END {
+			printf "%-16s %10d %10.2f %12d %12.2f\n", name, v["bytes"],
+				v["ns"] / v["bytes"], v["attempts"],
+				(v["attempts"] > 0) ? v["ns"] / v["attempts"] : 0
+		}'
+done
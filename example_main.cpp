@@ -48,9 +48,10 @@ int main(int argc, char **argv)
 		eprintln("parsed successfully");
 
 		Evaluator e;
+		EvaluationState eval_state;
 		// skip "ROOT" node and assume 1 child node
 		// NOTE: this must be changed if multiple top-level nodes allowed
-		if (e.eval(astn.child(0))) eprintln("evaluated successfully");
+		if (e.eval(astn.child(0), eval_state)) eprintln("evaluated successfully");
 		else eprintln("ERROR evaluating");
 	}
 	delete[] buf;
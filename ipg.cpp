@@ -7,8 +7,6 @@
 //  g++ --std=c++11 ipg.cpp -o ipg.exe && ./ipg.exe ipg.grammar > tmp.cpp
 //  g++ --std=c++11 tmp.cpp -o tmp.exe && ./tmp.exe tmp.grammar
 
-// TODO: vector instead of map for rule list? or otherwise make sure rule order
-//       in generated code matches that of input grammar
 // TODO: use enum instead of strings for comparing names in parser and evaluator
 
 // TODO: track names of last fully- and partially-parsed rules to help with debugging
@@ -16,11 +14,21 @@
 // TODO: should generated class name be user-configurable instead of always "Parser"?
 // TODO: make SCC_DEBUG command-line settable
 
+#include <algorithm>
+#include <bitset>
+#include <cctype>
 #include <cstdio>
+#include <cstdlib>
+#include <cstring>
 #include <map>
+#include <random>
+#include <sstream>
+#include <unordered_map>
 #include <vector>
 
 #include "ASTNode.h"
+#include "CodeWriter.h"
+#include "UnicodeCategories.h"
 
 #define SCC_DEBUG 0
 
@@ -29,241 +37,1087 @@ namespace IPG
 {
 // ----------------------------------------------------------------------------
 // types of elements
-enum class ElemType : uint32_t
+enum class ElemType : uint8_t
 {
-	NAME, ALT, GROUP, STRING, CH_CLASS
+	NAME, ALT, GROUP, STRING, CH_CLASS, UNTIL, CUT
 };
 
 // ----------------------------------------------------------------------------
 // types of quantifiers
-enum class QuantifierType : uint32_t
+enum class QuantifierType : uint8_t
 {
-	ONE, ZERO_ONE, ZERO_PLUS, ONE_PLUS
+	ONE, ZERO_ONE, ZERO_PLUS, ONE_PLUS, COUNT
 };
 
 // ----------------------------------------------------------------------------
-// element
-class Elem
+// lookahead predicates: &elem succeeds where elem matches, !elem where it
+// does not; neither consumes input or builds nodes
+enum class Lookahead : uint8_t
 {
-public:
-	Elem(ElemType type)
+	NONE, AND, NOT
+};
+
+// ----------------------------------------------------------------------------
+// rule modifiers
+enum class RuleMod : uint8_t
+{
+	NONE, DISCARD, INLINE, MERGEUP, OPERATORS, COLLAPSE, LAZY
+};
+
+// ----------------------------------------------------------------------------
+// operator kinds in the table of an 'operators' rule
+enum class OpKind : uint8_t
+{
+	LEFT, RIGHT, PREFIX, POSTFIX
+};
+
+// ----------------------------------------------------------------------------
+const char *quantifier_str(QuantifierType quantifier)
+{
+	switch (quantifier)
 	{
-		m_type = type;
-		m_quantifier = QuantifierType::ONE;
+		case QuantifierType::ZERO_ONE: return "?";
+		case QuantifierType::ZERO_PLUS: return "*";
+		case QuantifierType::ONE_PLUS: return "+";
+		default: return "";
 	}
+}
 
-	Elem(ElemType type, std::string text)
+// ----------------------------------------------------------------------------
+const char *rule_mod_str(RuleMod mod)
+{
+	switch (mod)
 	{
-		m_type = type;
-		m_quantifier = QuantifierType::ONE;
-		m_text.push_back(text);
+		case RuleMod::DISCARD: return "discard";
+		case RuleMod::INLINE: return "inline";
+		case RuleMod::MERGEUP: return "mergeup";
+		case RuleMod::OPERATORS: return "operators";
+		case RuleMod::COLLAPSE: return "collapse";
+		case RuleMod::LAZY: return "lazy";
+		default: return "";
 	}
+}
 
-	std::map<ElemType, std::string> m_elem_strs =
+// ----------------------------------------------------------------------------
+const char *op_kind_str(OpKind kind)
+{
+	switch (kind)
 	{
-		{ ElemType::NAME, "name" },
-		{ ElemType::ALT, "alt" },
-		{ ElemType::GROUP, "group" },
-		{ ElemType::STRING, "string" },
-		{ ElemType::CH_CLASS, "character class" }
-	};
+		case OpKind::LEFT: return "left";
+		case OpKind::RIGHT: return "right";
+		case OpKind::PREFIX: return "prefix";
+		case OpKind::POSTFIX: return "postfix";
+		default: return "";
+	}
+}
+
+// ----------------------------------------------------------------------------
+// profile-based placement of rule functions
+enum class RuleHeat : uint8_t
+{
+	NORMAL, HOT, COLD
+};
+
+// ----------------------------------------------------------------------------
+// rules whose columns of the bottom-up table are filled together: one rule
+// that does not call itself, whose column only depends on earlier groups,
+// or a strongly connected component of the call graph
+struct FillGroup
+{
+	std::vector<uint32_t> rules;
+	bool recursive;
+};
+
+// ----------------------------------------------------------------------------
+// 64-bit FNV-1a hash, continuing from hash
+const uint64_t FNV_OFFSET = 0xcbf29ce484222325ULL;
 
-	std::map<QuantifierType, std::string> m_quantifier_strs =
+uint64_t fnv1a_bytes(const char *data, size_t len, uint64_t hash = FNV_OFFSET)
+{
+	for (size_t i = 0; i < len; i++)
 	{
-		{ QuantifierType::ONE, "" },
-		{ QuantifierType::ZERO_ONE, "?" },
-		{ QuantifierType::ZERO_PLUS, "*" },
-		{ QuantifierType::ONE_PLUS, "+" }
-	};
+		hash ^= (uint8_t)data[i];
+		hash *= 0x100000001b3ULL;
+	}
+	return hash;
+}
 
-	ElemType type() { return m_type; }
-	std::vector<std::string> &text() { return m_text; }
-	QuantifierType &quantifier() { return m_quantifier; }
-	std::vector<Elem> &sub_elems() { return m_sub_elems; }
-	std::map<QuantifierType, std::string> &quantifier_strs()
-	{ return m_quantifier_strs; }
+uint64_t fnv1a(const std::string &str, uint64_t hash = FNV_OFFSET)
+{
+	// include terminator so consecutive strings cannot run together
+	return fnv1a_bytes(str.c_str(), str.size() + 1, hash);
+}
+
+uint64_t fnv1a(uint64_t val, uint64_t hash = FNV_OFFSET)
+{
+	return fnv1a_bytes((const char *)&val, sizeof(val), hash);
+}
 
-	std::string to_string()
+// ----------------------------------------------------------------------------
+// value of a capture (name=elem) of len bytes at text, as generated
+// Parser::capture_value() computes it: its decimal digits, or in %bytes
+// grammars its bytes as a big-endian number; CAPTURE_OVERFLOW if that does
+// not fit (or text holds a non-digit, e.g. skipped input), which no count
+// matches
+const uint64_t CAPTURE_OVERFLOW = ~(uint64_t)0;
+
+uint64_t capture_number(bool bytes, const char *text, size_t len)
+{
+	uint64_t val = 0;
+	for (size_t i = 0; i < len; i++)
 	{
-		std::string str;
-		if (m_sub_elems.size() > 0)
+		if (bytes)
 		{
-			if (ElemType::ALT == m_type) str += " |";
-			else if (ElemType::GROUP == m_type) str += " (";
-			for (auto sub_elem : m_sub_elems)
-			{
-				str += sub_elem.to_string();
-			}
-			if (ElemType::GROUP == m_type) str += " )";
+			if (val >> 56) return CAPTURE_OVERFLOW;
+			val = (val << 8) | (uint8_t)text[i];
+			continue;
+		}
+		uint64_t digit = (uint64_t)(text[i] - '0');
+		if (digit > 9 || val > (CAPTURE_OVERFLOW - 1 - digit) / 10) return CAPTURE_OVERFLOW;
+		val = val * 10 + digit;
+	}
+	return val;
+}
+
+// ----------------------------------------------------------------------------
+// encode code point as utf-8 and append to str
+void append_utf8(std::string &str, int32_t ch)
+{
+	if (ch < 0x80) str += (char)ch;
+	else if (ch < 0x800)
+	{
+		str += (char)(0xc0 | (ch >> 6));
+		str += (char)(0x80 | (ch & 0x3f));
+	}
+	else if (ch < 0x10000)
+	{
+		str += (char)(0xe0 | (ch >> 12));
+		str += (char)(0x80 | ((ch >> 6) & 0x3f));
+		str += (char)(0x80 | (ch & 0x3f));
+	}
+	else
+	{
+		str += (char)(0xf0 | (ch >> 18));
+		str += (char)(0x80 | ((ch >> 12) & 0x3f));
+		str += (char)(0x80 | ((ch >> 6) & 0x3f));
+		str += (char)(0x80 | (ch & 0x3f));
+	}
+}
+
+// ----------------------------------------------------------------------------
+// decode single (possibly escaped) character class token
+int32_t decode_class_char(const std::string &token)
+{
+	if ('\\' != token[0])
+	{
+		int32_t val;
+		return (utf8_to_int32(&val, token.c_str()) > 0) ? val : -1;
+	}
+	switch (token[1])
+	{
+		case 'a': return 0x7;
+		case 'b': return 0x8;
+		case 'f': return 0xc;
+		case 'n': return 0xa;
+		case 'r': return 0xd;
+		case 't': return 0x9;
+		case 'v': return 0xb;
+		case 'x':
+		case 'u':
+		case 'U': return (int32_t)strtol(token.substr(2).c_str(), nullptr, 16);
+	}
+	return (uint8_t)token[1];
+}
+
+// ----------------------------------------------------------------------------
+// append code point ranges of Unicode general category name (e.g. "Nd"), or
+// of all categories of a major class (e.g. "L"), to ranges
+// returns false if name is no category
+bool unicode_ranges(const std::string &name, std::vector<std::pair<int32_t, int32_t>> &ranges)
+{
+	if (name.empty() || name.size() > 2) return false;
+	bool found = false;
+	for (size_t r = 0; r < N_UNICODE_RUNS; r++)
+	{
+		const char *cat = UNICODE_RUNS[r].category;
+		if (name[0] != cat[0] || (2 == name.size() && name[1] != cat[1])) continue;
+		int32_t first = UNICODE_RUNS[r].first;
+		int32_t last = (r + 1 < N_UNICODE_RUNS) ? UNICODE_RUNS[r + 1].first - 1 : 0x10ffff;
+		// runs of one major class, e.g. Lu then Ll, make one range
+		if (!ranges.empty() && found && ranges.back().second + 1 == first) ranges.back().second = last;
+		else ranges.push_back(std::make_pair(first, last));
+		found = true;
+	}
+	return found;
+}
+
+// ----------------------------------------------------------------------------
+// whether character class token is a Unicode property, \p{NAME}
+bool is_property_token(const std::string &token)
+{
+	return 0 == token.compare(0, 3, "\\p{");
+}
+
+// ----------------------------------------------------------------------------
+// strings are stored exactly as written (including quotes) and emitted
+// verbatim into generated C++, so decode them as C++ string literals
+std::string unescape_string(const std::string &literal)
+{
+	std::string str;
+	for (size_t i = 1; i + 1 < literal.size(); i++)
+	{
+		char ch = literal[i];
+		if ('\\' != ch)
+		{
+			str += ch;
+			continue;
 		}
+		ch = literal[++i];
+		if ('a' == ch) str += '\a';
+		else if ('b' == ch) str += '\b';
+		else if ('f' == ch) str += '\f';
+		else if ('n' == ch) str += '\n';
+		else if ('r' == ch) str += '\r';
+		else if ('t' == ch) str += '\t';
+		else if ('v' == ch) str += '\v';
+		else if ('x' == ch || 'u' == ch || 'U' == ch || (ch >= '0' && ch <= '7'))
+		{
+			size_t n_max = ('u' == ch) ? 4 : ('U' == ch) ? 8 : ('x' == ch) ? 2 : 3;
+			int32_t base = ('0' <= ch && ch <= '7') ? 8 : 16;
+			size_t start = (8 == base) ? i : i + 1;
+			size_t n = 0;
+			while (n < n_max && start + n + 1 < literal.size()
+				&& isxdigit((uint8_t)literal[start + n])
+				&& (16 == base || literal[start + n] <= '7')) n++;
+			int32_t val = (int32_t)strtol(literal.substr(start, n).c_str(), nullptr, base);
+			if ('u' == ch || 'U' == ch) append_utf8(str, val);
+			else str += (char)val;
+			i = start + n - 1;
+		}
+		else str += ch;
+	}
+	return str;
+}
+
+// ----------------------------------------------------------------------------
+// C++ string literal for bytes; anything but printable ASCII is written as a
+// 3-digit octal escape, which (unlike \x) cannot run into the next character
+std::string c_literal(const std::string &bytes)
+{
+	std::string lit = "\"";
+	for (char ch : bytes)
+	{
+		uint8_t byte = (uint8_t)ch;
+		if ('"' == ch || '\\' == ch || '?' == ch) lit += std::string("\\") + ch;
+		else if (byte >= 0x20 && byte < 0x7f) lit += ch;
 		else
 		{
-			for (auto item : m_text) str += " " + item;
+			lit += '\\';
+			lit += (char)('0' + (byte >> 6));
+			lit += (char)('0' + ((byte >> 3) & 7));
+			lit += (char)('0' + (byte & 7));
 		}
-		str += m_quantifier_strs[m_quantifier];
-		return str;
 	}
+	return lit + "\"";
+}
 
-private:
-	ElemType m_type;
-	std::vector<std::string> m_text;
-	QuantifierType m_quantifier;
-	std::vector<Elem> m_sub_elems;
+// ----------------------------------------------------------------------------
+// character class as flat lists of code point ranges, decoded the same way
+// ParseGen::print_elem_inner() does
+struct ChClass
+{
+	bool negate_all = false;
+	std::vector<std::pair<int32_t, int32_t>> pos;
+	std::vector<std::pair<int32_t, int32_t>> neg;
+
+	bool matches(int32_t ch)
+	{
+		bool any_pos = false;
+		for (auto &r : pos) any_pos |= (ch >= r.first && ch <= r.second);
+		bool any_neg = false;
+		for (auto &r : neg) any_neg |= (ch >= r.first && ch <= r.second);
+		bool match = any_pos && !any_neg;
+		return negate_all ? !match : match;
+	}
 };
 
 // ----------------------------------------------------------------------------
-// rule
-class Rule
+// interned strings; ids are stable for the life of the pool
+class StrPool
 {
 public:
-	Rule() {}
-
-	Rule(std::string &name) { m_name = name; }
+	uint32_t intern(const std::string &str)
+	{
+		auto it = m_ids.find(str);
+		if (it != m_ids.end()) return it->second;
+		uint32_t id = (uint32_t)m_strs.size();
+		m_strs.push_back(str);
+		m_ids[str] = id;
+		return id;
+	}
 
-	std::string &name() { return m_name; }
-	std::string &mod() { return m_mod; }
-	std::vector<Elem> &elems() { return m_elems; }
+	// returns id or NO_STR if never interned
+	uint32_t find(const std::string &str) const
+	{
+		auto it = m_ids.find(str);
+		return (it == m_ids.end()) ? NO_STR : it->second;
+	}
 
-	void clear() { m_elems.clear(); }
+	const std::string &str(uint32_t id) const { return m_strs[id]; }
 
-	std::string to_string()
+	void clear()
 	{
-		std::string str = m_name + " :";
-		for (auto elem : m_elems)
-		{
-			str += elem.to_string();
-		}
-		return str;
+		m_strs.clear();
+		m_ids.clear();
 	}
 
+	static const uint32_t NO_STR = 0xffffffff;
+
 private:
-	std::string m_name;
-	std::string m_mod;
-	std::vector<Elem> m_elems;
+	std::vector<std::string> m_strs;
+	std::unordered_map<std::string, uint32_t> m_ids;
 };
 
 // ----------------------------------------------------------------------------
-// parent class of a grammar
-class Grammar
+// contiguous slice of an arena vector
+template <typename T>
+class Span
 {
 public:
-	std::map<std::string, Rule> &rules() { return m_rules; };
-	std::string &rule_root() { return m_rule_root; };
+	Span(T *first, uint32_t count) : m_first(first), m_count(count) {}
 
-	void clear() { m_rules.clear(); };
+	T *begin() const { return m_first; }
+	T *end() const { return m_first + m_count; }
+	uint32_t size() const { return m_count; }
+	T &operator[](uint32_t i) const { return m_first[i]; }
 
 private:
-	std::map<std::string, Rule> m_rules;
-	std::string m_rule_root = "";
+	T *m_first;
+	uint32_t m_count;
 };
 
 // ----------------------------------------------------------------------------
-// IPG parser generator
-class ParseGen
+// element
+//
+// compact node stored in the Grammar's element arena; sub-elements and text
+// tokens are index ranges into the Grammar, so copying an Elem is cheap and
+// never copies a subtree
+class Elem
 {
-// private members
+public:
+	Elem(ElemType type) { m_type = type; }
+
+	ElemType type() const { return m_type; }
+	QuantifierType &quantifier() { return m_quantifier; }
+	QuantifierType quantifier() const { return m_quantifier; }
+	Lookahead &lookahead() { return m_lookahead; }
+	Lookahead lookahead() const { return m_lookahead; }
+
+	// referenced rule id for ElemType::NAME, set once grammar is resolved
+	uint32_t &rule() { return m_rule; }
+	uint32_t rule() const { return m_rule; }
+
+	// grammar-wide id for ElemType::ALT, set once grammar is resolved
+	uint32_t &alt_id() { return m_alt_id; }
+
+	uint32_t &sub_first() { return m_sub_first; }
+	uint32_t &sub_count() { return m_sub_count; }
+	uint32_t &tok_first() { return m_tok_first; }
+	uint32_t &tok_count() { return m_tok_count; }
+
+	// string id of the name the element's match is captured as (name=elem),
+	// and of the count of a QuantifierType::COUNT element (elem{n}, a number
+	// or a captured name), or StrPool::NO_STR
+	uint32_t &capture_id() { return m_capture_id; }
+	uint32_t capture_id() const { return m_capture_id; }
+	uint32_t &count_id() { return m_count_id; }
+
+	static const uint32_t NO_RULE = 0xffffffff;
+	static const uint32_t NO_ALT = 0xffffffff;
+
 private:
-	// these chars must be escaped in a character class
-	const char *ch_class_reserve_chars = "!-[\\]^";
-	// valid escape chars
-	const char *esc_chars = "!-[\\]^abfnrtv";
+	ElemType m_type;
+	QuantifierType m_quantifier = QuantifierType::ONE;
+	Lookahead m_lookahead = Lookahead::NONE;
+	uint32_t m_rule = NO_RULE;
+	uint32_t m_alt_id = NO_ALT;
+	uint32_t m_sub_first = 0;
+	uint32_t m_sub_count = 0;
+	uint32_t m_tok_first = 0;
+	uint32_t m_tok_count = 0;
+	uint32_t m_capture_id = StrPool::NO_STR;
+	uint32_t m_count_id = StrPool::NO_STR;
+};
 
-	const char *m_text = nullptr;
+// ----------------------------------------------------------------------------
+// rule
+class Rule
+{
+public:
+	Rule(uint32_t name_id) { m_name_id = name_id; }
+
+	uint32_t name_id() const { return m_name_id; }
+	RuleMod &mod() { return m_mod; }
+	RuleMod mod() const { return m_mod; }
+
+	// top-level alternatives, as a range in the Grammar's element arena
+	uint32_t &alt_first() { return m_alt_first; }
+	uint32_t &alt_count() { return m_alt_count; }
+
+	// precedence levels of an 'operators' rule, lowest first, as a range in
+	// the Grammar's operator level arena
+	uint32_t &op_first() { return m_op_first; }
+	uint32_t &op_count() { return m_op_count; }
+	// rule matched around operators of an 'operators' rule (name string id,
+	// then rule id once grammar is resolved), if any
+	uint32_t &op_skip_name_id() { return m_op_skip_name_id; }
+	uint32_t &op_skip() { return m_op_skip; }
+	// string id of the rule's action code, if any
+	uint32_t &action_id() { return m_action_id; }
+	uint32_t action_id() const { return m_action_id; }
+	// 'token' rule: no %skip rule runs inside it or rules it calls
+	bool &token() { return m_token; }
+	bool token() const { return m_token; }
+
+	static const uint32_t NO_NAME = 0xffffffff;
 
-	uint32_t m_pos = 0;
-	uint32_t m_line = 1;
-	uint32_t m_col = 1;
+private:
+	uint32_t m_name_id;
+	RuleMod m_mod = RuleMod::NONE;
+	uint32_t m_alt_first = 0;
+	uint32_t m_alt_count = 0;
+	uint32_t m_op_first = 0;
+	uint32_t m_op_count = 0;
+	uint32_t m_op_skip_name_id = NO_NAME;
+	uint32_t m_op_skip = Elem::NO_RULE;
+	uint32_t m_action_id = NO_NAME;
+	bool m_token = false;
+};
 
-	Grammar m_grammar;
+// ----------------------------------------------------------------------------
+// precedence level of an 'operators' rule
+//
+// applying one of its operators builds an AST node named after the level;
+// operators are string tokens as written in the grammar
+struct OpLevel
+{
+	uint32_t name_id = 0;
+	OpKind kind = OpKind::LEFT;
+	uint32_t tok_first = 0;
+	uint32_t tok_count = 0;
+};
 
-// public methods
+// ----------------------------------------------------------------------------
+// parent class of a grammar
+//
+// owns every element (arena), text token and rule; rules are identified by
+// id, which is their position in the input grammar, and the first rule is
+// the root
+class Grammar
+{
 public:
-	// ------------------------------------------------------------------------
-	ParseGen() {}
+	std::vector<Rule> &rules() { return m_rules; }
+	Rule &rule(uint32_t id) { return m_rules[id]; }
+	uint32_t rule_root() const { return 0; }
 
-	// ------------------------------------------------------------------------
-	uint32_t col() { return m_col; }
+	// returns rule id or Elem::NO_RULE
+	uint32_t find_rule(const std::string &name) const
+	{
+		auto it = m_rule_ids.find(name);
+		return (it == m_rule_ids.end()) ? Elem::NO_RULE : it->second;
+	}
 
-	// ------------------------------------------------------------------------
-	uint32_t line() { return m_line; }
+	// returns new rule id or Elem::NO_RULE if name already used
+	uint32_t add_rule(const std::string &name)
+	{
+		if (m_rule_ids.find(name) != m_rule_ids.end()) return Elem::NO_RULE;
+		uint32_t id = (uint32_t)m_rules.size();
+		m_rules.push_back(Rule(m_strs.intern(name)));
+		m_rule_ids[name] = id;
+		return id;
+	}
 
-	// ------------------------------------------------------------------------
-	void print_rules_debug()
+	const std::string &name(uint32_t rule_id) const
+	{
+		return m_strs.str(m_rules[rule_id].name_id());
+	}
+	const std::string &name(const Rule &rule) const { return m_strs.str(rule.name_id()); }
+
+	// NOTE: spans are invalidated when elements are added
+	Span<Elem> alts(Rule &rule)
+	{
+		return Span<Elem>(m_elems.data() + rule.alt_first(), rule.alt_count());
+	}
+	Span<Elem> subs(Elem &elem)
+	{
+		return Span<Elem>(m_elems.data() + elem.sub_first(), elem.sub_count());
+	}
+	Span<uint32_t> tok_ids(Elem &elem)
+	{
+		return Span<uint32_t>(m_toks.data() + elem.tok_first(), elem.tok_count());
+	}
+	const std::string &tok(Elem &elem, uint32_t i) const
+	{
+		return m_strs.str(m_toks[elem.tok_first() + i]);
+	}
+	Span<OpLevel> op_levels(Rule &rule)
+	{
+		return Span<OpLevel>(m_op_levels.data() + rule.op_first(), rule.op_count());
+	}
+	const std::string &name(const OpLevel &level) const { return m_strs.str(level.name_id); }
+	const std::string &tok(const OpLevel &level, uint32_t i) const
+	{
+		return m_strs.str(m_toks[level.tok_first + i]);
+	}
+	StrPool &strs() { return m_strs; }
+	const std::string &capture(const Elem &elem) const { return m_strs.str(elem.capture_id()); }
+	const std::string &count(Elem &elem) const { return m_strs.str(elem.count_id()); }
+	const std::string &action(const Rule &rule) const { return m_strs.str(rule.action_id()); }
+
+	// C++ type of action values (from the %value directive), empty if none
+	std::string &value_type() { return m_value_type; }
+	// quote characters and line comment start skipped over when scanning
+	// 'lazy' rules (from the %lazy_quotes and %lazy_comment directives)
+	std::string &lazy_quotes() { return m_lazy_quotes; }
+	std::string &lazy_comment() { return m_lazy_comment; }
+	// bytes indexed ahead of parsing outside strings and comments, and the
+	// character escaping the next in a string, empty for none (from the
+	// %structural and %structural_escape directives, escapes decoded)
+	std::string &structural() { return m_structural; }
+	std::string &structural_escape() { return m_structural_escape; }
+	// whether strings and character classes match raw bytes instead of
+	// UTF-8 characters (from the %bytes directive)
+	bool &bytes() { return m_bytes; }
+	// name of the rule run before each element outside 'token' rules (from
+	// the %skip directive), empty if none
+	std::string &skip() { return m_skip; }
+
+	// append elems to arena as one contiguous range
+	void set_subs(Elem &parent, const std::vector<Elem> &elems)
+	{
+		parent.sub_first() = (uint32_t)m_elems.size();
+		parent.sub_count() = (uint32_t)elems.size();
+		m_elems.insert(m_elems.end(), elems.begin(), elems.end());
+	}
+	void set_alts(Rule &rule, const std::vector<Elem> &elems)
+	{
+		rule.alt_first() = (uint32_t)m_elems.size();
+		rule.alt_count() = (uint32_t)elems.size();
+		m_elems.insert(m_elems.end(), elems.begin(), elems.end());
+	}
+	void set_toks(Elem &elem, const std::vector<std::string> &toks)
+	{
+		elem.tok_first() = (uint32_t)m_toks.size();
+		elem.tok_count() = (uint32_t)toks.size();
+		for (auto &tok : toks) m_toks.push_back(m_strs.intern(tok));
+	}
+	void set_tok(Elem &elem, const std::string &tok)
+	{
+		elem.tok_first() = (uint32_t)m_toks.size();
+		elem.tok_count() = 1;
+		m_toks.push_back(m_strs.intern(tok));
+	}
+
+	// append operator level to rule's table; a rule's levels must be added
+	// one after another
+	void add_op_level(Rule &rule, const std::string &name, OpKind kind,
+		const std::vector<std::string> &toks)
+	{
+		if (0 == rule.op_count()) rule.op_first() = (uint32_t)m_op_levels.size();
+		OpLevel level;
+		level.name_id = m_strs.intern(name);
+		level.kind = kind;
+		level.tok_first = (uint32_t)m_toks.size();
+		level.tok_count = (uint32_t)toks.size();
+		for (auto &tok : toks) m_toks.push_back(m_strs.intern(tok));
+		m_op_levels.push_back(level);
+		rule.op_count()++;
+	}
+
+	// look up rule ids of all named elements
+	// returns false (after reporting each one) if any name is undefined
+	bool resolve()
 	{
-		for (auto rule : m_grammar.rules())
+		bool ok = true;
+		for (auto &elem : m_elems)
+		{
+			if (ElemType::NAME != elem.type()) continue;
+			elem.rule() = find_rule(tok(elem, 0));
+			if (Elem::NO_RULE == elem.rule())
+			{
+				eprintln("ERROR: undefined rule '", tok(elem, 0), "'");
+				ok = false;
+			}
+		}
+		for (auto &rule : m_rules)
 		{
-			eprints(rule.first, ":");
-			for (auto elem : rule.second.elems())
+			if (Rule::NO_NAME == rule.op_skip_name_id()) continue;
+			const std::string &skip_name = m_strs.str(rule.op_skip_name_id());
+			rule.op_skip() = find_rule(skip_name);
+			if (Elem::NO_RULE == rule.op_skip())
 			{
-				print_elem_debug(elem);
+				eprintln("ERROR: undefined rule '", skip_name, "'");
+				ok = false;
 			}
-			eprintln("");
 		}
+
+		// number alternatives rule by rule, pre-order within each rule, so
+		// (rule, index within rule) names an alternative independently of
+		// other rules
+		m_alt_rules.clear();
+		m_rule_alt_first.clear();
+		for (uint32_t r = 0; r < m_rules.size(); r++)
+		{
+			m_rule_alt_first.push_back((uint32_t)m_alt_rules.size());
+			for (auto &alt : alts(m_rules[r])) number_alts(alt, r);
+		}
+		m_rule_alt_first.push_back((uint32_t)m_alt_rules.size());
+		return ok;
 	}
 
-	// ------------------------------------------------------------------------
-	void print_elem_debug(Elem &elem, uint32_t depth = 0)
+	uint32_t n_alts() const { return (uint32_t)m_alt_rules.size(); }
+	uint32_t alt_rule(uint32_t alt_id) const { return m_alt_rules[alt_id]; }
+	uint32_t alt_index(uint32_t alt_id) const
+	{
+		return alt_id - m_rule_alt_first[m_alt_rules[alt_id]];
+	}
+
+	// returns alt id or Elem::NO_ALT
+	uint32_t find_alt(uint32_t rule_id, uint32_t index) const
 	{
-		if (elem.sub_elems().size() > 0)
+		uint32_t alt_id = m_rule_alt_first[rule_id] + index;
+		return (alt_id < m_rule_alt_first[rule_id + 1]) ? alt_id : Elem::NO_ALT;
+	}
+
+	// decode character class element into ranges
+	ChClass ch_class(Elem &elem)
+	{
+		ChClass cc;
+		std::vector<std::string> tokens;
+		for (auto id : tok_ids(elem)) tokens.push_back(m_strs.str(id));
+		size_t idx = 1;
+		if ("^" == tokens[idx])
+		{
+			cc.negate_all = true;
+			idx++;
+		}
+		// loop over all tokens except leading and trailing [ ]
+		while (idx < tokens.size() - 1)
 		{
-			std::string tabs(depth, '\t');
-			if (ElemType::ALT == elem.type()) eprintln("\n", tabs, "|");
-			else if (ElemType::GROUP == elem.type()) eprintln("\n", tabs, "(");
-			eprints(tabs);
-			for (auto sub_elem : elem.sub_elems())
+			bool negate = false;
+			if ("!" == tokens[idx])
+			{
+				negate = true;
+				idx++;
+			}
+			if (is_property_token(tokens[idx]))
 			{
-				print_elem_debug(sub_elem, depth + 1);
+				const std::string &token = tokens[idx++];
+				unicode_ranges(token.substr(3, token.size() - 4), negate ? cc.neg : cc.pos);
+				continue;
+			}
+			int32_t ch1 = decode_class_char(tokens[idx++]);
+			int32_t ch2 = ch1;
+			if ("-" == tokens[idx])
+			{
+				ch2 = decode_class_char(tokens[idx + 1]);
+				idx += 2;
 			}
-			if (ElemType::GROUP == elem.type()) eprintln("\n", tabs, ")");
+			(negate ? cc.neg : cc.pos).push_back(std::make_pair(ch1, ch2));
+		}
+		return cc;
+	}
+
+	// append textual form of element to str
+	void elem_to_string(Elem &elem, std::string &str)
+	{
+		if (Lookahead::AND == elem.lookahead()) str += " &";
+		else if (Lookahead::NOT == elem.lookahead()) str += " !";
+		// a capture name is written right before its element
+		std::string sep = " ";
+		if (StrPool::NO_STR != elem.capture_id())
+		{
+			str += " " + capture(elem) + "=";
+			sep.clear();
+		}
+		if (elem.sub_count() > 0)
+		{
+			if (ElemType::ALT == elem.type()) str += " |";
+			else if (ElemType::GROUP == elem.type()) str += sep + "(";
+			for (auto &sub_elem : subs(elem)) elem_to_string(sub_elem, str);
+			if (ElemType::GROUP == elem.type()) str += " )";
 		}
 		else
 		{
-			for (auto str : elem.text())
+			if (ElemType::UNTIL == elem.type())
+			{
+				str += sep + "until";
+				sep = " ";
+			}
+			for (uint32_t i = 0; i < elem.tok_count(); i++)
 			{
-				eprints(" ", str);
+				str += (0 == i) ? sep : " ";
+				str += tok(elem, i);
 			}
 		}
-		eprints(elem.quantifier_strs()[elem.quantifier()]);
+		str += quantifier_str(elem.quantifier());
+		if (QuantifierType::COUNT == elem.quantifier()) str += "{" + count(elem) + "}";
 	}
 
-	// ------------------------------------------------------------------------
-	// NOTE: does only minimal error-checking since input should be well-formed
-	//       from parsing grammar
-	void print_parser()
+	std::string elem_to_string(Elem &elem)
 	{
-		prints(
-R"foo(#ifndef PARSER_H
-#define PARSER_H
-
-#include <cstdio>
-#include <cstring>
-#include <string>
-#include <vector>
+		std::string str;
+		elem_to_string(elem, str);
+		return str;
+	}
 
-#include "ASTNode.h"
-#include "EvaluationState.h"
+	// append textual form of rule to str
+	void rule_to_string(Rule &rule, std::string &str)
+	{
+		str += name(rule);
+		str += " :";
+		for (auto &elem : alts(rule)) elem_to_string(elem, str);
+		for (auto &level : op_levels(rule))
+		{
+			str += " | ";
+			str += name(level);
+			str += " ";
+			str += op_kind_str(level.kind);
+			for (uint32_t i = 0; i < level.tok_count; i++)
+			{
+				str += " ";
+				str += tok(level, i);
+			}
+		}
+		if (Rule::NO_NAME != rule.op_skip_name_id())
+		{
+			str += " | ";
+			str += m_strs.str(rule.op_skip_name_id());
+			str += " skip";
+		}
+	}
 
-// TODO: replace with enum class
+	std::string rule_to_string(Rule &rule)
+	{
+		std::string str;
+		rule_to_string(rule, str);
+		return str;
+	}
+
+	void clear()
+	{
+		m_alt_rules.clear();
+		m_rule_alt_first.clear();
+		m_rules.clear();
+		m_rule_ids.clear();
+		m_elems.clear();
+		m_op_levels.clear();
+		m_toks.clear();
+		m_strs.clear();
+		m_value_type.clear();
+		m_lazy_quotes = "\"";
+		m_lazy_comment.clear();
+		m_structural.clear();
+		m_structural_escape = "\\";
+		m_bytes = false;
+		m_skip.clear();
+	}
+
+private:
+	std::string m_value_type;
+	std::string m_lazy_quotes = "\"";
+	std::string m_lazy_comment;
+	std::string m_structural;
+	std::string m_structural_escape = "\\";
+	bool m_bytes = false;
+	std::string m_skip;
+	std::vector<Rule> m_rules;
+	std::unordered_map<std::string, uint32_t> m_rule_ids;
+	std::vector<Elem> m_elems;
+	std::vector<OpLevel> m_op_levels;
+	std::vector<uint32_t> m_toks;
+	StrPool m_strs;
+	// rule of each alternative, and first alt id of each rule
+	std::vector<uint32_t> m_alt_rules;
+	std::vector<uint32_t> m_rule_alt_first;
+
+	void number_alts(Elem &elem, uint32_t rule_id)
+	{
+		if (ElemType::ALT == elem.type())
+		{
+			elem.alt_id() = (uint32_t)m_alt_rules.size();
+			m_alt_rules.push_back(rule_id);
+		}
+		for (auto &sub_elem : subs(elem)) number_alts(sub_elem, rule_id);
+	}
+};
+
+// ----------------------------------------------------------------------------
+// IPG parser generator
+class ParseGen
+{
+// private members
+private:
+	// these chars must be escaped in a character class
+	const char *ch_class_reserve_chars = "!-[\\]^";
+	// valid escape chars
+	const char *esc_chars = "!-[\\]^abfnrtv";
+
+	const char *m_text = nullptr;
+
+	uint32_t m_pos = 0;
+	uint32_t m_line = 1;
+	uint32_t m_col = 1;
+
+	Grammar m_grammar;
+
+	// generated code is written here
+	CodeWriter m_out;
+	// reused by elem_str() and rule_str()
+	std::string m_scratch;
+	// print rule functions as out-of-class definitions for split output
+	bool m_out_of_class = false;
+	// treat every rule without modifier (and every 'operators' rule) as
+	// 'collapse'
+	bool m_collapse_all = false;
+	// record ids of collapsed rules in their hoisted child nodes
+	bool m_record_elided = false;
+	// also print typed node structs, filled as rules match
+	bool m_typed = false;
+	// print parser that builds no AST, for grammars whose actions compute
+	// everything needed
+	bool m_no_tree = false;
+	// print parser that only builds nodes of rules subscribed at runtime
+	bool m_subscribe = false;
+	// print parser with reparse(), which keeps the nodes an edit of the
+	// input cannot have changed
+	bool m_incremental = false;
+	// print parser whose parse() first fills a table of every rule's match
+	// at every position, bottom-up (see print_fill())
+	bool m_bottom_up = false;
+	// printing a fill_*() function or predicate of a -b parser: rule calls
+	// read the table
+	bool m_fill = false;
+	// per rule id, whether it calls itself where its match starts, and the
+	// groups of rules the table is filled by, in order; filled by
+	// order_fill()
+	std::vector<bool> m_left_rec;
+	std::vector<FillGroup> m_fill_groups;
+	// repetitions (* and +) are numbered from m_rep_base[rule_id] within
+	// each rule, in the order they are printed, m_n_reps in all; while
+	// m_rep_cache is set, fill_*() keeps where their loops end (see
+	// print_fill())
+	std::vector<uint32_t> m_rep_base;
+	uint32_t m_n_reps = 0;
+	uint32_t m_next_rep = 0;
+	bool m_rep_cache = false;
+	// printing code of a lookahead predicate or check_*() function: calls
+	// check_*() functions and updates no tree, values, profile counters or
+	// farthest position
+	bool m_recognizer = false;
+	// per rule id, whether it gets a check_*() function (it can be called
+	// from a predicate); filled by check_rules()
+	std::vector<bool> m_checked;
+	// %skip rule (or Elem::NO_RULE) and, per rule id, whether it is lexical,
+	// i.e. a 'token' rule, the skip rule or called from one, where skip()
+	// is not run; filled by check_rules()
+	uint32_t m_skip_rule = Elem::NO_RULE;
+	std::vector<bool> m_lexical;
+	// printing a rule that runs skip() before each element
+	bool m_skipping = false;
+	// printing a rule whose node, with any text leaves in it, is dropped
+	bool m_drops_text = false;
+
+	// counters from load_profile(), indexed by rule id or alt id
+	bool m_have_profile = false;
+	std::vector<uint64_t> m_prof_calls;
+	std::vector<uint64_t> m_prof_ok;
+	std::vector<uint64_t> m_prof_alt_calls;
+	std::vector<uint64_t> m_prof_alt_ok;
+	std::vector<RuleHeat> m_rule_heat;
+
+	// bytes a match of each rule can start with, and whether it can match
+	// the empty string; filled by analyze_first()
+	std::vector<std::bitset<256>> m_rule_first;
+	std::vector<bool> m_rule_nullable;
+
+// public methods
+public:
+	// ------------------------------------------------------------------------
+	ParseGen() {}
+
+	// ------------------------------------------------------------------------
+	uint32_t col() { return m_col; }
+
+	// ------------------------------------------------------------------------
+	uint32_t line() { return m_line; }
+
+	// ------------------------------------------------------------------------
+	Grammar &grammar() { return m_grammar; }
+
+	// ------------------------------------------------------------------------
+	CodeWriter &out() { return m_out; }
+
+	// ------------------------------------------------------------------------
+	bool &collapse_all() { return m_collapse_all; }
+
+	// ------------------------------------------------------------------------
+	bool &record_elided() { return m_record_elided; }
+
+	// ------------------------------------------------------------------------
+	bool &typed() { return m_typed; }
+
+	// ------------------------------------------------------------------------
+	bool &no_tree() { return m_no_tree; }
+
+	// ------------------------------------------------------------------------
+	bool &subscribe() { return m_subscribe; }
+
+	// ------------------------------------------------------------------------
+	bool &incremental() { return m_incremental; }
+
+	// ------------------------------------------------------------------------
+	bool &bottom_up() { return m_bottom_up; }
+
+	// ------------------------------------------------------------------------
+	// per rule id, whether no skip rule runs in it; filled by check_rules()
+	const std::vector<bool> &lexical() { return m_lexical; }
+
+	// ------------------------------------------------------------------------
+	// textual forms of elements and rules for comments in generated code,
+	// valid until the next call to either
+	const std::string &elem_str(Elem &elem)
+	{
+		m_scratch.clear();
+		m_grammar.elem_to_string(elem, m_scratch);
+		return m_scratch;
+	}
+
+	const std::string &rule_str(Rule &rule)
+	{
+		m_scratch.clear();
+		m_grammar.rule_to_string(rule, m_scratch);
+		return m_scratch;
+	}
+
+	// ------------------------------------------------------------------------
+	void print_rules_debug()
+	{
+		CodeWriter w;
+		w.open(stderr);
+		for (auto &rule : m_grammar.rules())
+		{
+			w.prints(m_grammar.name(rule), ":");
+			for (auto &elem : m_grammar.alts(rule))
+			{
+				print_elem_debug(w, elem);
+			}
+			w.println("");
+		}
+	}
+
+	// ------------------------------------------------------------------------
+	void print_elem_debug(CodeWriter &w, Elem &elem, uint32_t depth = 0)
+	{
+		if (Lookahead::AND == elem.lookahead()) w.prints(" &");
+		else if (Lookahead::NOT == elem.lookahead()) w.prints(" !");
+		if (StrPool::NO_STR != elem.capture_id()) w.prints(" ", m_grammar.capture(elem), "=");
+		if (elem.sub_count() > 0)
+		{
+			CodeWriter::Indent tabs(depth);
+			if (ElemType::ALT == elem.type()) w.println("\n", tabs, "|");
+			else if (ElemType::GROUP == elem.type()) w.println("\n", tabs, "(");
+			w.prints(tabs);
+			for (auto &sub_elem : m_grammar.subs(elem))
+			{
+				print_elem_debug(w, sub_elem, depth + 1);
+			}
+			if (ElemType::GROUP == elem.type()) w.println("\n", tabs, ")");
+		}
+		else
+		{
+			if (ElemType::UNTIL == elem.type()) w.prints(" until");
+			for (uint32_t i = 0; i < elem.tok_count(); i++)
+			{
+				w.prints(" ", m_grammar.tok(elem, i));
+			}
+		}
+		w.prints(quantifier_str(elem.quantifier()));
+		if (QuantifierType::COUNT == elem.quantifier()) w.prints("{", m_grammar.count(elem), "}");
+	}
+
+	// ------------------------------------------------------------------------
+	// NOTE: does only minimal error-checking since input should be well-formed
+	//       from parsing grammar
+	// with decls_only set, rule functions are only declared and must be
+	// defined by print_unit()
+	void print_parser(bool decls_only = false)
+	{
+		m_out.prints(
+R"foo(#ifndef PARSER_H
+#define PARSER_H
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+)foo");
+		if (m_bottom_up) m_out.println("#include <thread>");
+		m_out.prints(
+R"foo(#include <vector>
+
+#include "ASTNode.h"
+#include "EvaluationState.h"
+#include "Input.h"
+)foo");
+		if (indexed()) m_out.println("#include \"StructuralIndex.h\"");
+		if (m_typed) m_out.println("#include \"TypedAST.h\"");
+		m_out.prints(
+R"foo(
+// TODO: replace with enum class
 #define RET_FAIL 0
 #define RET_OK 1
 #define RET_INLINE 2
 
 namespace IPG
 {
-class Parser
+)foo");
+		if (m_typed)
+		{
+			print_typed_structs();
+			m_out.println("");
+		}
+		m_out.prints(
+R"foo(// parser reading its text through Input (see Input.h); Parser reads one
+// contiguous buffer
+template<typename Input>
+class ParserT
 {
 private:
-	const char *m_text = nullptr;
+	Input m_in;
 	uint32_t m_pos = 0;
 	uint32_t m_line = 1;
 	uint32_t m_col = 1;
 	uint32_t m_pos_ok = 0;
 	uint32_t m_line_ok = 1;
 	uint32_t m_col_ok = 1;
-
+	size_t m_len = 0;
+)foo");
+		if (any_cut())
+		{
+			m_out.println("\t// set when a choice fails after one of its alternates passed a cut (~),");
+			m_out.println("\t// until a choice of several alternates or the rule takes the failure");
+			m_out.println("\tbool m_cut_failed = false;");
+		}
+		m_out.prints(
+R"foo(
 public:
-	Parser(const char *text) { m_text = text; }
-	size_t len() { return strlen(m_text); }
+	ParserT(const char *text) : m_in(text, strlen(text)) { m_len = m_in.len(); }
+	// text of len bytes, which may include '\0' bytes (for %bytes grammars);
+	// text[len] must still be '\0'
+	ParserT(const char *text, size_t len) : m_in(text, len) { m_len = len; }
+	// input held some other way, e.g. a ChunkInput over the pieces of a rope
+	ParserT(const Input &in) : m_in(in) { m_len = m_in.len(); }
+	size_t len() { return m_len; }
 	uint32_t col() { return m_col; }
 	uint32_t line() { return m_line; }
 	uint32_t pos() { return m_pos; }
@@ -271,1536 +1125,7516 @@ public:
 	uint32_t line_ok() { return m_line_ok; }
 	uint32_t pos_ok() { return m_pos_ok; }
 )foo");
-		println("\tint32_t parse(ASTNode &root_node)");
-		println("\t{");
-		println("\t\tint32_t retval = parse_", m_grammar.rule_root(), "(root_node);");
-		println("\t\tif (RET_OK != retval || pos() < len()) return RET_FAIL;");
-		println("\t\treturn RET_OK;");
-		println("\t}");
-		println("");
-		prints("private:");
-
-		for (auto rule : m_grammar.rules()) print_rule(rule.second);
-
-		prints(
+		if (has_values())
+		{
+			m_out.println("\ttypedef ", m_grammar.value_type(), " Value;");
+			m_out.println("\t// values of top-level actions, in input order");
+			m_out.println("\tstd::vector<Value> &values() { return m_vals; }");
+			m_out.println("");
+		}
+		if (m_typed) print_typed_api();
+		m_out.println("\tint32_t parse(ASTNode &root_node)");
+		m_out.println("\t{");
+		if (has_values()) m_out.println("\t\tm_vals.clear();");
+		if (m_typed)
+		{
+			m_out.println("\t\tm_typed.clear();");
+			m_out.println("\t\tm_arena.clear();");
+		}
+		if (indexed()) m_out.println("\t\tstructural_index();");
+		if (m_bottom_up) m_out.println("\t\tfill();");
+		if (Elem::NO_RULE != m_skip_rule) m_out.println("\t\tm_skip_from = m_skip_to = 0xffffffff;");
+		if (m_incremental) m_out.println("\t\tm_reach = 0;");
+		m_out.println("\t\tint32_t retval = parse_", m_grammar.name(m_grammar.rule_root()), "(root_node);");
+		// trailing input the skip rule matches is not left over
+		if (Elem::NO_RULE != m_skip_rule) m_out.println("\t\tif (RET_OK == retval) skip();");
+		m_out.println("\t\tif (RET_OK != retval || pos() < len()) return RET_FAIL;");
+		m_out.println("\t\treturn RET_OK;");
+		m_out.println("\t}");
+		m_out.println("");
+		print_rule_names();
+		m_out.println("");
+		if (m_subscribe) print_subscription();
+		if (has_lazy()) print_lazy_api();
+		if (m_incremental) print_reparse_api();
+		if (m_bottom_up) print_fill_api();
+		if (indexed()) print_structural_api();
+		print_profile_counters();
+		m_out.println("");
+		m_out.prints("private:");
+		if (has_values()) m_out.prints("\n\tstd::vector<Value> m_vals;\n");
+		if (m_typed) print_typed_fill();
+		if (m_subscribe)
+		{
+			m_out.prints(
+R"foo(
+	// per rule id, whether its nodes are built
+	std::vector<uint8_t> m_subscribed = std::vector<uint8_t>(N_RULES, 1);
+	// whether text matched now is kept, i.e. the innermost rule building a
+	// node is subscribed
+	bool m_keep_text = true;
+)foo");
+		}
+		print_op_helpers();
+		if (has_lazy()) print_lazy_scan();
+		if (has_captures()) print_capture_value();
+		print_uclasses();
+		if (Elem::NO_RULE != m_skip_rule) print_skip();
+		if (m_incremental) print_reuse();
+		if (indexed()) print_structural();
+		if (m_bottom_up) print_fill();
+
+		if (decls_only)
+		{
+			m_out.println("");
+			for (uint32_t rule_id = 0; rule_id < m_grammar.rules().size(); rule_id++)
+			{
+				Rule &rule = m_grammar.rule(rule_id);
+				const std::string &name = m_grammar.name(rule);
+				m_out.println("\tint32_t parse_", name, "(ASTNode &node);");
+				if (m_checked[rule_id]) m_out.println("\tint32_t check_", name, "(ASTNode &node);");
+				if (m_bottom_up)
+				{
+					if (m_left_rec[rule_id]) m_out.println("\tint32_t grow_", name, "(ASTNode &node);");
+					m_out.println("\tvoid fill_", name, "(uint32_t pos);");
+				}
+				if (RuleMod::OPERATORS == rule.mod())
+				{
+					m_out.println("\tbool operand_", name, "(ASTNode &astn0);");
+					m_out.println("\tbool climb_", name, "(ASTNode &node, uint32_t min_level);");
+				}
+			}
+		}
+		else
+		{
+			for (auto rule_id : layout_order())
+			{
+				print_rule(rule_id);
+				if (m_checked[rule_id]) print_check_rule(rule_id);
+			}
+			if (m_bottom_up)
+			{
+				for (auto rule_id : layout_order()) print_fill_rule(rule_id);
+			}
+		}
+
+		m_out.prints(
 R"foo(
 };
 
+typedef ParserT<TextInput> Parser;
+typedef ParserT<ChunkInput> ChunkParser;
+
 class Evaluator
 {
 public:
 )foo");
-		println("\tvirtual bool eval(ASTNode &root_node, EvaluationState &eval_state)");
-		println("\t{");
-		println("\t\tbool retval = eval_", m_grammar.rule_root(), "(root_node, eval_state);");
-		println("\t\treturn retval;");
-		println("\t}");
-		println("");
-		prints("protected:");
+		m_out.println("\tvirtual bool eval(ASTNode &root_node, EvaluationState &eval_state)");
+		m_out.println("\t{");
+		Rule &root = m_grammar.rule(m_grammar.rule_root());
+		if (collapses(root)) m_out.println("\t\tbool retval = eval_node(root_node, eval_state);");
+		else if (has_eval(root)) m_out.println("\t\tbool retval = eval_", m_grammar.name(root), "(root_node, eval_state);");
+		// a root without an eval_*() (e.g. with an action, whose values are
+		// in Parser::values()) leaves nothing to evaluate
+		else
+		{
+			m_out.println("\t\t(void)root_node;");
+			m_out.println("\t\t(void)eval_state;");
+			m_out.println("\t\tbool retval = true;");
+		}
+		m_out.println("\t\treturn retval;");
+		m_out.println("\t}");
+		m_out.println("");
+		m_out.prints("protected:");
 
-		for (auto rule : m_grammar.rules())
+		if (decls_only) m_out.println("");
+		for (auto &rule : m_grammar.rules())
 		{
-			// only print_eval() if rule has none of these mods and it contains
-			// at least one NAME type element or sub-element
-			if (rule.second.mod() != "discard"
-				&& rule.second.mod() != "inline"
-				&& rule.second.mod() != "mergeup"
-				&& rule_has_named_elem(rule.second)) 
+			if (!has_eval(rule)) continue;
+			if (decls_only)
 			{
-				print_eval(rule.second);
+				m_out.println("\tvirtual bool eval_", m_grammar.name(rule), "(ASTNode &node, EvaluationState &eval_state);");
 			}
+			else print_eval(rule);
 		}
+		print_eval_dispatch();
+		m_out.prints("\n};\n");
 
-		prints(
+		m_out.prints(
 R"foo(
-};
-
 };
 #endif
 )foo");
 	}
 
 	// ------------------------------------------------------------------------
-	void print_eval(Rule &rule)
+	// print one implementation unit of split output: definitions of the
+	// parse_*() and eval_*() functions of the given rules
+	void print_unit(const std::string &header_name, const std::vector<uint32_t> &rule_ids)
 	{
-		println("");
-		println("\t// ***RULE*** ", rule.to_string());
-		println("\tvirtual bool eval_", rule.name(), "(ASTNode &node, EvaluationState &eval_state)");
-		println("\t{");
-		println("\t\tbool result = false;");
-		println("\t\tint c = 0;");
-		println("\t\tint c_prev = 0;");
-// TODO: fix this KLUDGE that handles empty elements with all children having quantifiers * or ?
-println("\t\tif (0 == node.children().size()) return true;");
-		println("\t\tfor (;;)");
-		println("\t\t{");
-		for (auto elem : rule.elems()) print_eval_elem(elem, 3);
-		println("\t\t\tbreak;");
-		println("\t\t}");
-// TODO: re-enable this check when other bugs fixed?
-		//~ println("\t\tfprintf(stderr, \"%d %d\\n\", c, node.children().size());");
-		//~ println("\t\tif (c < node.children().size()) return false;");
-		println("\t\treturn result;");
-		println("\t}");
-	}
+		m_out.println("#include \"", header_name, "\"");
+		m_out.println("");
+		m_out.println("namespace IPG");
+		m_out.prints("{");
+		m_out_of_class = true;
+		m_out.indent_base() = -1;
+		for (auto rule_id : rule_ids)
+		{
+			print_rule(rule_id);
+			if (m_checked[rule_id]) print_check_rule(rule_id);
+		}
+		if (m_bottom_up)
+		{
+			for (auto rule_id : rule_ids) print_fill_rule(rule_id);
+		}
+		for (auto rule_id : rule_ids)
+		{
+			Rule &rule = m_grammar.rule(rule_id);
+			if (has_eval(rule)) print_eval(rule);
+		}
+		m_out.indent_base() = 0;
+		m_out_of_class = false;
 
-	// ------------------------------------------------------------------------
-	// check if rule contains at least one named element
-	bool rule_has_named_elem(Rule &rule)
-	{
-		bool has_named_elem = false;
-		for (auto elem : rule.elems())
+		// the parser functions are templates defined only here, so they are
+		// instantiated for the inputs in Input.h
+		for (auto input : {"TextInput", "ChunkInput"})
 		{
-			has_named_elem |= elem_or_sub_has_name(elem);
+			m_out.println("");
+			for (auto rule_id : rule_ids)
+			{
+				Rule &rule = m_grammar.rule(rule_id);
+				const std::string &name = m_grammar.name(rule);
+				m_out.println("template int32_t ParserT<", input, ">::parse_", name, "(ASTNode &node);");
+				if (m_checked[rule_id]) m_out.println("template int32_t ParserT<", input, ">::check_", name, "(ASTNode &node);");
+				if (m_bottom_up)
+				{
+					if (m_left_rec[rule_id]) m_out.println("template int32_t ParserT<", input, ">::grow_", name, "(ASTNode &node);");
+					m_out.println("template void ParserT<", input, ">::fill_", name, "(uint32_t pos);");
+				}
+				if (RuleMod::OPERATORS == rule.mod())
+				{
+					m_out.println("template bool ParserT<", input, ">::operand_", name, "(ASTNode &astn0);");
+					m_out.println("template bool ParserT<", input, ">::climb_", name, "(ASTNode &node, uint32_t min_level);");
+				}
+			}
 		}
-		return has_named_elem;
+		m_out.println("};");
 	}
 
 	// ------------------------------------------------------------------------
-	// check if element or any of its child elements contain at least one node
-	// with ElemType::NAME
-	bool elem_or_sub_has_name(Elem &elem)
+	// assign rules to n_units implementation units
+	//
+	// rules are taken in depth-first call order from the root so callers and
+	// callees tend to share a unit, then cut into runs of about equal
+	// generated code size; rules within a unit are in grammar order
+	//
+	// if prev_units is not empty, rules named in it keep their unit (so an
+	// edit does not move rules between units) and new rules join the unit of
+	// the rule before them in call order
+	std::vector<std::vector<uint32_t>> partition_rules(uint32_t n_units,
+		const std::unordered_map<std::string, uint32_t> &prev_units)
 	{
-		if (elem.type() == ElemType::NAME
-			|| elem.type() == ElemType::STRING
-			|| elem.type() == ElemType::CH_CLASS) return true;
-		else if (elem.type() == ElemType::ALT
-			|| elem.type() == ElemType::GROUP)
+		uint32_t n_rules = m_grammar.rules().size();
+		std::vector<uint32_t> order = layout_order();
+		std::vector<uint32_t> position(n_rules, 0);
+		for (uint32_t i = 0; i < order.size(); i++) position[order[i]] = i;
+
+		std::vector<uint64_t> sizes(n_rules, 0);
+		uint64_t total = 0;
+		for (auto rule_id : order)
 		{
-			for (auto sub_elem : elem.sub_elems())
+			for (auto &elem : m_grammar.alts(m_grammar.rule(rule_id)))
 			{
-				if (elem_or_sub_has_name(sub_elem)) return true;
+				sizes[rule_id] += elem_size(elem);
 			}
+			total += sizes[rule_id];
 		}
-		return false;
+
+		std::vector<std::vector<uint32_t>> units(n_units);
+		uint64_t done = 0;
+		uint32_t u = 0;
+		for (auto rule_id : order)
+		{
+			if (!prev_units.empty())
+			{
+				auto iter = prev_units.find(m_grammar.name(rule_id));
+				if (prev_units.end() != iter && iter->second < n_units) u = iter->second;
+			}
+			// move on once this unit holds its share of the total
+			else if (u + 1 < n_units && !units[u].empty()
+				&& (done + sizes[rule_id] / 2) * n_units > total * (u + 1))
+			{
+				u++;
+			}
+			units[u].push_back(rule_id);
+			done += sizes[rule_id];
+		}
+		for (auto &unit : units)
+		{
+			std::sort(unit.begin(), unit.end(),
+				[&](uint32_t a, uint32_t b) { return position[a] < position[b]; });
+		}
+		return units;
 	}
 
 	// ------------------------------------------------------------------------
-	void print_eval_elem(Elem &elem, int depth)
+	// order in which parse_*() functions are emitted
+	//
+	// depth-first call order from the root, so callers and callees are close
+	// together in the binary; with a profile, callees that match most often
+	// are visited first (a match runs through a rule's whole function, a
+	// failed call usually only its start) and rules never called are moved
+	// to the end
+	std::vector<uint32_t> layout_order()
 	{
-		std::string tabs(depth, '\t');
-
-		if (elem.type() == ElemType::NAME
-			|| elem.type() == ElemType::STRING
-			|| elem.type() == ElemType::CH_CLASS)
+		uint32_t n_rules = m_grammar.rules().size();
+		std::vector<uint32_t> order;
+		std::vector<uint32_t> cold;
+		std::vector<bool> visited(n_rules, false);
+		// the skip rule is only called by skip(), so it goes last
+		std::vector<uint32_t> to_visit;
+		if (Elem::NO_RULE != m_skip_rule) to_visit.push_back(m_skip_rule);
+		to_visit.push_back(m_grammar.rule_root());
+		std::vector<uint32_t> callees;
+		while (!to_visit.empty())
 		{
-			std::string name = elem.text()[0];
-			Rule &rule = m_grammar.rules()[name];
-			// only need to print_eval() if rule contains NAME type elements or
-			// sub-elements
-			if (rule_has_named_elem(rule))
+			uint32_t rule_id = to_visit.back();
+			to_visit.pop_back();
+			if (visited[rule_id]) continue;
+			visited[rule_id] = true;
+			if (RuleHeat::COLD == m_rule_heat[rule_id]) cold.push_back(rule_id);
+			else order.push_back(rule_id);
+			callees.clear();
+			rule_callees(rule_id, callees);
+			if (m_have_profile)
 			{
-				if (rule.mod() == "") 
-				{
-println(tabs, "// \"", rule.name(), "\" has QUANTIFIER = ", (uint32_t)elem.quantifier());
-					if (QuantifierType::ONE == elem.quantifier())
-					{
-						println(tabs, "if (c >= node.children().size())");
-						println(tabs, "{");
-						println(tabs, "\tresult = false;");
-						println(tabs, "\tbreak;");
-						println(tabs, "}");
-						println(tabs, "if (node.children()[c].text() == \"", name, "\")");
-						println(tabs, "{");
-						println(tabs, "\tresult = eval_", name, "(node.children()[c], eval_state);");
-						println(tabs, "\tif (!result) break;");
-						println(tabs, "\tc++;");
-						println(tabs, "}");
-					}
-					else if (QuantifierType::ZERO_ONE == elem.quantifier())
-					{
-						println(tabs, "if (c < node.children().size() && node.children()[c].text() == \"", name, "\")");
-						println(tabs, "{");
-						println(tabs, "\tresult = eval_", name, "(node.children()[c], eval_state);");
-						println(tabs, "\tif (result) c++;");
-						//~ println(tabs, "\tresult = true;");
-						println(tabs, "}");
-					}
-					else if (QuantifierType::ZERO_PLUS == elem.quantifier())
-					{
-						println(tabs, "while (c < node.children().size() && node.children()[c].text() == \"", name, "\" && c < node.children().size())");
-						println(tabs, "{");
-						println(tabs, "\tresult = eval_", name, "(node.children()[c], eval_state);");
-						println(tabs, "\tif (!result) break;");
-						println(tabs, "\tc++;");
-						println(tabs, "}");
-						//~ println(tabs, "result = true;");
-					}
-					else if (QuantifierType::ONE_PLUS == elem.quantifier())
-					{
-						println(tabs, "c_prev = c;");
-						//~ println(tabs, "result = false;");
-						println(tabs, "while (c < node.children().size() && node.children()[c].text() == \"", name, "\" && c < node.children().size())");
-						println(tabs, "{");
-						println(tabs, "\tresult = eval_", name, "(node.children()[c], eval_state);");
-						println(tabs, "\tif (!result) break;");
-						println(tabs, "\tc++;");
-						println(tabs, "}");
-						println(tabs, "if (c_prev == c) break;");
-						println(tabs, "result = true;");
-					}
-					else
-					{
-						eprintln("FATAL ERROR: unsupported quantifier type '",
-							std::to_string((uint32_t)elem.quantifier()), "'");
-						exit(1);
-					}
-				}
-				// rules with 'discard' mod should not appear in AST, so eval
-				// code should not try to process them
-				else if (rule.mod() == "discard")
-				{
-					println(tabs, "// DISCARDED: ", rule.name());
-				}
-				// rules with 'inline' mod should not appear in AST, so eval
-				// code should not try to process them
-				else if (rule.mod() == "inline")
-				{
-// TODO: should be processed?
-					println(tabs, "// INLINED: ", rule.name());
-					println(tabs, "result = true;");
-				}
-				// process child nodes as if they are children of grandparent
-				// and omit eval_*() for this rule
-				else if (rule.mod() == "mergeup")
+				std::stable_sort(callees.begin(), callees.end(), [&](uint32_t a, uint32_t b)
 				{
-					println(tabs, "// MERGING: ", rule.name());
-					for (auto sub_elem : rule.elems())
-					{
-						print_eval_elem(sub_elem, depth);
-					}
-				}
-				else
-				{
-					eprintln("FATAL ERROR: unsupported rule modifier '", rule.mod(), "'");
-					exit(1);
-				}
+					if (m_prof_ok[a] != m_prof_ok[b]) return m_prof_ok[a] > m_prof_ok[b];
+					return m_prof_calls[a] > m_prof_calls[b];
+				});
 			}
-			else
+			// push in reverse so callees are visited in order of appearance
+			for (size_t i = callees.size(); i > 0; i--)
 			{
-				if (elem.type() == ElemType::STRING)
-				{
-					println(tabs, "if (c < node.children().size() && node.children()[c].text() == ", elem.text()[0], ")");
-					println(tabs, "{");
-					println(tabs, "\tresult = true;");
-					println(tabs, "\tc++;");
-					println(tabs, "}");
-				}
-				else
-				{
-					println(tabs, "// TODO: type = ", (uint32_t)elem.type(), ", string = ", elem.to_string());
-				}
+				if (!visited[callees[i - 1]]) to_visit.push_back(callees[i - 1]);
 			}
 		}
-		else if (elem.type() == ElemType::ALT)
+		order.insert(order.end(), cold.begin(), cold.end());
+		return order;
+	}
+
+	// ------------------------------------------------------------------------
+	// read rule counters written by Parser::write_profile() of a parser
+	// built with -DIPG_PROFILE; rules not in the grammar are ignored
+	// returns false if path cannot be read
+	bool load_profile(const char *path)
+	{
+		FILE *fp = fopen(path, "rb");
+		if (nullptr == fp) return false;
+		uint32_t n_rules = m_grammar.rules().size();
+		m_prof_calls.assign(n_rules, 0);
+		m_prof_ok.assign(n_rules, 0);
+		m_prof_alt_calls.assign(m_grammar.n_alts(), 0);
+		m_prof_alt_ok.assign(m_grammar.n_alts(), 0);
+		char line[1024];
+		while (nullptr != fgets(line, sizeof(line), fp))
 		{
-			println(tabs, "// ALT");
-			println(tabs, "while (!result)");
-			println(tabs, "{");
-			for (auto sub_elem : elem.sub_elems())
+			std::istringstream fields(line);
+			std::string key;
+			std::string name;
+			uint32_t index = 0;
+			uint64_t calls = 0;
+			uint64_t ok = 0;
+			fields >> key >> name;
+			if ("alt" == key) fields >> index;
+			if (!(fields >> calls >> ok)) continue;
+			uint32_t rule_id = m_grammar.find_rule(name);
+			if (Elem::NO_RULE == rule_id) continue;
+			if ("rule" == key)
 			{
-				print_eval_elem(sub_elem, depth + 1);
+				m_prof_calls[rule_id] = calls;
+				m_prof_ok[rule_id] = ok;
+			}
+			else if ("alt" == key)
+			{
+				uint32_t alt_id = m_grammar.find_alt(rule_id, index);
+				if (Elem::NO_ALT == alt_id) continue;
+				m_prof_alt_calls[alt_id] = calls;
+				m_prof_alt_ok[alt_id] = ok;
 			}
-			println(tabs, "\tbreak;");
-			println(tabs, "}");
-			//~ println(tabs, "if (result) break;");
 		}
-		else if (elem.type() == ElemType::GROUP)
+		fclose(fp);
+		m_have_profile = true;
+		analyze_first();
+
+		// hot rules account for at least 0.1% of all matches (calls that fail
+		// usually only run the start of a function); rules never called are
+		// cold
+		uint64_t total_ok = 0;
+		for (uint32_t r = 0; r < n_rules; r++) total_ok += m_prof_ok[r];
+		for (uint32_t r = 0; r < n_rules; r++)
 		{
-			println(tabs, "// GROUP");
-			println(tabs, "result = false;");
-			if (QuantifierType::ONE == elem.quantifier())
-			{
-				println(tabs, "for (;;)");
-				println(tabs, "{");
-				for (auto sub_elem : elem.sub_elems())
-				{
-					print_eval_elem(sub_elem, depth + 1);
-				}
-				//~ println(tabs, "\tif (!result) break;");
-				println(tabs, "\tbreak;");
-				println(tabs, "}");
-			}
-			else if (QuantifierType::ZERO_ONE == elem.quantifier())
-			{
-				println(tabs, "for (;;)");
-				println(tabs, "{");
-				for (auto sub_elem : elem.sub_elems())
-				{
-					print_eval_elem(sub_elem, depth + 1);
-				}
-				//~ println(tabs, "\tresult = true;");
-				println(tabs, "\tbreak;");
-				println(tabs, "}");
-			}
-			else if (QuantifierType::ZERO_PLUS == elem.quantifier())
-			{
-				println(tabs, "result = true;");
-				println(tabs, "while (result)");
-				println(tabs, "{");
-				println(tabs, "\tresult = false;");
-				for (auto sub_elem : elem.sub_elems())
-				{
-					print_eval_elem(sub_elem, depth + 1);
-				}
-				println(tabs, "}");
-				println(tabs, "result = true;");
-			}
-			else if (QuantifierType::ONE_PLUS == elem.quantifier())
-			{
-				println(tabs, "c_prev = c;");
-				println(tabs, "while (result)");
-				println(tabs, "{");
-				println(tabs, "\tresult = false;");
-				for (auto sub_elem : elem.sub_elems())
-				{
-					print_eval_elem(sub_elem, depth + 1);
-				}
-				println(tabs, "}");
-				println(tabs, "if (c_prev != c) result = true;");
-			}
-			else
-			{
-				eprintln("FATAL ERROR: unsupported quantifier type '",
-					std::to_string((uint32_t)elem.quantifier()), "'");
-				exit(1);
-			}
+			if (0 == m_prof_calls[r]) m_rule_heat[r] = RuleHeat::COLD;
+			else if (m_prof_ok[r] > 0 && m_prof_ok[r] * 1000 >= total_ok) m_rule_heat[r] = RuleHeat::HOT;
 		}
+		return true;
 	}
 
 	// ------------------------------------------------------------------------
-	void print_rule(Rule &rule)
+	// function attribute for rule from profile
+	const char *heat_attr(uint32_t rule_id)
 	{
-		println("");
-		println("\t// ***RULE*** ", rule.to_string());
-		println("\tint32_t parse_", rule.name(), "(ASTNode &node)");
-		println("\t{");
-		if (SCC_DEBUG) println("\t\tprintln(\"parse_", rule.name(), "()\");");
-		println("\t\tuint32_t pos_prev = m_pos;");
-		println("\t\tuint32_t line_prev = m_line;");
-		println("\t\tuint32_t col_prev = m_col;");
-		if ("mergeup" == rule.mod())
-		{
-			println("\t\tASTNode &astn0 = node;");
-		}
-		else
-		{
-			println("\t\tASTNode astn0(m_pos, m_line, m_col, \"", rule.name(), "\");");
-		}
-		println("");
-
-		print_alts(rule.elems());
+		if (RuleHeat::HOT == m_rule_heat[rule_id]) return "IPG_HOT ";
+		if (RuleHeat::COLD == m_rule_heat[rule_id]) return "IPG_COLD ";
+		return "";
+	}
 
-		println("");
-		println("\t\tif (!ok0)");
-		println("\t\t{");
-		println("\t\t\tm_pos = pos_prev;");
-		println("\t\t\tm_line = line_prev;");
-		println("\t\t\tm_col = col_prev;");
-		println("\t\t}");
-		// only add to AST if discard, inline and mergeup modifications not set
-		if ("discard" != rule.mod() && "inline" != rule.mod() && "mergeup" != rule.mod())
-		{
-			println("\t\telse");
-			println("\t\t{");
-			println("\t\t\tnode.add_child(astn0);");
-			println("\t\t}");
-		}
-		std::string ret_str = "RET_OK";
-		if ("inline" == rule.mod()) ret_str = "RET_INLINE";
-		println("\t\tif (ok0) return ", ret_str, ";");
-		println("\t\telse return RET_FAIL;");
-		println("\t}");
+	// ------------------------------------------------------------------------
+	// branch hint for a call to rule failing, from its profiled success
+	// rate: IPG_LIKELY if it rarely matches, IPG_UNLIKELY if it nearly always
+	// does, else empty
+	const char *fail_hint(uint32_t rule_id)
+	{
+		if (!m_have_profile) return "";
+		uint64_t calls = m_prof_calls[rule_id];
+		uint64_t ok = m_prof_ok[rule_id];
+		// too few calls to judge
+		if (calls < 16) return "";
+		if (ok * 10 <= calls) return "IPG_LIKELY";
+		if (ok * 10 >= calls * 9) return "IPG_UNLIKELY";
+		return "";
 	}
 
 	// ------------------------------------------------------------------------
-	void print_alts(std::vector<Elem> &elems, uint32_t depth = 0)
+	// compute for every rule the bytes its matches can start with and whether
+	// it can match the empty string, iterating until nothing changes
+	void analyze_first()
 	{
-		std::string tabs(depth + 2, '\t');
-		println(tabs, "// ***ALTERNATES***");
-		println(tabs, "bool ok", depth, " = false;");
-		println(tabs, "uint32_t pos_start", depth, " = m_pos;");
-		println(tabs, "uint32_t line_start", depth, " = m_line;");
-		println(tabs, "uint32_t col_start", depth, " = m_col;");
-		if (depth > 0)
-		{
-			println(tabs, "ASTNode astn", depth, "(m_pos, m_line, m_col, \"alts_tmp\");");
-		}
-		println(tabs, "for (;;)");
-		println(tabs, "{");
-		size_t n_elems = elems.size();
-		for (size_t e = 0; e < n_elems; e++)
-		{
-			if (e > 0) println("");
-			print_alt(elems[e], depth + 1);
-			println(tabs, "\tif (ok", depth, ") break;");
-			println(tabs, "\tm_pos = pos_start", depth, ";");
-			println(tabs, "\tm_line = line_start", depth, ";");
-			println(tabs, "\tm_col = col_start", depth, ";");
-		}
-		println("");
-		println(tabs, "\tbreak;");
-		println(tabs, "}");
-		println(tabs, "if (!ok", depth, ")");
-		println(tabs, "{");
-		println(tabs, "\tm_pos = pos_start", depth, ";");
-		println(tabs, "\tm_line = line_start", depth, ";");
-		println(tabs, "\tm_col = col_start", depth, ";");
-		//~ if (depth > 0) println(tabs, "\tbreak;");
-		println(tabs, "}");
-		println(tabs, "else");
-		println(tabs, "{");
-		if (SCC_DEBUG)
-		{
-			println(tabs, "\tprintln(\"*\", std::string(&m_text[pos_start", depth, "], m_pos - pos_start", depth, "), \"*\");");
-		}
-		if (depth > 0)
+		uint32_t n_rules = m_grammar.rules().size();
+		m_rule_first.assign(n_rules, std::bitset<256>());
+		m_rule_nullable.assign(n_rules, false);
+		bool changed = true;
+		while (changed)
 		{
-			println(tabs, "\tfor (auto child", depth, " : astn", depth, ".children())");
-			println(tabs, "\t{");
-			println(tabs, "\t\tastn", depth - 2, ".add_child(child", depth, ");");
-			println(tabs, "\t}");
+			changed = false;
+			for (uint32_t r = 0; r < n_rules; r++)
+			{
+				std::bitset<256> first;
+				Rule &rule = m_grammar.rule(r);
+				bool nullable = alts_first(m_grammar.alts(rule), first);
+				for (auto &level : m_grammar.op_levels(rule))
+				{
+					if (OpKind::PREFIX != level.kind) continue;
+					for (uint32_t i = 0; i < level.tok_count; i++)
+					{
+						first.set((uint8_t)unescape_string(m_grammar.tok(level, i))[0]);
+					}
+				}
+				if (first != m_rule_first[r] || nullable != m_rule_nullable[r])
+				{
+					m_rule_first[r] = first;
+					m_rule_nullable[r] = nullable;
+					changed = true;
+				}
+			}
 		}
-		println(tabs, "}");
 	}
 
 	// ------------------------------------------------------------------------
-	void print_alt(Elem &elem, uint32_t depth = 0)
+	// add first bytes of alternates to first; returns true if any is nullable
+	bool alts_first(Span<Elem> alts, std::bitset<256> &first)
 	{
-		// sanity check
-		if (ElemType::ALT != elem.type()) return;
-
-		std::string tabs(depth + 2, '\t');
-
-		println(tabs, "// ***ALTERNATE***", elem.to_string());
-		println(tabs, "for (;;)");
-		println(tabs, "{");
-		println(tabs, "\tint32_t counter", depth + 1, " = 0;");
-		println(tabs, "\tbool ok", depth , " = false;");
-		println(tabs, "\tuint32_t pos_start", depth , " = m_pos;");
-		println(tabs, "\tuint32_t line_start", depth , " = m_line;");
-		println(tabs, "\tuint32_t col_start", depth , " = m_col;");
-		println("");
+		bool nullable = false;
+		for (auto &alt : alts) nullable |= alt_first(alt, first);
+		return nullable;
+	}
 
-		size_t n_elems = elem.sub_elems().size();
-		for (size_t e = 0; e < n_elems; e++)
+	// ------------------------------------------------------------------------
+	// add first bytes of an alternate (sequence) to first; returns true if
+	// it is nullable
+	bool alt_first(Elem &alt, std::bitset<256> &first)
+	{
+		for (auto &sub_elem : m_grammar.subs(alt))
 		{
-			if (e > 0) println("");
-			print_elem(elem.sub_elems()[e], depth + 1);
+			if (!elem_first(sub_elem, first)) return false;
 		}
-
-		println("");
-		//~ println(tabs, "\tok", depth - 1, " = true;");
-		println(tabs, "\tok", depth - 1 ," = ok", depth, ";");
-		println(tabs, "\tbreak;");
-		println(tabs, "}");
+		return true;
 	}
 
 	// ------------------------------------------------------------------------
-	void print_elem(Elem &elem, uint32_t depth = 0)
+	// add first bytes of element to first; returns true if it is nullable
+	bool elem_first(Elem &elem, std::bitset<256> &first)
 	{
-		// sanity check
-		if (ElemType::ALT == elem.type()) return;
-
-		std::string tabs(depth + 2, '\t');
-
-		println(tabs, "// ***ELEMENT***", elem.to_string());
-
-		if (elem.quantifier() == QuantifierType::ZERO_ONE)
+		// a predicate consumes nothing
+		if (Lookahead::NONE != elem.lookahead()) return true;
+		bool nullable = false;
+		if (ElemType::NAME == elem.type())
 		{
-			println(tabs, "ok", depth - 1, " = false;");
-			println(tabs, "for (;;)");
-			println(tabs, "{");
-			println(tabs, "\tpos_start", depth - 1, " = m_pos;");
-			print_elem_inner(elem, depth);
-			println(tabs, "\tok", depth - 1, " = true;");
-			println(tabs, "\tbreak;");
-			println(tabs, "}");
+			first |= m_rule_first[elem.rule()];
+			nullable = m_rule_nullable[elem.rule()];
 		}
-		else if (elem.quantifier() == QuantifierType::ZERO_PLUS)
+		else if (ElemType::GROUP == elem.type())
 		{
-			println(tabs, "ok", depth - 1, " = false;");
-			println(tabs, "for (;;)");
-			println(tabs, "{");
-			println(tabs, "\tpos_start", depth - 1, " = m_pos;");
-			print_elem_inner(elem, depth);
-			println(tabs, "\tif (ok", depth, ") continue;");
-			println(tabs, "\tok", depth - 1, " = true;");
-			println(tabs, "\tbreak;");
-			println(tabs, "}");
+			nullable = alts_first(m_grammar.subs(elem), first);
 		}
-		else if (elem.quantifier() == QuantifierType::ONE_PLUS)
+		else if (ElemType::STRING == elem.type())
 		{
-			println(tabs, "ok", depth - 1, " = false;");
-			println(tabs, "counter", depth, " = 0;");
-			println(tabs, "for (;;)");
-			println(tabs, "{");
-			println(tabs, "\tpos_start", depth - 1, " = m_pos;");
-			print_elem_inner(elem, depth);
-			println(tabs, "\tif (!ok", depth, ") break;");
-			println(tabs, "\tcounter", depth, "++;");
-			println(tabs, "}");
-			println(tabs, "ok", depth - 1, " = (counter", depth, " > 0);");
+			std::string str = unescape_string(m_grammar.tok(elem, 0));
+			if (str.empty()) nullable = true;
+			else first.set((uint8_t)str[0]);
 		}
-		else if (elem.quantifier() == QuantifierType::ONE)
+		// anything up to its terminator
+		else if (ElemType::UNTIL == elem.type())
 		{
-			println(tabs, "ok", depth - 1, " = false;");
-			println(tabs, "for (;;)");
-			println(tabs, "{");
-			println(tabs, "\tpos_start", depth - 1, " = m_pos;");
-			print_elem_inner(elem, depth);
-			println(tabs, "\tok", depth - 1, " = ok", depth, ";");
-			println(tabs, "\tbreak;");
-			println(tabs, "}");
+			if (unescape_string(m_grammar.tok(elem, 0)).empty()) nullable = true;
+			else first.set();
 		}
-		else
+		else if (ElemType::CUT == elem.type())
 		{
-			uint32_t qt = (uint32_t)elem.quantifier();
-			eprintln("FATAL ERROR: unsupported quantifier '", qt, "'");
-			exit(1);
+			nullable = true;
 		}
-
-		println(tabs, "if (!ok", depth - 1, ")");
-		println(tabs, "{");
-		println(tabs, "\tm_pos = pos_start", depth - 1, ";");
-		println(tabs, "\tm_line = line_start", depth - 1, ";");
-		println(tabs, "\tm_col = col_start", depth - 1, ";");
-		println(tabs, "\tbreak;");
-		println(tabs, "}");
-		println(tabs, "else");
-		println(tabs, "{");
-		println(tabs, "\tif (m_pos > m_pos_ok)");
-		println(tabs, "\t{");
-		println(tabs, "\t\tm_pos_ok = m_pos;");
-		println(tabs, "\t\tm_line_ok = m_line;");
-		println(tabs, "\t\tm_col_ok = m_col;");
-		println(tabs, "\t}");
-		println(tabs, "}");
-	}
-
-	// ------------------------------------------------------------------------
-	void print_elem_inner(Elem &elem, uint32_t depth = 0)
-	{
-		std::string tabs(depth + 3, '\t');
-
-		if (ElemType::NAME == elem.type())
+		else if (ElemType::CH_CLASS == elem.type() && m_grammar.bytes())
 		{
-			println(tabs, "int32_t ok", depth, " = parse_", elem.text()[0], "(astn", depth - 2, ");");
-			if ("inline" == m_grammar.rules()[elem.text()[0]].mod())
+			ChClass cc = m_grammar.ch_class(elem);
+			for (int32_t ch = 0; ch < 256; ch++)
 			{
-				println(tabs, "if (RET_INLINE == ok", depth, ")");
-				println(tabs, "{");
-				println(tabs, "\tASTNode astn", depth, "(pos_start", depth - 1,
-					", line_start", depth - 1, ", col_start", depth - 1,
-					", std::string(&m_text[pos_start", depth - 1, "], m_pos - pos_start", depth - 1, "));");
-				println(tabs, "\tastn", depth - 2, ".add_child(astn", depth, ");");
-				println(tabs, "}");
+				if (cc.matches(ch)) first.set(ch);
 			}
 		}
-		// NOTE: assumes valid expression since parser should have validated
 		else if (ElemType::CH_CLASS == elem.type())
 		{
-			println(tabs, "bool ok", depth, " = false;");
-			println(tabs, "int32_t ch_decoded;");
-			println(tabs, "int32_t len_item", depth, " = utf8_to_int32(&ch_decoded, &m_text[m_pos]);");
-
-			int32_t idx = 1;
-			bool flag_negate_all = false;
-			int32_t range_ch1;
-			int32_t range_ch2;
-			bool escaped = false;
-			int32_t ch32 = decode_to_int32(&escaped, (char *)elem.text()[idx].c_str());
-			if ('^' == ch32 && !escaped)
-			{
-				flag_negate_all = true;
-				idx++;
-			}
-
-			// print expression to check if char matches character class
-			prints(tabs, "if (len_item", depth, " > 0 && ", (flag_negate_all ? "!" : ""), "(true");
-
-			// negative expressions
-			// loop over all tokens except leading and trailing [ ]
-			for (int32_t idx2 = idx; idx2 < elem.text().size() - 1;)
-			{
-				bool flag_is_range = false;
-
-				bool flag_negate = false;
-				ch32 = decode_to_int32(&escaped, (char *)elem.text()[idx2].c_str());
-				// check for negation
-				if ('!' == ch32 && !escaped)
-				{
-					flag_negate = true;
-					idx2++;
-				}
-				// get first char in range
-				range_ch1 = decode_to_int32(&escaped, (char *)elem.text()[idx2].c_str());
-				idx2++;
-				ch32 = decode_to_int32(&escaped, (char *)elem.text()[idx2].c_str());
-				// check for range separator
-				if ('-' == ch32 && !escaped)
-				{
-					flag_is_range = true;
-					idx2++;
-					range_ch2 = decode_to_int32(&escaped, (char *)elem.text()[idx2].c_str());
-					idx2++;
-				}
-
-				if (flag_negate)
-				{
-					prints(" && ");
-
-					// print expression for this part of character class
-					if (!flag_is_range)
-					{
-						prints((flag_negate ? "!" : ""), "(ch_decoded == ", range_ch1, ")");
-					}
-					else
-					{
-						prints((flag_negate ? "!" : ""), "(ch_decoded >= ", range_ch1,
-							" && ch_decoded <= ", range_ch2, ")");
-					}
-				}
-			}
-
-			// positive expressions
-			// loop over all tokens except leading and trailing [ ]
-			prints(" && (false");
-			for (; idx < elem.text().size() - 1;)
+			ChClass cc = m_grammar.ch_class(elem);
+			if (cc.negate_all) first.set();
+			for (auto &range : cc.pos)
 			{
-				bool flag_is_range = false;
-
-				bool flag_negate = false;
-				ch32 = decode_to_int32(&escaped, (char *)elem.text()[idx].c_str());
-				// check for negation
-				if ('!' == ch32 && !escaped)
-				{
-					flag_negate = true;
-					idx++;
-				}
-				// get first char in range
-				range_ch1 = decode_to_int32(&escaped, (char *)elem.text()[idx].c_str());
-				idx++;
-				ch32 = decode_to_int32(&escaped, (char *)elem.text()[idx].c_str());
-				// check for range separator
-				if ('-' == ch32 && !escaped)
-				{
-					flag_is_range = true;
-					idx++;
-					range_ch2 = decode_to_int32(&escaped, (char *)elem.text()[idx].c_str());
-					idx++;
-				}
-
-				if (!flag_negate)
+				for (int32_t ch = range.first; ch <= range.second && ch < 0x80; ch++) first.set(ch);
+				// any multi-byte UTF-8 lead byte
+				if (range.second >= 0x80)
 				{
-					prints(" || ");
-
-					// print expression for this part of character class
-					if (!flag_is_range)
-					{
-						prints("(ch_decoded == ", range_ch1, ")");
-					}
-					else
-					{
-						prints("(ch_decoded >= ", range_ch1, " && ch_decoded <= ", range_ch2, ")");
-					}
+					for (int32_t b = 0xc0; b < 0x100; b++) first.set(b);
 				}
 			}
-			println(")))");
-			println(tabs, "{ m_pos += len_item", depth, "; m_col += len_item", depth, "; ok", depth, " = true; }");
-
-			println(tabs, "if (ok", depth, ")");
-			println(tabs, "{");
-			println(tabs, "\tASTNode astn", depth, "(pos_start", depth - 1,
-				", line_start", depth - 1, ", col_start", depth - 1,
-				", std::string(&m_text[pos_start", depth - 1, "], m_pos - pos_start", depth - 1, "));");
-			println(tabs, "\tastn", depth - 2, ".add_child(astn", depth, ");");
-			println(tabs, "\tif ('\\n' == ch_decoded)");
-			println(tabs, "\t{");
-			println(tabs, "\t\tm_line++;");
-			println(tabs, "\t\tm_col = 1;");
-			println(tabs, "\t}");
-			println(tabs, "}");
 		}
-		else if (ElemType::STRING == elem.type())
+		// a count may be zero
+		if (QuantifierType::ZERO_ONE == elem.quantifier()
+			|| QuantifierType::ZERO_PLUS == elem.quantifier()
+			|| QuantifierType::COUNT == elem.quantifier())
 		{
-			println(tabs, "bool ok", depth, " = false;");
-			println(tabs, "const char *str = ", elem.text()[0], ";");
-			println(tabs, "int32_t i = 0;");
-			println(tabs, "for (; i < strlen(str) && m_text[m_pos] == str[i]; i++, m_pos++, m_col++);");
-			println(tabs, "if (i == strlen(str)) ok", depth, " = true;");
-
-			println(tabs, "if (ok", depth, ")");
-			println(tabs, "{");
-			println(tabs, "\tASTNode astn", depth, "(pos_start", depth - 1,
-				", line_start", depth - 1, ", col_start", depth - 1,
-				", std::string(&m_text[pos_start", depth - 1, "], m_pos - pos_start", depth - 1, "));");
-			println(tabs, "\tastn", depth - 2, ".add_child(astn", depth, ");");
-			println(tabs, "}");
+			nullable = true;
 		}
-		else if (ElemType::GROUP == elem.type())
+		return nullable;
+	}
+
+	// ------------------------------------------------------------------------
+	// order in which to try alternates, as indexes into alts
+	//
+	// with a profile, alternates that match more often move ahead, but an
+	// alternate only ever moves past one that can never match where it does:
+	// neither is nullable and their first bytes are disjoint, so the choice
+	// (and the tree built) is the same for every input
+	std::vector<uint32_t> alt_order(Span<Elem> alts)
+	{
+		std::vector<uint32_t> order;
+		for (uint32_t i = 0; i < alts.size(); i++) order.push_back(i);
+		if (!m_have_profile || alts.size() < 2) return order;
+
+		std::vector<std::bitset<256>> firsts(alts.size());
+		std::vector<bool> nullables(alts.size());
+		std::vector<uint64_t> oks(alts.size());
+		for (uint32_t i = 0; i < alts.size(); i++)
 		{
-			println(tabs, "int32_t len_item", depth, " = -1;");
-			print_alts(elem.sub_elems(), depth);
+			nullables[i] = alt_first(alts[i], firsts[i]);
+			oks[i] = m_prof_alt_ok[alts[i].alt_id()];
 		}
-		else
+		// insertion sort by adjacent swaps, so every pair whose order
+		// changes is checked directly
+		for (uint32_t i = 1; i < order.size(); i++)
 		{
-			eprintln("FATAL ERROR: unsupported element type: ", (int)elem.type());
-			exit(1);
+			for (uint32_t j = i; j > 0; j--)
+			{
+				uint32_t a = order[j - 1];
+				uint32_t b = order[j];
+				if (oks[b] <= oks[a]) break;
+				if (nullables[a] || nullables[b] || (firsts[a] & firsts[b]).any()) break;
+				std::swap(order[j - 1], order[j]);
+			}
 		}
+		return order;
 	}
 
 	// ------------------------------------------------------------------------
-	// check for named elem and/or sub-elems and add to to_visit_new if not
-	// already in to_visit or visited
-	void check_rule_elems(
-		Elem &elem,
-		std::map<std::string, bool> &to_visit,
-		std::map<std::string, bool> &to_visit_new,
-		std::map<std::string, bool> &visited)
+	// append alternate lists of rule body alts and of groups nested in it
+	void collect_alt_lists(Span<Elem> alts, std::vector<Span<Elem>> &lists)
 	{
-		if (ElemType::NAME == elem.type())
+		lists.push_back(alts);
+		for (auto &alt : alts)
 		{
-			std::string elem_name = elem.text()[0];
-			// add to to_visit_new list
-			if (to_visit.find(elem_name) == to_visit.end()
-				&& visited.find(elem_name) == visited.end())
+			for (auto &sub_elem : m_grammar.subs(alt))
 			{
-				to_visit_new[elem_name] = true;
+				if (ElemType::GROUP == sub_elem.type()) collect_alt_lists(m_grammar.subs(sub_elem), lists);
 			}
 		}
-		// if there are sub elems to this elem, loop over them
-		if (elem.sub_elems().size() > 0)
+	}
+
+	// ------------------------------------------------------------------------
+	// expected number of alternates tried over the profiled run if alts are
+	// tried in order: a match of alternate i costs its position plus one, a
+	// failure of the whole list costs all of them
+	uint64_t alt_tries(Span<Elem> alts, const std::vector<uint32_t> &order)
+	{
+		uint64_t entered = 0;
+		uint64_t matched = 0;
+		uint64_t tries = 0;
+		for (uint32_t pos = 0; pos < order.size(); pos++)
 		{
-			for (auto sub_elem : elem.sub_elems())
-			{
-				check_rule_elems(sub_elem, to_visit, to_visit_new, visited);
-			}
+			uint32_t alt_id = alts[order[pos]].alt_id();
+			entered = std::max(entered, m_prof_alt_calls[alt_id]);
+			matched += m_prof_alt_ok[alt_id];
+			tries += m_prof_alt_ok[alt_id] * (pos + 1);
 		}
+		return tries + (entered - std::min(entered, matched)) * order.size();
 	}
 
 	// ------------------------------------------------------------------------
-	// check for:
-	//  1) unreachable rules (no usage tracing to root rule)
-	//  2) named elems referring to non-existent rules
-	bool check_rules()
+	// print to stderr, per rule whose alternates were reordered from the
+	// profile, expected alternates tried before and after
+	void report_reordering()
 	{
-		bool retval = true;
-
-		std::map<std::string, bool> to_visit;
-		std::map<std::string, bool> visited;
-		// initialize to_visit map with root rule
-		to_visit[m_grammar.rule_root()] = true;
-		// loop until to_visit list is empty
-		while (to_visit.size() > 0)
+		if (!m_have_profile) return;
+		uint64_t total_before = 0;
+		uint64_t total_after = 0;
+		std::vector<Span<Elem>> lists;
+		for (uint32_t r = 0; r < m_grammar.rules().size(); r++)
 		{
-			std::map<std::string, bool> to_visit_new;
-
-			// loop over to_visit list
-			for (auto rule : to_visit)
-			{
-				std::string rule_name = rule.first;
-				visited[rule_name] = true;
-
-				if (m_grammar.rules().find(rule_name) == m_grammar.rules().end())
-				{
-					eprintln("ERROR: undefined rule '", rule_name, "'");
-					retval = false;
-				}
-
-				// loop over child elems
-				for (int i = 0; i < m_grammar.rules()[rule_name].elems().size(); i++)
-				{
-					Elem &elem = m_grammar.rules()[rule_name].elems()[i];
-					check_rule_elems(elem, to_visit, to_visit_new, visited);
-				}
-			}
-			to_visit.clear();
-			for (auto rule : to_visit_new)
-			{
-				to_visit[rule.first] = true;
-			}
-			to_visit = to_visit_new;
-
-			// erase visited rules from to_visit list
-			for (auto rule : visited)
+			lists.clear();
+			collect_alt_lists(m_grammar.alts(m_grammar.rule(r)), lists);
+			uint64_t before = 0;
+			uint64_t after = 0;
+			for (auto &alts : lists)
 			{
-				std::string rule_name = rule.first;
-				auto it = to_visit.find(rule_name);
-				if (it != to_visit.end()) to_visit.erase(it);
+				if (alts.size() < 2) continue;
+				std::vector<uint32_t> order;
+				for (uint32_t i = 0; i < alts.size(); i++) order.push_back(i);
+				before += alt_tries(alts, order);
+				after += alt_tries(alts, alt_order(alts));
 			}
-		}
-		// error if not all visited
-		if (m_grammar.rules().size() > visited.size())
-		{
-			// print unreachable rules
-			for (auto rule : m_grammar.rules())
+			if (after < before)
 			{
-				std::string rule_name = rule.first;
-				auto it = visited.find(rule_name);
-				if (it == visited.end())
-				{
-					eprintln("ERROR: unreachable rule '", rule_name, "'");
-				}
+				eprintln("reordered alternates of ", m_grammar.name(m_grammar.rule(r)),
+					": expected tries ", before, " -> ", after);
 			}
-			retval = false;
+			total_before += before;
+			total_after += after;
 		}
-
-		return retval;
+		eprintln("expected alternates tried: ", total_before, " -> ", total_after);
 	}
 
 	// ------------------------------------------------------------------------
-	// rules : ws (comment ws)* rule+;
-	bool parse_grammar(const char *text_r)
+	// hash of everything the generated parse_*() and eval_*() code of a rule
+	// depends on: its id, modifier, normalized text and alternate order, plus
+	// the modifier and has_eval() of each rule it references; merged-up rules
+	// are expanded into the eval code of their callers, so their whole hash
+	// is included
+	uint64_t rule_hash(uint32_t rule_id)
 	{
-		if (SCC_DEBUG) eprintln("parse_grammar ", m_pos);
-		m_text = text_r;
+		std::vector<bool> active(m_grammar.rules().size(), false);
+		return rule_hash(rule_id, active);
+	}
 
-		parse_ws();
-		uint32_t m_pos_prev;
-		do
+	uint64_t rule_hash(uint32_t rule_id, std::vector<bool> &active)
+	{
+		Rule &rule = m_grammar.rule(rule_id);
+		uint64_t hash = fnv1a(rule_id);
+		hash = fnv1a(rule_str(rule), hash);
+		hash = fnv1a(rule_mod_str(rule.mod()), hash);
+		hash = fnv1a(heat_attr(rule_id), hash);
+		hash = fnv1a(fail_hint(rule_id), hash);
+		hash = fnv1a((uint64_t)collapses(rule), hash);
+		hash = fnv1a((uint64_t)m_record_elided, hash);
+		hash = fnv1a((uint64_t)m_no_tree, hash);
+		hash = fnv1a((uint64_t)m_typed, hash);
+		hash = fnv1a((uint64_t)m_subscribe, hash);
+		hash = fnv1a((uint64_t)m_incremental, hash);
+		hash = fnv1a((uint64_t)m_bottom_up, hash);
+		if (m_bottom_up)
 		{
-			m_pos_prev = m_pos;
-			parse_comment();
-			parse_ws();
+			hash = fnv1a((uint64_t)m_left_rec[rule_id], hash);
+			// its loop caches are numbered after those of the rules before it
+			hash = fnv1a((uint64_t)m_rep_base[rule_id], hash);
 		}
-		while (m_text[m_pos] != '\0' && m_pos_prev != m_pos);
-
-		while (m_text[m_pos] != '\0')
+		hash = fnv1a((uint64_t)m_checked[rule_id], hash);
+		hash = fnv1a((uint64_t)(Elem::NO_RULE != m_skip_rule && !m_lexical[rule_id]), hash);
+		hash = fnv1a((uint64_t)m_grammar.bytes(), hash);
+		hash = fnv1a(m_grammar.value_type(), hash);
+		if (indexed())
 		{
-			bool ok = parse_rule();
-			if (!ok) return false;
+			hash = fnv1a(m_grammar.structural(), hash);
+			hash = fnv1a(m_grammar.structural_escape(), hash);
+			hash = fnv1a(m_grammar.lazy_quotes(), hash);
+			hash = fnv1a(m_grammar.lazy_comment(), hash);
 		}
-
-		return true;
+		if (Rule::NO_NAME != rule.action_id()) hash = fnv1a(m_grammar.action(rule), hash);
+		std::vector<Span<Elem>> lists;
+		collect_alt_lists(m_grammar.alts(rule), lists);
+		for (auto &alts : lists)
+		{
+			for (auto idx : alt_order(alts)) hash = fnv1a((uint64_t)idx, hash);
+		}
+		if (active[rule_id]) return hash;
+		active[rule_id] = true;
+		std::vector<uint32_t> callees;
+		rule_callees(rule_id, callees);
+		for (auto callee_id : callees)
+		{
+			Rule &callee = m_grammar.rule(callee_id);
+			hash = fnv1a(rule_mod_str(callee.mod()), hash);
+			hash = fnv1a((uint64_t)builds_node(callee), hash);
+			hash = fnv1a((uint64_t)rule_has_named_elem(callee), hash);
+			hash = fnv1a(fail_hint(callee_id), hash);
+			// eval code matches collapsed callees by the ids that can stand in
+			if (collapses(callee))
+			{
+				for (auto id : collapse_closure(callee_id)) hash = fnv1a((uint64_t)id, hash);
+			}
+			if (RuleMod::MERGEUP == callee.mod())
+			{
+				hash = fnv1a(rule_hash(callee_id, active), hash);
+			}
+		}
+		active[rule_id] = false;
+		return hash;
 	}
 
 	// ------------------------------------------------------------------------
-	// rule : ws id ws ("discard" | "inline" | "mergeup")? ws ":" ws alts ws ";" ws (comment ws)*;
-	bool parse_rule()
+	// append ids of rules called by rule's parse_*() function
+	void rule_callees(uint32_t rule_id, std::vector<uint32_t> &callees)
 	{
-		if (SCC_DEBUG) eprintln("parse_rule ", m_pos);
-		parse_ws();
+		Rule &rule = m_grammar.rule(rule_id);
+		for (auto &elem : m_grammar.alts(rule)) collect_callees(elem, callees);
+		if (Elem::NO_RULE != rule.op_skip()) callees.push_back(rule.op_skip());
+	}
 
-		int32_t len_name = parse_id();
-		if (len_name <= 0) return false;
+	// ------------------------------------------------------------------------
+	// append ids of rules referenced by element or its sub-elements
+	void collect_callees(Elem &elem, std::vector<uint32_t> &callees)
+	{
+		if (ElemType::NAME == elem.type()) callees.push_back(elem.rule());
+		for (auto &sub_elem : m_grammar.subs(elem)) collect_callees(sub_elem, callees);
+	}
 
-		std::string rule_name(&m_text[m_pos - len_name], len_name);
-		// first parsed rule is root of grammar
-		if ("" == m_grammar.rule_root()) m_grammar.rule_root() = rule_name;
+	// ------------------------------------------------------------------------
+	// rough measure of generated code size for element
+	uint64_t elem_size(Elem &elem)
+	{
+		uint64_t size = 1 + elem.tok_count();
+		for (auto &sub_elem : m_grammar.subs(elem)) size += elem_size(sub_elem);
+		return size;
+	}
+
+	// ------------------------------------------------------------------------
+	// operator table types and matching used by climb_*() functions; only
+	// printed if the grammar has an 'operators' rule
+	void print_op_helpers()
+	{
+		bool any = false;
+		for (auto &rule : m_grammar.rules()) any |= (RuleMod::OPERATORS == rule.mod());
+		if (!any) return;
+		m_out.prints(
+R"foo(
+	enum OpKind : uint8_t { OP_LEFT, OP_RIGHT, OP_PREFIX, OP_POSTFIX };
+	struct OpDef
+	{
+		const char *text;
+		uint32_t len;
+		uint32_t level;
+		OpKind kind;
+	};
+	static const uint32_t NO_OP_LEVEL = 0xffffffff;
 
-		if (m_grammar.rules().find(rule_name) != m_grammar.rules().end())
+	// index of first operator in ops (longest first) at m_pos that is a
+	// prefix operator or is not, as asked, or -1
+	int32_t match_op(const OpDef *ops, uint32_t n_ops, bool prefix)
+	{
+)foo");
+		if (m_incremental) m_out.println("\t\tif (m_pos > m_reach) m_reach = m_pos;");
+		m_out.prints(
+R"foo(		for (uint32_t i = 0; i < n_ops; i++)
 		{
-			eprintln("ERROR: duplicate rule name '", rule_name, "'");
-			return false;
+			if ((OP_PREFIX == ops[i].kind) != prefix) continue;
+			if (m_len - m_pos >= ops[i].len && 0 == memcmp(m_in.span(m_pos, ops[i].len), ops[i].text, ops[i].len)) return (int32_t)i;
 		}
+		return -1;
+	}
 
-		m_grammar.rules()[rule_name] = Rule(rule_name);
+	// add nodes built by rules in node's subtree to parent, in order
+	void hoist_rule_nodes(ASTNode &node, ASTNode &parent)
+	{
+		for (auto &child : node.children())
+		{
+			if (ASTNode::NO_RULE != child.rule_id()) parent.add_child(child);
+			else hoist_rule_nodes(child, parent);
+		}
+	}
 
-		parse_ws();
+	// add operator matched at m_pos to node and move past it
+	void add_op(ASTNode &node, const OpDef &op)
+	{
+		ASTNode astn(m_pos, m_line, m_col, std::string(op.text, op.len));
+		node.add_child(std::move(astn));
+)foo");
+		if (m_typed) m_out.println("\t\tm_typed.push_back(TypedItem{nullptr, m_pos, m_line, m_col, op.len});");
+		m_out.prints(
+R"foo(		m_pos += op.len;
+		m_col += op.len;
+	}
+)foo");
+	}
 
-		// optional rule modifier
-		int32_t len_mod = parse_id();
-		if (len_mod > 0)
+	// ------------------------------------------------------------------------
+	// generated rule ids match grammar rule ids and index profile counters
+	void print_rule_names()
+	{
+		m_out.println("\tstatic const uint32_t N_RULES = ", m_grammar.rules().size(), ";");
+		m_out.println("\tstatic const char *rule_name(uint32_t id)");
+		m_out.println("\t{");
+		m_out.println("\t\tstatic const char *names[N_RULES] =");
+		m_out.println("\t\t{");
+		for (auto &rule : m_grammar.rules()) m_out.println("\t\t\t\"", m_grammar.name(rule), "\",");
+		m_out.println("\t\t};");
+		m_out.println("\t\treturn (id < N_RULES) ? names[id] : \"\";");
+		m_out.println("\t}");
+	}
+
+	// ------------------------------------------------------------------------
+	// runtime choice of rules whose nodes are built
+	void print_subscription()
+	{
+		m_out.prints(
+R"foo(	// build nodes only for the given rules (by default, all); other rules
+	// are only recognized, and the nodes of subscribed rules below them are
+	// attached to the nearest subscribed ancestor instead
+	void subscribe(const std::vector<uint32_t> &rule_ids)
+	{
+		m_subscribed.assign(N_RULES, 0);
+		for (auto id : rule_ids)
 		{
-			std::string rule_mod(&m_text[m_pos - len_mod], len_mod);
-			if ("discard" != rule_mod && "inline" != rule_mod && "mergeup" != rule_mod) return false;
-			m_grammar.rules()[rule_name].mod() = rule_mod;
+			if (id < N_RULES) m_subscribed[id] = 1;
 		}
+	}
+	void subscribe_all() { m_subscribed.assign(N_RULES, 1); }
 
-		parse_ws();
-
-		if (m_text[m_pos] != ':') return false;
-		m_pos++;
-		m_col++;
+	// id of rule with given name, or N_RULES if none
+	static uint32_t rule_id(const std::string &name)
+	{
+		for (uint32_t id = 0; id < N_RULES; id++)
+		{
+			if (name == rule_name(id)) return id;
+		}
+		return N_RULES;
+	}
 
-		parse_ws();
+)foo");
+	}
 
-		int32_t len_alts = parse_alts(m_grammar.rules()[rule_name].elems());
-		if (-1 == len_alts) return false;
+	// ------------------------------------------------------------------------
+	// whether any rule is 'lazy'
+	bool has_lazy()
+	{
+		for (auto &rule : m_grammar.rules())
+		{
+			if (RuleMod::LAZY == rule.mod()) return true;
+		}
+		return false;
+	}
 
-		parse_ws();
+	// ------------------------------------------------------------------------
+	// append names captured in element or its sub-elements to captures, each
+	// once
+	void collect_captures(Elem &elem, std::vector<std::string> &captures)
+	{
+		if (StrPool::NO_STR != elem.capture_id())
+		{
+			const std::string &cap = m_grammar.capture(elem);
+			if (std::find(captures.begin(), captures.end(), cap) == captures.end()) captures.push_back(cap);
+		}
+		for (auto &sub_elem : m_grammar.subs(elem)) collect_captures(sub_elem, captures);
+	}
 
-		if (m_text[m_pos] != ';') return false;
-		m_pos++;
-		m_col++;
+	// ------------------------------------------------------------------------
+	// whether any element captures its match (name=elem)
+	bool has_captures()
+	{
+		for (auto &rule : m_grammar.rules())
+		{
+			std::vector<std::string> captures;
+			for (auto &alt : m_grammar.alts(rule)) collect_captures(alt, captures);
+			if (!captures.empty()) return true;
+		}
+		return false;
+	}
 
-		parse_ws();
-		uint32_t m_pos_prev;
-		do
+	// ------------------------------------------------------------------------
+	// integer value of a captured match: its decimal digits or, matching raw
+	// bytes, the bytes as a big-endian (network order) number
+	void print_capture_value()
+	{
+		m_out.println("");
+		m_out.println("\t// integer value of the match from from to to, as captured by name=elem:");
+		m_out.println("\t// CAPTURE_OVERFLOW if it does not fit", m_grammar.bytes() ? "" : " (or holds a non-digit)",
+			", which no count matches");
+		m_out.println("\tstatic const uint64_t CAPTURE_OVERFLOW = ~(uint64_t)0;");
+		m_out.println("\tuint64_t capture_value(uint32_t from, uint32_t to)");
+		m_out.println("\t{");
+		m_out.println("\t\tuint64_t val = 0;");
+		m_out.println("\t\tfor (uint32_t i = from; i < to; i++)");
+		m_out.println("\t\t{");
+		if (m_grammar.bytes())
 		{
-			m_pos_prev = m_pos;
-			parse_comment();
-			parse_ws();
+			m_out.println("\t\t\tif (val >> 56) return CAPTURE_OVERFLOW;");
+			m_out.println("\t\t\tval = (val << 8) | (uint8_t)m_in[i];");
 		}
-		while (m_text[m_pos] != '\0' && m_pos_prev != m_pos);
+		else
+		{
+			m_out.println("\t\t\tuint64_t digit = (uint64_t)(m_in[i] - '0');");
+			m_out.println("\t\t\tif (digit > 9 || val > (CAPTURE_OVERFLOW - 1 - digit) / 10) return CAPTURE_OVERFLOW;");
+			m_out.println("\t\t\tval = val * 10 + digit;");
+		}
+		m_out.println("\t\t}");
+		m_out.println("\t\treturn val;");
+		m_out.println("\t}");
+	}
 
-		if (SCC_DEBUG) eprintln("exiting parse_rule ", m_pos);
+	// ------------------------------------------------------------------------
+	// whether the %skip rule is one repetition, * or +: that stops only where
+	// what it repeats fails or matches nothing, so it matches nothing more
+	// where it just ended, as skip() assumes
+	bool skip_rule_ok()
+	{
+		Rule &rule = m_grammar.rule(m_skip_rule);
+		if (RuleMod::OPERATORS == rule.mod() || 1 != rule.alt_count()) return false;
+		Span<Elem> elems = m_grammar.subs(m_grammar.alts(rule)[0]);
+		if (1 != elems.size()) return false;
+		Elem &elem = elems[0];
+		return Lookahead::NONE == elem.lookahead()
+			&& (QuantifierType::ZERO_PLUS == elem.quantifier() || QuantifierType::ONE_PLUS == elem.quantifier());
+	}
+
+	// ------------------------------------------------------------------------
+	// whether the %skip rule is one character class, repeated, that only
+	// matches single bytes; if so, sets bits to the bytes it matches
+	bool skip_fused(uint32_t bits[8])
+	{
+		Rule &rule = m_grammar.rule(m_skip_rule);
+		if (RuleMod::OPERATORS == rule.mod() || 1 != rule.alt_count()) return false;
+		Span<Elem> elems = m_grammar.subs(m_grammar.alts(rule)[0]);
+		if (1 != elems.size()) return false;
+		Elem &elem = elems[0];
+		if (ElemType::CH_CLASS != elem.type() || Lookahead::NONE != elem.lookahead()
+			|| StrPool::NO_STR != elem.capture_id()
+			|| (QuantifierType::ZERO_PLUS != elem.quantifier() && QuantifierType::ONE_PLUS != elem.quantifier()))
+		{
+			return false;
+		}
+		ChClass cc = m_grammar.ch_class(elem);
+		if (cc.negate_all) return false;
+		int32_t n_bytes = m_grammar.bytes() ? 0x100 : 0x80;
+		for (auto &range : cc.pos)
+		{
+			if (range.second >= n_bytes) return false;
+		}
+		for (int32_t w = 0; w < 8; w++) bits[w] = 0;
+		for (int32_t ch = 0; ch < n_bytes; ch++)
+		{
+			if (cc.matches(ch)) bits[ch >> 5] |= 1u << (ch & 31);
+		}
 		return true;
 	}
 
-// private methods
-private:
 	// ------------------------------------------------------------------------
-	// ws discard : [ \n\r\t]*;
-	// parse and discard whitespace
-	void parse_ws()
+	// skip(), run before each element of rules that are not lexical: one
+	// loop over a byte table if the skip rule allows, else its check_*()
+	// function; the span of the last skip is kept, so calls back to back,
+	// or again after backtracking, return at once
+	//
+	// NOTE: assumes the skip rule matches nothing more where it just ended,
+	//       as a repetition like [ \t\n]* or (ws | comment)* does; check_rules()
+	//       rejects skip rules that are not such a repetition
+	//
+	// the table loop is scalar: skips are mostly a few bytes, too short to
+	// gain from the 16-byte SSE2 compares StructuralIndex.h runs over blocks
+	void print_skip()
 	{
-		if (SCC_DEBUG) eprintln("parse_ws");
-		for (;;)
+		const std::string &name = m_grammar.name(m_skip_rule);
+		uint32_t bits[8];
+		bool fused = skip_fused(bits);
+		m_out.prints(
+R"foo(
+	// where the last skip() started and ended
+	uint32_t m_skip_from = 0xffffffff;
+	uint32_t m_skip_to = 0xffffffff;
+	uint32_t m_skip_line = 1;
+	uint32_t m_skip_col = 1;
+
+)foo");
+		m_out.println("\t// move past what the %skip rule '", name, "' matches");
+		m_out.prints(
+R"foo(	void skip()
+	{
+		if (m_pos == m_skip_to) return;
+		if (m_pos == m_skip_from)
 		{
-			char ch = m_text[m_pos];
-			if (ch == ' ' || ch == '\t' || ch == '\r')
+			m_pos = m_skip_to;
+			m_line = m_skip_line;
+			m_col = m_skip_col;
+			return;
+		}
+)foo");
+		// fill() skips from every position, and from inside the run a class
+		// loop last matched it ends where that did
+		if (fused && m_bottom_up)
+		{
+			m_out.prints(
+R"foo(		if (m_pos > m_skip_from && m_pos < m_skip_to)
+		{
+			m_pos = m_skip_to;
+			m_line = m_skip_line;
+			m_col = m_skip_col;
+			return;
+		}
+)foo");
+		}
+		m_out.println("\t\tm_skip_from = m_pos;");
+		if (fused)
+		{
+			m_out.prints("\t\tstatic const uint32_t bits[8] = {");
+			for (int32_t w = 0; w < 8; w++)
 			{
-				m_pos++;
-				if (ch != '\r') m_col++;
-				continue;
+				char word[16];
+				snprintf(word, sizeof(word), "0x%08xu", bits[w]);
+				m_out.prints((w > 0 ? ", " : ""), word);
 			}
-			else if (ch == '\n')
+			m_out.println("};");
+			m_out.prints(
+R"foo(		while (m_pos < m_len)
+		{
+			unsigned char ch = (unsigned char)m_in[m_pos];
+			if (0 == ((bits[ch >> 5] >> (ch & 31)) & 1)) break;
+			if ('\n' == ch)
 			{
-				m_pos++;
 				m_line++;
-				m_col = 1;
-				continue;
+				m_col = 0;
 			}
-			break;
+			m_pos++;
+			m_col++;
 		}
+)foo");
+		}
+		else
+		{
+			m_out.println("\t\tASTNode skipped;");
+			m_out.println("\t\tcheck_", name, "(skipped);");
+		}
+		m_out.prints(
+R"foo(		m_skip_to = m_pos;
+		m_skip_line = m_line;
+		m_skip_col = m_col;
+	}
+)foo");
 	}
 
 	// ------------------------------------------------------------------------
-	// comment discard : "#" [^\r\n]*;
-	// parse and discard comment
-	void parse_comment()
+	// whether element is a character class with a Unicode property
+	bool has_property(Elem &elem)
 	{
-		if (SCC_DEBUG) eprintln("parse_comment");
-		char ch = m_text[m_pos];
-		if (ch != '#') return;
-		for (;;)
+		if (ElemType::CH_CLASS != elem.type()) return false;
+		for (auto id : m_grammar.tok_ids(elem))
 		{
-			m_pos++;
-			m_col++;
-			ch = m_text[m_pos];
-			if (ch == '\r' || ch == '\n' || ch == '\0') break;
+			if (is_property_token(m_grammar.strs().str(id))) return true;
 		}
+		return false;
 	}
 
 	// ------------------------------------------------------------------------
-	// id : [A-Za-z][0-9A-Za-z_]*;
-	// returns length on success, -1 on failure
-	int32_t parse_id()
+	// name of the generated test of a character class with Unicode
+	// properties, from a hash of the class as written (so it does not
+	// depend on other rules, which matters for -u)
+	std::string uclass_name(Elem &elem)
 	{
-		if (SCC_DEBUG) eprintln("parse_id");
-		int32_t len = 0;
-		char ch = m_text[m_pos];
-		if (!((ch >= 'A' && ch <= 'Z') || (ch >= 'a' && ch <= 'z'))) return -1;
-		m_pos++;
-		m_col++;
-		len++;
-		for (;;)
+		uint64_t hash = FNV_OFFSET;
+		for (auto id : m_grammar.tok_ids(elem)) hash = fnv1a(m_grammar.strs().str(id), hash);
+		char buf[17];
+		snprintf(buf, sizeof(buf), "%016llx", (unsigned long long)hash);
+		return std::string("uclass_") + buf;
+	}
+
+	// ------------------------------------------------------------------------
+	// one test per distinct character class with Unicode properties
+	void print_uclasses()
+	{
+		std::vector<std::string> names;
+		for (auto &rule : m_grammar.rules())
 		{
-			ch = m_text[m_pos];
-			if (ch == '_' || (ch >= '0' && ch <= '9')
-			|| (ch >= 'A' && ch <= 'Z') || (ch >= 'a' && ch <= 'z'))
+			for (auto &alt : m_grammar.alts(rule)) print_uclasses(alt, names);
+		}
+	}
+
+	void print_uclasses(Elem &elem, std::vector<std::string> &names)
+	{
+		if (has_property(elem))
+		{
+			std::string name = uclass_name(elem);
+			if (std::find(names.begin(), names.end(), name) == names.end())
 			{
-				m_pos++;
-				m_col++;
-				len++;
-				continue;
+				names.push_back(name);
+				print_uclass(elem, name);
 			}
-			return len;
 		}
+		for (auto &sub_elem : m_grammar.subs(elem)) print_uclasses(sub_elem, names);
 	}
 
 	// ------------------------------------------------------------------------
-	// alts : alt (ws "|" ws alt)*;
-	// returns length on success, -1 on failure
-	int32_t parse_alts(std::vector<Elem> &elems)
+	// membership test of a character class as three table lookups, by code
+	// point bits 20-12, 11-8 and 7-0, however many ranges the class has:
+	// blocks of 256 code points are bitmaps, and identical blocks (and runs
+	// of 16 block numbers) are stored once
+	void print_uclass(Elem &elem, const std::string &name)
 	{
-		if (SCC_DEBUG) eprintln("parse_alts");
-		int32_t len = 0;
-		bool trailing_bar;
-		while (m_text[m_pos] != '\0')
+		const int32_t N_CODE_POINTS = 0x110000;
+		ChClass cc = m_grammar.ch_class(elem);
+		std::vector<bool> pos(N_CODE_POINTS, false);
+		std::vector<bool> neg(N_CODE_POINTS, false);
+		for (auto &range : cc.pos)
 		{
-			Elem elem_alt(ElemType::ALT);
-			int32_t len_el = parse_alt(elem_alt.sub_elems());
-			if (-1 == len_el) break;
-			len += len_el;
-			trailing_bar = false;
-			elems.push_back(elem_alt);
-
-			parse_ws();
+			for (int32_t ch = range.first; ch <= range.second && ch < N_CODE_POINTS; ch++) pos[ch] = true;
+		}
+		for (auto &range : cc.neg)
+		{
+			for (int32_t ch = range.first; ch <= range.second && ch < N_CODE_POINTS; ch++) neg[ch] = true;
+		}
 
-			char ch = m_text[m_pos];
-			if (ch == '|')
+		std::vector<std::vector<uint32_t>> blocks;
+		std::map<std::vector<uint32_t>, uint32_t> block_ids;
+		std::vector<std::vector<uint32_t>> chunks;
+		std::map<std::vector<uint32_t>, uint32_t> chunk_ids;
+		std::vector<uint32_t> stage0;
+		for (int32_t chunk_start = 0; chunk_start < N_CODE_POINTS; chunk_start += 0x1000)
+		{
+			std::vector<uint32_t> chunk;
+			for (int32_t block_start = chunk_start; block_start < chunk_start + 0x1000; block_start += 0x100)
 			{
-				trailing_bar = true;
-				m_pos++;
-				m_col++;
-				len++;
+				std::vector<uint32_t> block(8, 0);
+				for (int32_t ch = block_start; ch < block_start + 0x100; ch++)
+				{
+					bool match = pos[ch] && !neg[ch];
+					if (match != cc.negate_all) block[(ch >> 5) & 7] |= 1u << (ch & 31);
+				}
+				auto it = block_ids.find(block);
+				if (it == block_ids.end())
+				{
+					it = block_ids.insert(std::make_pair(block, (uint32_t)blocks.size())).first;
+					blocks.push_back(block);
+				}
+				chunk.push_back(it->second);
+			}
+			auto it = chunk_ids.find(chunk);
+			if (it == chunk_ids.end())
+			{
+				it = chunk_ids.insert(std::make_pair(chunk, (uint32_t)chunks.size())).first;
+				chunks.push_back(chunk);
+			}
+			stage0.push_back(it->second);
+		}
 
-				parse_ws();
-				continue;
+		const char *type0 = (chunks.size() > 256) ? "uint16_t" : "uint8_t";
+		const char *type1 = (blocks.size() > 256) ? "uint16_t" : "uint8_t";
+		m_out.println("");
+		m_out.println("\t//", m_grammar.elem_to_string(elem));
+		m_out.println("\tstatic bool ", name, "(int32_t ch)");
+		m_out.println("\t{");
+		m_out.println("\t\tstatic const ", type0, " stage0[", (uint32_t)stage0.size(), "] = {");
+		for (size_t i = 0; i < stage0.size(); i += 16)
+		{
+			m_out.prints("\t\t\t");
+			for (size_t j = i; j < i + 16 && j < stage0.size(); j++) m_out.prints((j > i ? ", " : ""), stage0[j]);
+			m_out.println(",");
+		}
+		m_out.println("\t\t};");
+		m_out.println("\t\tstatic const ", type1, " stage1[][16] = {");
+		for (auto &chunk : chunks)
+		{
+			m_out.prints("\t\t\t{");
+			for (size_t j = 0; j < chunk.size(); j++) m_out.prints((j > 0 ? ", " : ""), chunk[j]);
+			m_out.println("},");
+		}
+		m_out.println("\t\t};");
+		m_out.println("\t\tstatic const uint32_t stage2[][8] = {");
+		for (auto &block : blocks)
+		{
+			m_out.prints("\t\t\t{");
+			for (size_t w = 0; w < block.size(); w++)
+			{
+				char word[16];
+				snprintf(word, sizeof(word), "0x%08xu", block[w]);
+				m_out.prints((w > 0 ? ", " : ""), word);
 			}
-			break;
+			m_out.println("},");
 		}
-		if (len <= 0 || trailing_bar) return -1;
-		return len;
+		m_out.println("\t\t};");
+		m_out.println("\t\treturn ch >= 0 && ch < 0x110000");
+		m_out.println("\t\t\t&& ((stage2[stage1[stage0[ch >> 12]][(ch >> 8) & 15]][(ch >> 5) & 7] >> (ch & 31)) & 1);");
+		m_out.println("\t}");
 	}
 
 	// ------------------------------------------------------------------------
-	// alt : elem (ws elem)*;
-	// returns length on success, -1 on failure
-	int32_t parse_alt(std::vector<Elem> &elems)
+	// reparse(), for parsers generated with -i
+	void print_reparse_api()
 	{
-		if (SCC_DEBUG) eprintln("parse_alt ", m_pos);
-		int32_t len = 0;
-		while (m_text[m_pos] != '\0')
-		{
-			int32_t len_el = parse_element(elems);
-			if (len_el <= 0) break;
-			len += len_el;
+		m_out.prints(
+R"foo(	// parse again after an edit of the text root_node was parsed from:
+	// removed bytes at pos were replaced by inserted ones, and this parser
+	// is over the new text. Nodes of rules the edit cannot have changed are
+	// moved over from root_node, shifted to their new positions, instead of
+	// being parsed again, so the work is about that of parsing the edited
+	// region. root_node is then the new tree, as from parse(). For several
+	// edits, call once per edit or once for a span covering them all
+	int32_t reparse(ASTNode &root_node, uint32_t pos, uint32_t removed, uint32_t inserted)
+	{
+		m_old = std::move(root_node);
+		root_node = ASTNode(m_old.pos(), m_old.line(), m_old.col(), m_old.text(), m_old.rule_id());
+		m_edit_pos = pos;
+		m_edit_removed = removed;
+		m_edit_inserted = inserted;
+		m_reusing = true;
+		int32_t retval = parse(root_node);
+		m_reusing = false;
+		m_old.clear();
+		return retval;
+	}
 
-			parse_ws();
-		}
-		if (len <= 0) return -1;
-		return len;
+)foo");
 	}
 
 	// ------------------------------------------------------------------------
-	// elem mergeup: (group | id | ch_class | string) [?*+]?;
-	// returns length on success, -1 on failure
-	int32_t parse_element(std::vector<Elem> &elems)
+	// state and helpers of reparse()
+	//
+	// parse_*() of a rule whose node can be reused (see reuses()) records in
+	// it where the match ended and how far the parser read, which is the
+	// farthest start of an element (after skip()) or end of a match, plus
+	// READ_AHEAD for the bytes an element looks at past its start, or past
+	// the end of the input if a scan ran into it. A node is kept if that
+	// span lies before the edit, or if it starts after it, as a rule's match
+	// depends only on the input from where it starts
+	void print_reuse()
 	{
-		if (SCC_DEBUG) eprintln("parse_element");
-
-		int32_t len = 0;
-		while (m_text[m_pos] != ';' && m_text[m_pos] != '\0')
+		m_out.println("");
+		m_out.println("\t// bytes an element may read past where it starts: the longest literal,");
+		m_out.println("\t// operator or lazy comment start, and at least a UTF-8 character");
+		m_out.println("\tstatic const uint32_t READ_AHEAD = ", read_ahead(), ";");
+		m_out.prints(
+R"foo(	// farthest position read since the innermost reusable rule started
+	uint32_t m_reach = 0;
+	// tree before the edit and the edit, while in reparse()
+	ASTNode m_old;
+	bool m_reusing = false;
+	uint32_t m_edit_pos = 0;
+	uint32_t m_edit_removed = 0;
+	uint32_t m_edit_inserted = 0;
+
+	// node of rule rule_id at m_pos in the tree before the edit that the
+	// edit cannot have changed, or nullptr
+	ASTNode *reusable(uint32_t rule_id)
+	{
+		// position in the text before the edit
+		uint32_t pos = m_pos;
+		if (pos >= m_edit_pos + m_edit_inserted) pos = pos - m_edit_inserted + m_edit_removed;
+		else if (pos >= m_edit_pos) return nullptr;
+		ASTNode *parent = &m_old;
+		for (;;)
 		{
-			int32_t len_item;
-			for (int32_t i = 0; i < 1; i++)
+			std::vector<ASTNode> &children = parent->children();
+			auto it = std::upper_bound(children.begin(), children.end(), pos,
+				[](uint32_t p, ASTNode &child) { return p < child.pos(); });
+			if (children.begin() == it) return nullptr;
+			// nodes starting at pos, outermost last
+			for (auto at = it; at != children.begin() && pos == (at - 1)->pos(); at--)
 			{
-				len_item = parse_group(elems);
+				ASTNode &child = *(at - 1);
+				if (rule_id != child.rule_id() || 0 == child.reach() || ASTNode::MOVED == child.reach()) continue;
+				if (pos >= m_edit_pos || child.reach() <= m_edit_pos) return &child;
+			}
+			parent = &*(it - 1);
+			if (0 != parent->reach() && pos > parent->end()) return nullptr;
+		}
+	}
+
+	// add old, found by reusable(), to node as the match at m_pos and move
+	// past it
+	int32_t reuse(ASTNode &node, ASTNode &old)
+	{
+		old.shift(m_pos - old.pos(), m_line - old.line(), m_col - old.col());
+		m_pos = old.end();
+		m_line = old.end_line();
+		m_col = old.end_col();
+		if (old.reach() > m_reach) m_reach = old.reach();
+		if (m_pos > m_pos_ok)
+		{
+			m_pos_ok = m_pos;
+			m_line_ok = m_line;
+			m_col_ok = m_col;
+		}
+		node.add_child(std::move(old));
+		old.set_reach(ASTNode::MOVED);
+		return RET_OK;
+	}
+)foo");
+	}
+
+	// ------------------------------------------------------------------------
+	// READ_AHEAD of print_reuse()
+	uint32_t read_ahead()
+	{
+		size_t len = 4;
+		for (auto &rule : m_grammar.rules())
+		{
+			for (auto &alt : m_grammar.alts(rule)) longest_string(alt, len);
+			for (auto &level : m_grammar.op_levels(rule))
+			{
+				for (uint32_t i = 0; i < level.tok_count; i++)
+				{
+					len = std::max(len, unescape_string(m_grammar.tok(level, i)).size());
+				}
+			}
+		}
+		len = std::max(len, m_grammar.lazy_comment().size());
+		return (uint32_t)len;
+	}
+
+	// ------------------------------------------------------------------------
+	// raise len to the length of the longest string in element or its
+	// sub-elements
+	void longest_string(Elem &elem, size_t &len)
+	{
+		if (ElemType::STRING == elem.type())
+		{
+			len = std::max(len, unescape_string(m_grammar.tok(elem, 0)).size());
+		}
+		for (auto &sub_elem : m_grammar.subs(elem)) longest_string(sub_elem, len);
+	}
+
+	// ------------------------------------------------------------------------
+	// whether parse_*() of rule can take its node from the tree before an
+	// edit (see print_reuse()): the rule builds its own node, as parsed
+	bool reuses(Rule &rule)
+	{
+		return m_incremental && !m_recognizer && !m_no_tree && RuleMod::NONE == rule.mod()
+			&& !collapses(rule) && Rule::NO_NAME == rule.action_id();
+	}
+
+	// ------------------------------------------------------------------------
+	// set_threads(), for parsers generated with -b
+	void print_fill_api()
+	{
+		m_out.prints(
+R"foo(	// threads parse() fills the table with (default: one per core); 1
+	// fills it on the calling thread
+	void set_threads(uint32_t threads) { m_threads = (threads > 0) ? threads : 1; }
+
+)foo");
+	}
+
+	// ------------------------------------------------------------------------
+	// the table of -b and fill(), which fills it before parse() builds the
+	// tree
+	//
+	// memo(rule_id, pos) is the length rule_id matches at pos, or -1. fill()
+	// fills it by the groups order_fill() found: a rule that does not call
+	// itself, directly or not, depends only on columns already filled, so
+	// its column is filled for all positions at once, split over threads; a
+	// group of rules calling each other is filled position by position from
+	// the end, as calls after the start of a match read later positions.
+	// parse_*() then only descends into rules where they match
+	//
+	// a repetition is matched from every position it passes through, so
+	// where its loop ends is kept for each (in m_reps) and not walked again
+	void print_fill()
+	{
+		m_out.println("");
+		m_out.println("\t// repetitions whose loops fill_*() keeps the ends of");
+		m_out.println("\tstatic const uint32_t N_REPS = ", m_n_reps, ";");
+		m_out.prints(
+R"foo(	// table of fill(), N_RULES columns of len() + 1 positions
+	std::vector<int32_t> m_memo_store;
+	int32_t *m_memo = nullptr;
+	// per repetition and position where its loop from there ends, plus 1,
+	// or 0 if not known yet
+	std::vector<uint32_t> m_reps_store;
+	uint32_t *m_reps = nullptr;
+	// positions of the loops being walked
+	std::vector<uint32_t> m_rep_walk;
+	// positions this parser fills, the only ones whose m_reps it uses
+	uint32_t m_fill_from = 0;
+	uint32_t m_fill_to = 0;
+	uint32_t m_threads = (std::thread::hardware_concurrency() > 0) ? std::thread::hardware_concurrency() : 1;
+	// fewest positions per thread worth starting one for
+	static const uint32_t FILL_MIN = 1 << 14;
+
+	typedef void (ParserT::*FillRule)(uint32_t pos);
+
+	// worker of fill_columns() filling positions from to to of parent's
+	// table, reading a copy of its input (and its structural index)
+	ParserT(const ParserT &parent, uint32_t from, uint32_t to)
+)foo");
+		const char *index_init = indexed() ? "m_index(parent.m_index), " : "";
+		m_out.println("\t\t: m_in(parent.m_in), ", index_init, "m_memo(parent.m_memo), m_reps(parent.m_reps), m_fill_from(from), m_fill_to(to)");
+		m_out.prints(
+R"foo(	{
+		m_len = m_in.len();
+	}
+
+	// ------------------------------------------------------------------------
+	int32_t &memo(uint32_t rule_id, uint32_t pos) { return m_memo[(size_t)rule_id * (m_len + 1) + pos]; }
+
+	// ------------------------------------------------------------------------
+	// match of rule_id at m_pos as found in the table; only the position and
+	// column move on, as fill_*() and predicates do not need the line
+	int32_t memo_match(uint32_t rule_id)
+	{
+		int32_t len = memo(rule_id, m_pos);
+		if (len < 0) return RET_FAIL;
+		m_pos += len;
+		m_col += len;
+		return RET_OK;
+	}
+
+	// ------------------------------------------------------------------------
+	// whether the loop of repetition rep from m_pos was walked before; if so,
+	// move to where it ended (the line is not tracked, as in memo_match())
+	bool rep_known(uint32_t rep)
+	{
+		if (m_pos < m_fill_from || m_pos >= m_fill_to) return false;
+		uint32_t end = m_reps[(size_t)rep * (m_len + 1) + m_pos];
+		if (0 == end) return false;
+		m_col += end - 1 - m_pos;
+		m_pos = end - 1;
+		return true;
+	}
+
+	// ------------------------------------------------------------------------
+	// the loop of repetition rep ended at m_pos from every position walked
+	// since m_rep_walk held walk ones
+	void rep_walked(uint32_t rep, size_t walk)
+	{
+		for (size_t i = walk; i < m_rep_walk.size(); i++)
+		{
+			uint32_t pos = m_rep_walk[i];
+			if (pos >= m_fill_from && pos < m_fill_to) m_reps[(size_t)rep * (m_len + 1) + pos] = m_pos + 1;
+		}
+		m_rep_walk.resize(walk);
+	}
+
+	// ------------------------------------------------------------------------
+	// fill the columns of rules that only depend on columns filled before;
+	// with several threads, each fills a run of positions with a worker
+	// parser of its own
+	void fill_columns(std::initializer_list<FillRule> fill_rules)
+	{
+		uint32_t n_pos = (uint32_t)m_len + 1;
+		uint32_t n_threads = m_threads;
+		if (n_threads > n_pos / FILL_MIN) n_threads = n_pos / FILL_MIN;
+		if (n_threads <= 1)
+		{
+			for (auto fill_rule : fill_rules)
+			{
+				for (uint32_t pos = 0; pos < n_pos; pos++) (this->*fill_rule)(pos);
+			}
+			return;
+		}
+		std::vector<std::thread> workers;
+		for (uint32_t t = 0; t < n_threads; t++)
+		{
+			uint32_t from = (uint32_t)((uint64_t)n_pos * t / n_threads);
+			uint32_t to = (uint32_t)((uint64_t)n_pos * (t + 1) / n_threads);
+			workers.push_back(std::thread([this, &fill_rules, from, to]()
+			{
+				ParserT worker(*this, from, to);
+				for (auto fill_rule : fill_rules)
+				{
+					for (uint32_t pos = from; pos < to; pos++) (worker.*fill_rule)(pos);
+				}
+			}));
+		}
+		for (auto &worker : workers) worker.join();
+	}
+
+	// ------------------------------------------------------------------------
+	void fill()
+	{
+		m_memo_store.assign((size_t)N_RULES * (m_len + 1), -1);
+		m_memo = m_memo_store.data();
+		m_reps_store.assign((size_t)N_REPS * (m_len + 1), 0);
+		m_reps = m_reps_store.data();
+		m_fill_from = 0;
+		m_fill_to = (uint32_t)m_len + 1;
+)foo");
+		CodeWriter::Indent tabs2(2), tabs3(3);
+		std::vector<bool> in_batch(m_grammar.rules().size(), false);
+		std::vector<uint32_t> batch;
+		std::vector<uint32_t> callees;
+		// runs of single rules not calling each other share one pass
+		auto flush_batch = [&]()
+		{
+			if (batch.empty()) return;
+			m_out.prints(tabs2, "fill_columns({");
+			for (size_t i = 0; i < batch.size(); i++)
+			{
+				m_out.prints((i > 0 ? ", " : ""), "&ParserT::fill_", m_grammar.name(batch[i]));
+			}
+			m_out.println("});");
+			for (auto rule_id : batch) in_batch[rule_id] = false;
+			batch.clear();
+		};
+		for (auto &group : m_fill_groups)
+		{
+			if (!group.recursive)
+			{
+				uint32_t rule_id = group.rules[0];
+				callees.clear();
+				rule_callees(rule_id, callees);
+				for (auto callee_id : callees)
+				{
+					if (in_batch[callee_id]) flush_batch();
+				}
+				batch.push_back(rule_id);
+				in_batch[rule_id] = true;
+				continue;
+			}
+			flush_batch();
+			m_out.println(tabs2, "for (uint32_t pos = (uint32_t)m_len + 1; pos-- > 0;)");
+			m_out.println(tabs2, "{");
+			for (auto rule_id : group.rules) m_out.println(tabs3, "fill_", m_grammar.name(rule_id), "(pos);");
+			m_out.println(tabs2, "}");
+		}
+		flush_batch();
+		m_out.println(tabs2, "m_fill_to = 0;");
+		m_out.println(tabs2, "m_pos = 0;");
+		m_out.println(tabs2, "m_line = 1;");
+		m_out.println(tabs2, "m_col = 1;");
+		m_out.println("\t}");
+
+		bool any_left_rec = false;
+		for (auto left_rec : m_left_rec) any_left_rec = any_left_rec || left_rec;
+		if (!any_left_rec) return;
+		m_out.prints(
+R"foo(
+	// match of a left-recursive rule being grown at pos, len long (-1 until
+	// the first one is found) and ending at end_line, end_col
+	struct Grow
+	{
+		uint32_t rule_id;
+		uint32_t pos;
+		int32_t len;
+		uint32_t end_line;
+		uint32_t end_col;
+	};
+	std::vector<Grow> m_grow;
+	std::vector<ASTNode *> m_seeds;
+
+	// ------------------------------------------------------------------------
+	// whether a call of rule_id at m_pos is one inside the rule's own match
+	// being grown there
+	bool growing(uint32_t rule_id)
+	{
+		return !m_grow.empty() && rule_id == m_grow.back().rule_id && m_pos == m_grow.back().pos;
+	}
+
+	// ------------------------------------------------------------------------
+	// match the innermost rule being grown as its last match: add a
+	// placeholder node, which grow() replaces with that match's node, and
+	// move past it
+	int32_t take_seed(ASTNode &node)
+	{
+		Grow &grow = m_grow.back();
+		if (grow.len < 0) return RET_FAIL;
+		node.add_child(ASTNode(m_pos, m_line, m_col, "", grow.rule_id));
+		m_pos += grow.len;
+		m_line = grow.end_line;
+		m_col = grow.end_col;
+		return RET_OK;
+	}
+
+	// ------------------------------------------------------------------------
+	// match left-recursive rule_id at m_pos, which the table says matches:
+	// run its body, grow_rule, with calls to itself here failing, then again
+	// with them matching the last match (its seed), until the match is as
+	// long as fill() found, as fill_*() grew it. Each match's node replaces
+	// the placeholders in the next, so the tree is built once
+	int32_t grow(ASTNode &node, uint32_t rule_id, int32_t (ParserT::*grow_rule)(ASTNode &node))
+	{
+		uint32_t pos = m_pos;
+		uint32_t line = m_line;
+		uint32_t col = m_col;
+		int32_t len = memo(rule_id, pos);
+		m_grow.push_back(Grow{rule_id, pos, -1, line, col});
+		ASTNode seed;
+		ASTNode step;
+		for (;;)
+		{
+			step.clear();
+			int32_t ok = (this->*grow_rule)(step);
+			int32_t step_len = (int32_t)(m_pos - pos);
+			if (RET_OK != ok || step_len <= m_grow.back().len || step_len > len)
+			{
+				m_grow.pop_back();
+				m_pos = pos;
+				m_line = line;
+				m_col = col;
+				return RET_FAIL;
+			}
+			if (!seed.children().empty()) plant_seed(step, seed.children()[0], rule_id, pos);
+			if (step_len == len) break;
+			seed = std::move(step);
+			m_grow.back().len = step_len;
+			m_grow.back().end_line = m_line;
+			m_grow.back().end_col = m_col;
+			m_pos = pos;
+			m_line = line;
+			m_col = col;
+		}
+		m_grow.pop_back();
+		for (auto &child : step.children()) node.add_child(std::move(child));
+		return RET_OK;
+	}
+
+	// ------------------------------------------------------------------------
+	// replace the placeholders take_seed() added under node with seed:
+	// copies of it, and the last with seed itself. Like every node before
+	// them, they start at pos
+	void plant_seed(ASTNode &node, ASTNode &seed, uint32_t rule_id, uint32_t pos)
+	{
+		m_seeds.clear();
+		find_seeds(node, rule_id, pos);
+		for (size_t i = 0; i < m_seeds.size(); i++)
+		{
+			ASTNode &placeholder = *m_seeds[i];
+			// rules collapsed into the placeholder (with -e)
+			std::vector<uint32_t> elided = placeholder.elided();
+			if (i + 1 < m_seeds.size()) placeholder = seed;
+			else placeholder = std::move(seed);
+			for (auto id : elided) placeholder.add_elided(id);
+		}
+	}
+
+	// ------------------------------------------------------------------------
+	void find_seeds(ASTNode &node, uint32_t rule_id, uint32_t pos)
+	{
+		for (auto &child : node.children())
+		{
+			if (pos != child.pos()) break;
+			if (rule_id == child.rule_id() && child.text().empty()) m_seeds.push_back(&child);
+			else find_seeds(child, rule_id, pos);
+		}
+	}
+)foo");
+	}
+
+	// ------------------------------------------------------------------------
+	// structural_index(), which builds the index of %structural characters,
+	// and split_points(), cut points it finds for parsing parts separately
+	void print_structural_api()
+	{
+		m_out.prints(
+R"foo(	// index of the %structural characters (see StructuralIndex.h), built
+	// on first use; parse() uses it to move through runs of characters and
+	// 'lazy' rule bodies
+	const StructuralIndex &structural_index()
+	{
+)foo");
+		m_out.println("\t\tstatic const char chars[] = ", c_literal(m_grammar.structural()), ";");
+		m_out.println("\t\tstatic const char quotes[] = ", c_literal(m_grammar.lazy_quotes()), ";");
+		m_out.println("\t\tstatic const char comment[] = ", c_literal(m_grammar.lazy_comment()), ";");
+		const std::string &escape = m_grammar.structural_escape();
+		uint32_t escape_char = escape.empty() ? 0 : (uint8_t)escape[0];
+		m_out.println("\t\tif (!m_index_store.built()) m_index_store.build(m_in, chars, quotes, comment, (char)", escape_char, ", ", (m_grammar.bytes() ? "false" : "true"), ");");
+		m_out.prints(
+R"foo(		m_index = &m_index_store;
+		return m_index_store;
+	}
+
+	// where the input can be cut into parts to parse separately: for each of
+	// parts - 1 evenly spaced positions, the one just past the first ch at
+	// or after it that is structural and outside strings and comments (e.g.
+	// the '\n' ending a CSV record); fewer if ch runs out
+	std::vector<uint32_t> split_points(uint32_t parts, char ch)
+	{
+		const StructuralIndex &index = structural_index();
+		std::vector<uint32_t> points;
+		for (uint32_t part = 1; part < parts; part++)
+		{
+			size_t at = index.next_structural(m_len * part / parts);
+			while (at < m_len && m_in[at] != ch) at = index.next_structural(at + 1);
+			if (at >= m_len) break;
+			if (points.empty() || at + 1 > points.back()) points.push_back((uint32_t)(at + 1));
+		}
+		return points;
+	}
+
+)foo");
+	}
+
+	// ------------------------------------------------------------------------
+	// the structural index and structural_run(), which repetitions of
+	// character classes whose stops it marks move through (see
+	// runs_structural())
+	void print_structural()
+	{
+		m_out.prints(
+R"foo(
+	// built by structural_index(); worker parsers of fill() read their
+	// parent's
+	StructuralIndex m_index_store;
+	const StructuralIndex *m_index = &m_index_store;
+
+	// ------------------------------------------------------------------------
+	// move past a run of a repeated character class, all of whose
+	// non-matching characters (stop, a 256-bit table) the index marks: from
+	// mark to mark, stepping over marked characters the class matches
+	void structural_run(const uint32_t *stop)
+	{
+		for (;;)
+		{
+			uint32_t at = (uint32_t)m_index->next_mark(m_pos);
+			m_col += at - m_pos;
+			m_pos = at;
+			if (m_pos >= m_len) return;
+			uint8_t byte = (uint8_t)m_in[m_pos];
+			if ((stop[byte >> 5] >> (byte & 31)) & 1) return;
+)foo");
+		// the index marks every byte past ASCII in UTF-8 text, so a
+		// character is decoded where one starts
+		if (!m_grammar.bytes())
+		{
+			m_out.prints(
+R"foo(			if (byte >= 0x80)
+			{
+				int32_t ch_decoded;
+				int32_t len_item = utf8_to_int32(&ch_decoded, m_in.span(m_pos, 4));
+				if (len_item <= 0) return;
+				m_pos += len_item;
+				m_col += len_item;
+				continue;
+			}
+)foo");
+		}
+		m_out.prints(
+R"foo(			m_pos++;
+			m_col++;
+			if ('\n' == byte)
+			{
+				m_line++;
+				m_col = 1;
+			}
+		}
+	}
+)foo");
+	}
+
+	// ------------------------------------------------------------------------
+	// whether the grammar declares %structural characters to index
+	bool indexed()
+	{
+		return !m_grammar.structural().empty();
+	}
+
+	// ------------------------------------------------------------------------
+	// %structural characters must be ASCII in text grammars, where runs stop
+	// at each byte past it, and not quotes or the comment start, which the
+	// index finds strings and comments by; the index covers the whole input,
+	// so rebuilding it would cost reparse() a full pass per edit
+	bool structural_ok()
+	{
+		if (m_incremental)
+		{
+			eprintln("ERROR: %structural cannot be combined with -i");
+			return false;
+		}
+		if (m_grammar.structural_escape().size() > 1 || std::string(1, '\0') == m_grammar.structural_escape())
+		{
+			eprintln("ERROR: %structural_escape must be one character (or none)");
+			return false;
+		}
+		const std::string &comment = m_grammar.lazy_comment();
+		for (char ch : m_grammar.structural())
+		{
+			uint8_t byte = (uint8_t)ch;
+			if (0 == byte || (byte >= 0x80 && !m_grammar.bytes()))
+			{
+				eprintln("ERROR: %structural character ", (uint32_t)byte, " is not ASCII (or, with %bytes, a byte but 0)");
+				return false;
+			}
+			if (std::string::npos != m_grammar.lazy_quotes().find(ch) || (!comment.empty() && comment[0] == ch))
+			{
+				eprintln("ERROR: %structural character '", ch, "' is a quote or starts the line comment");
+				return false;
+			}
+		}
+		return true;
+	}
+
+	// ------------------------------------------------------------------------
+	// whether the index marks byte, so runs can jump to it
+	bool index_marks(uint8_t byte)
+	{
+		const std::string &comment = m_grammar.lazy_comment();
+		const std::string &escape = m_grammar.structural_escape();
+		if (0 == byte) return false;
+		if ('\n' == byte || (!comment.empty() && (uint8_t)comment[0] == byte)) return true;
+		if (!escape.empty() && (uint8_t)escape[0] == byte) return true;
+		if (byte >= 0x80 && !m_grammar.bytes()) return true;
+		return std::string::npos != m_grammar.structural().find((char)byte)
+			|| std::string::npos != m_grammar.lazy_quotes().find((char)byte);
+	}
+
+	// ------------------------------------------------------------------------
+	// whether repetition elem is a run structural_run() can take: a
+	// character class all of whose non-matching characters the index marks
+	// (in text grammars, a negated class of ASCII characters), outside
+	// rules that skip() between elements and where no text leaves are kept
+	bool runs_structural(Elem &elem)
+	{
+		if (!indexed() || ElemType::CH_CLASS != elem.type() || m_skipping) return false;
+		if (keeps_text() && !m_drops_text) return false;
+		if (QuantifierType::ZERO_PLUS != elem.quantifier() && QuantifierType::ONE_PLUS != elem.quantifier()) return false;
+		if (has_property(elem)) return false;
+		ChClass cc = m_grammar.ch_class(elem);
+		if (!m_grammar.bytes())
+		{
+			if (!cc.negate_all) return false;
+			for (auto &r : cc.pos)
+			{
+				if (r.second >= 0x80) return false;
+			}
+			for (auto &r : cc.neg)
+			{
+				if (r.second >= 0x80) return false;
+			}
+		}
+		int32_t end = m_grammar.bytes() ? 0x100 : 0x80;
+		for (int32_t ch = 0; ch < end; ch++)
+		{
+			if (!cc.matches(ch) && !index_marks((uint8_t)ch)) return false;
+		}
+		return true;
+	}
+
+	// ------------------------------------------------------------------------
+	// repetition of a character class as one structural_run(), stopping at
+	// the characters it does not match
+	void print_structural_run(Elem &elem, uint32_t depth)
+	{
+		CodeWriter::Indent tabs(depth + 2);
+		if (m_rep_cache) m_next_rep++;
+		ChClass cc = m_grammar.ch_class(elem);
+		int32_t end = m_grammar.bytes() ? 0x100 : 0x80;
+		uint32_t bits[8] = {};
+		for (int32_t ch = 0; ch < end; ch++)
+		{
+			if (!cc.matches(ch)) bits[ch >> 5] |= 1u << (ch & 31);
+		}
+		m_out.println(tabs, "ok", depth - 1, " = false;");
+		m_out.println(tabs, "for (;;)");
+		m_out.println(tabs, "{");
+		print_elem_start(tabs, depth);
+		m_out.prints(tabs, "\tstatic const uint32_t stop[8] = {");
+		for (int32_t w = 0; w < 8; w++)
+		{
+			char word[16];
+			snprintf(word, sizeof(word), "0x%08xu", bits[w]);
+			m_out.prints((w > 0 ? ", " : ""), word);
+		}
+		m_out.println("};");
+		m_out.println(tabs, "\tstructural_run(stop);");
+		if (QuantifierType::ONE_PLUS == elem.quantifier())
+		{
+			m_out.println(tabs, "\tok", depth - 1, " = (m_pos > pos_start", depth - 1, ");");
+		}
+		else m_out.println(tabs, "\tok", depth - 1, " = true;");
+		m_out.println(tabs, "\tbreak;");
+		m_out.println(tabs, "}");
+	}
+
+	// ------------------------------------------------------------------------
+	// runtime choice of skipping 'lazy' rules, and expand() to parse one of
+	// their nodes later
+	void print_lazy_api()
+	{
+		m_out.prints(
+R"foo(	// skip the bodies of 'lazy' rules (the default) or parse them in full
+	void set_lazy(bool lazy) { m_lazy = lazy; }
+
+	// parse the body of a node left by a 'lazy' rule (lazy_len() > 0) and
+	// replace the node with the full one; 'lazy' rules within it are skipped
+	// in turn. The input parsed must still be in place. Returns false (node
+	// unchanged) if the body does not match the rule
+	bool expand(ASTNode &node)
+	{
+		if (0 == node.lazy_len()) return true;
+		uint32_t pos = m_pos;
+		uint32_t line = m_line;
+		uint32_t col = m_col;
+		m_pos = node.pos();
+		m_line = node.line();
+		m_col = node.col();
+		ASTNode parent;
+		int32_t retval = RET_FAIL;
+		m_expand_next = true;
+		switch (node.rule_id())
+		{
+)foo");
+		for (uint32_t rule_id = 0; rule_id < m_grammar.rules().size(); rule_id++)
+		{
+			Rule &rule = m_grammar.rule(rule_id);
+			if (RuleMod::LAZY != rule.mod()) continue;
+			m_out.println("\t\t\tcase ", rule_id, ": retval = parse_", m_grammar.name(rule), "(parent); break;");
+		}
+		m_out.prints(
+R"foo(		}
+		m_expand_next = false;
+		bool ok = RET_OK == retval && m_pos == node.pos() + node.lazy_len()
+			&& 1 == parent.children().size();
+		if (ok) node = std::move(parent.children()[0]);
+		m_pos = pos;
+		m_line = line;
+		m_col = col;
+		return ok;
+	}
+
+)foo");
+	}
+
+	// ------------------------------------------------------------------------
+	// delimiter-balancing scan that 'lazy' rules skip their bodies with
+	//
+	// quote characters and the line comment start are given as byte lists
+	// so any grammar text can be emitted as is
+	void print_lazy_scan()
+	{
+		m_out.prints(
+R"foo(
+	// skip 'lazy' rule bodies, unless the next one is being expanded
+	bool m_lazy = true;
+	bool m_expand_next = false;
+
+	// move past the region from the open delimiter at m_pos to its matching
+	// close, stepping over quoted strings and line comments; false (without
+	// moving) if the region is not closed
+	bool lazy_skip(unsigned char open, unsigned char close)
+	{
+)foo");
+		m_out.prints("\t\tstatic const unsigned char quotes[] = {");
+		for (unsigned char ch : m_grammar.lazy_quotes()) m_out.prints((uint32_t)ch, ", ");
+		m_out.println("0};");
+		m_out.prints("\t\tstatic const unsigned char comment[] = {");
+		for (unsigned char ch : m_grammar.lazy_comment()) m_out.prints((uint32_t)ch, ", ");
+		m_out.println("0};");
+		m_out.prints(
+R"foo(		const size_t comment_len = strlen((const char *)comment);
+		// byte i past m_pos
+		auto text = [this](uint32_t i) { return (unsigned char)m_in[m_pos + i]; };
+		if (text(0) != open) return false;
+)foo");
+		if (indexed() && "\\" == m_grammar.structural_escape()) print_lazy_index_scan();
+		m_out.prints(
+R"foo(		// bytes the scan stops at; runs of other bytes are skipped in a
+		// tight loop
+		bool stop[256] = {};
+		stop[0] = stop['\n'] = stop[open] = stop[close] = stop[comment[0]] = true;
+		for (const unsigned char *q = quotes; *q != 0; q++) stop[*q] = true;
+		uint32_t i = 0;
+		uint32_t depth = 0;
+		uint32_t lines = 0;
+		uint32_t line_start = 0;
+		for (;;)
+		{
+			while (!stop[text(i)]) i++;
+			unsigned char ch = text(i);
+			if (0 == ch && m_pos + i >= m_len) return false;
+			if ('\n' == ch)
+			{
+				lines++;
+				line_start = ++i;
+			}
+			else if (open == ch)
+			{
+				depth++;
+				i++;
+			}
+			else if (close == ch)
+			{
+				i++;
+				if (0 == --depth) break;
+			}
+			else if (comment_len > 0 && m_len - m_pos - i >= comment_len
+				&& 0 == memcmp(m_in.span(m_pos + i, comment_len), comment, comment_len))
+			{
+				while (m_pos + i < m_len && text(i) != '\n') i++;
+			}
+			else if (0 != ch && nullptr != strchr((const char *)quotes, ch))
+			{
+				for (i++; m_pos + i < m_len && text(i) != ch; i++)
+				{
+					if ('\\' == text(i) && m_pos + i + 1 < m_len) i++;
+					if ('\n' == text(i))
+					{
+						lines++;
+						line_start = i + 1;
+					}
+				}
+				if (m_pos + i >= m_len) return false;
+				i++;
+			}
+			else i++;
+		}
+		m_pos += i;
+		if (lines > 0)
+		{
+			m_line += lines;
+			m_col = 1 + i - line_start;
+		}
+		else m_col += i;
+		return true;
+	}
+)foo");
+	}
+
+	// ------------------------------------------------------------------------
+	// lazy_skip() from structural character to structural character, where
+	// the index holds the delimiters and agrees the open one is outside
+	// strings and comments; with '\\' escapes the index finds those as the
+	// scan below does, so from there on the two agree
+	void print_lazy_index_scan()
+	{
+		m_out.prints(
+R"foo(		if (m_index->structural(m_pos) && m_index->structural_char(open) && m_index->structural_char(close))
+		{
+			uint32_t depth = 0;
+			for (size_t at = m_pos; at < m_len; at = m_index->next_structural(at + 1))
+			{
+				unsigned char ch = (unsigned char)m_in[at];
+				if (open == ch) depth++;
+				else if (close == ch && 0 == --depth)
+				{
+					size_t end = at + 1;
+					size_t line_start = m_pos;
+					uint32_t lines = m_in.newlines(m_pos, end, line_start);
+					if (lines > 0)
+					{
+						m_line += lines;
+						m_col = 1 + (uint32_t)(end - line_start);
+					}
+					else m_col += (uint32_t)(end - m_pos);
+					m_pos = (uint32_t)end;
+					return true;
+				}
+			}
+			return false;
+		}
+)foo");
+	}
+
+	// ------------------------------------------------------------------------
+	// start of parse_*() of a 'lazy' rule: unless its node is being expanded,
+	// skip the rule's balanced region and add a node with no children and
+	// the region's length in its place
+	void print_lazy_skip(uint32_t rule_id)
+	{
+		Rule &rule = m_grammar.rule(rule_id);
+		CodeWriter::Indent tabs2(2), tabs3(3), tabs4(4);
+		char open, close;
+		lazy_delims(rule, open, close);
+		m_out.println(tabs2, "if (m_lazy && !m_expand_next)");
+		m_out.println(tabs2, "{");
+		m_out.println(tabs3, "ASTNode astn0(m_pos, m_line, m_col, \"", m_grammar.name(rule), "\", ", rule_id, ");");
+		if (m_incremental)
+		{
+			// an unclosed region was scanned to the end of the input
+			m_out.println(tabs3, "if (!lazy_skip(", (uint32_t)(unsigned char)open, ", ", (uint32_t)(unsigned char)close, "))");
+			m_out.println(tabs3, "{");
+			m_out.println(tabs4, "if (", (uint32_t)(unsigned char)open, " == (unsigned char)m_in[m_pos] && m_reach <= m_len) m_reach = m_len + 1;");
+			m_out.println(tabs4, "return RET_FAIL;");
+			m_out.println(tabs3, "}");
+		}
+		else m_out.println(tabs3, "if (!lazy_skip(", (uint32_t)(unsigned char)open, ", ", (uint32_t)(unsigned char)close, ")) return RET_FAIL;");
+		if (!m_no_tree)
+		{
+			CodeWriter::Indent &tabs = subscribable(rule) ? tabs4 : tabs3;
+			if (subscribable(rule))
+			{
+				m_out.println(tabs3, "if (m_subscribed[", rule_id, "])");
+				m_out.println(tabs3, "{");
+			}
+			m_out.println(tabs, "astn0.set_lazy_len(m_pos - astn0.pos());");
+			m_out.println(tabs, "node.add_child(std::move(astn0));");
+			if (subscribable(rule)) m_out.println(tabs3, "}");
+		}
+		if (!m_recognizer)
+		{
+			m_out.println("#ifdef IPG_PROFILE");
+			m_out.println(tabs3, "m_prof_ok[", rule_id, "]++;");
+			m_out.println("#endif");
+		}
+		m_out.println(tabs3, "return RET_OK;");
+		m_out.println(tabs2, "}");
+		m_out.println(tabs2, "m_expand_next = false;");
+	}
+
+	// ------------------------------------------------------------------------
+	// whether rule's node is only built if subscribed
+	bool subscribable(Rule &rule)
+	{
+		return m_subscribe && !m_no_tree && builds_node(rule);
+	}
+
+	// ------------------------------------------------------------------------
+	// per-rule call and success counters, compiled in with -DIPG_PROFILE
+	void print_profile_counters()
+	{
+		m_out.prints(
+R"foo(#ifdef IPG_PROFILE
+	uint64_t prof_calls(uint32_t id) { return m_prof_calls[id]; }
+	uint64_t prof_ok(uint32_t id) { return m_prof_ok[id]; }
+
+	// write counters as "rule <name> <calls> <ok>" lines, then counters of
+	// each rule's alternatives (numbered in pre-order) as
+	// "alt <name> <index> <calls> <ok>" lines
+	void write_profile(FILE *fp)
+	{
+		for (uint32_t id = 0; id < N_RULES; id++)
+		{
+			fprintf(fp, "rule %s %llu %llu\n", rule_name(id),
+				(unsigned long long)m_prof_calls[id],
+				(unsigned long long)m_prof_ok[id]);
+		}
+		for (uint32_t id = 0; id < N_RULES; id++)
+		{
+			for (uint32_t i = 0; i < m_prof_alt_calls[id].size(); i++)
+			{
+				uint64_t ok = (i < m_prof_alt_ok[id].size()) ? m_prof_alt_ok[id][i] : 0;
+				fprintf(fp, "alt %s %u %llu %llu\n", rule_name(id), i,
+					(unsigned long long)m_prof_alt_calls[id][i],
+					(unsigned long long)ok);
+			}
+		}
+	}
+
+private:
+	uint64_t m_prof_calls[N_RULES] = {};
+	uint64_t m_prof_ok[N_RULES] = {};
+	// per alternative, grown on first use
+	std::vector<uint64_t> m_prof_alt_calls[N_RULES];
+	std::vector<uint64_t> m_prof_alt_ok[N_RULES];
+
+	void prof_alt(std::vector<uint64_t> *counts, uint32_t rule_id, uint32_t index)
+	{
+		std::vector<uint64_t> &rule_counts = counts[rule_id];
+		if (index >= rule_counts.size()) rule_counts.resize(index + 1, 0);
+		rule_counts[index]++;
+	}
+
+public:
+#endif
+)foo");
+	}
+
+	// ------------------------------------------------------------------------
+	// evaluation by rule id, used where a collapsed node may have been
+	// replaced by its child; only printed if some rule collapses
+	void print_eval_dispatch()
+	{
+		bool any = false;
+		for (auto &rule : m_grammar.rules()) any |= collapses(rule);
+		if (!any) return;
+		m_out.println("");
+		m_out.println("\tbool eval_node(ASTNode &node, EvaluationState &eval_state)");
+		m_out.println("\t{");
+		m_out.println("\t\tswitch (node.rule_id())");
+		m_out.println("\t\t{");
+		for (uint32_t rule_id = 0; rule_id < m_grammar.rules().size(); rule_id++)
+		{
+			Rule &rule = m_grammar.rule(rule_id);
+			if (!has_eval(rule)) continue;
+			m_out.println("\t\tcase ", rule_id, ": return eval_", m_grammar.name(rule), "(node, eval_state);");
+		}
+		m_out.println("\t\tdefault: return true;");
+		m_out.println("\t\t}");
+		m_out.println("\t}");
+		m_out.println("");
+		m_out.println("\tstatic bool node_in(ASTNode &node, std::initializer_list<uint32_t> ids)");
+		m_out.println("\t{");
+		m_out.println("\t\tfor (auto id : ids) if (id == node.rule_id()) return true;");
+		m_out.println("\t\treturn false;");
+		m_out.println("\t}");
+	}
+
+	// ------------------------------------------------------------------------
+	// a rule called from a rule (directly or through 'mergeup' rules) and
+	// how many of its nodes one node of the calling rule can have; a max of
+	// 2 means 2 or more
+	struct TypedField
+	{
+		uint32_t rule_id;
+		uint32_t min;
+		uint32_t max;
+	};
+
+	// ------------------------------------------------------------------------
+	// fields of rule's typed node struct, in order of first use
+	std::vector<TypedField> typed_fields(uint32_t rule_id)
+	{
+		std::vector<bool> active(m_grammar.rules().size(), false);
+		std::vector<bool> recursed(m_grammar.rules().size(), false);
+		active[rule_id] = true;
+		return alts_fields(m_grammar.alts(m_grammar.rule(rule_id)), active, recursed);
+	}
+
+	// ------------------------------------------------------------------------
+	// fields of alternatives: a field missing from any of them is optional
+	std::vector<TypedField> alts_fields(Span<Elem> alts, std::vector<bool> &active,
+		std::vector<bool> &recursed)
+	{
+		std::vector<TypedField> fields;
+		bool first = true;
+		for (auto &alt : alts)
+		{
+			std::vector<TypedField> alt_fields;
+			for (auto &elem : m_grammar.subs(alt))
+			{
+				for (auto &field : elem_fields(elem, active, recursed))
+				{
+					add_field(alt_fields, field);
+				}
+			}
+			for (auto &field : fields)
+			{
+				if (nullptr == find_field(alt_fields, field.rule_id)) field.min = 0;
+			}
+			for (auto &alt_field : alt_fields)
+			{
+				TypedField *field = find_field(fields, alt_field.rule_id);
+				if (nullptr == field)
+				{
+					if (!first) alt_field.min = 0;
+					fields.push_back(alt_field);
+				}
+				else
+				{
+					field->min = std::min(field->min, alt_field.min);
+					field->max = std::max(field->max, alt_field.max);
+				}
+			}
+			first = false;
+		}
+		return fields;
+	}
+
+	// ------------------------------------------------------------------------
+	// fields of one element, after applying its quantifier
+	std::vector<TypedField> elem_fields(Elem &elem, std::vector<bool> &active,
+		std::vector<bool> &recursed)
+	{
+		std::vector<TypedField> fields;
+		if (Lookahead::NONE != elem.lookahead()) return fields;
+		if (ElemType::NAME == elem.type())
+		{
+			Rule &callee = m_grammar.rule(elem.rule());
+			if (builds_node(callee)) fields.push_back(TypedField{elem.rule(), 1, 1});
+			else if (RuleMod::MERGEUP == callee.mod())
+			{
+				// children of a merged-up rule are added in its caller's place;
+				// if it calls itself, its fields can repeat
+				if (active[elem.rule()]) recursed[elem.rule()] = true;
+				else
+				{
+					active[elem.rule()] = true;
+					fields = alts_fields(m_grammar.alts(callee), active, recursed);
+					active[elem.rule()] = false;
+					if (recursed[elem.rule()])
+					{
+						for (auto &field : fields) field.max = 2;
+					}
+				}
+			}
+		}
+		else if (ElemType::GROUP == elem.type())
+		{
+			fields = alts_fields(m_grammar.subs(elem), active, recursed);
+		}
+		for (auto &field : fields)
+		{
+			QuantifierType quant = elem.quantifier();
+			if (QuantifierType::ZERO_ONE == quant || QuantifierType::ZERO_PLUS == quant
+				|| QuantifierType::COUNT == quant)
+			{
+				field.min = 0;
+			}
+			if (QuantifierType::ZERO_PLUS == quant || QuantifierType::ONE_PLUS == quant
+				|| QuantifierType::COUNT == quant)
+			{
+				if (field.max > 0) field.max = 2;
+			}
+		}
+		return fields;
+	}
+
+	// ------------------------------------------------------------------------
+	// add field to those of a sequence
+	void add_field(std::vector<TypedField> &fields, const TypedField &field)
+	{
+		TypedField *found = find_field(fields, field.rule_id);
+		if (nullptr == found) fields.push_back(field);
+		else
+		{
+			found->min = std::min(found->min + field.min, 2u);
+			found->max = std::min(found->max + field.max, 2u);
+		}
+	}
+
+	// ------------------------------------------------------------------------
+	TypedField *find_field(std::vector<TypedField> &fields, uint32_t rule_id)
+	{
+		for (auto &field : fields)
+		{
+			if (field.rule_id == rule_id) return &field;
+		}
+		return nullptr;
+	}
+
+	// ------------------------------------------------------------------------
+	// struct name for rule's typed nodes
+	std::string typed_name(Rule &rule)
+	{
+		return "Node_" + m_grammar.name(rule);
+	}
+
+	// ------------------------------------------------------------------------
+	// field name for rule's nodes: its name, plus '_' where that would clash
+	// with a TypedNode member or C++ keyword
+	std::string field_name(Rule &rule)
+	{
+		static const char *reserved[] =
+		{
+			"rule_id", "pos", "line", "col", "text", "text_len",
+			"auto", "bool", "break", "case", "catch", "char", "class", "const",
+			"continue", "default", "delete", "do", "double", "else", "enum",
+			"explicit", "extern", "false", "float", "for", "friend", "goto",
+			"if", "inline", "int", "long", "namespace", "new", "operator",
+			"private", "protected", "public", "register", "return", "short",
+			"signed", "sizeof", "static", "struct", "switch", "template",
+			"this", "throw", "true", "try", "typedef", "typename", "union",
+			"unsigned", "using", "virtual", "void", "volatile", "while",
+		};
+		const std::string &name = m_grammar.name(rule);
+		for (auto word : reserved)
+		{
+			if (name == word) return name + "_";
+		}
+		return name;
+	}
+
+	// ------------------------------------------------------------------------
+	// type of field for nodes of rule_id; a collapsing rule's node may have
+	// been replaced by one of another rule
+	std::string field_type(uint32_t rule_id)
+	{
+		Rule &rule = m_grammar.rule(rule_id);
+		return collapses(rule) ? std::string("TypedNode") : typed_name(rule);
+	}
+
+	// ------------------------------------------------------------------------
+	// typed node structs, one per rule that builds a node, and
+	// typed_children() to walk them; the parser fills them as rules match
+	// (see print_typed_fill())
+	//
+	// a child that occurs at most once is a pointer (nullptr if absent), one
+	// that can repeat a NodeList; 'operators' rules keep their operands,
+	// operators (as text nodes) and level nodes (OpNode) in a NodeList named
+	// items
+	void print_typed_structs()
+	{
+		for (auto &rule : m_grammar.rules())
+		{
+			if (builds_node(rule)) m_out.println("struct ", typed_name(rule), ";");
+		}
+		bool any_ops = false;
+		for (uint32_t rule_id = 0; rule_id < m_grammar.rules().size(); rule_id++)
+		{
+			Rule &rule = m_grammar.rule(rule_id);
+			if (!builds_node(rule)) continue;
+			any_ops |= (RuleMod::OPERATORS == rule.mod());
+			m_out.println("");
+			m_out.println("// ", rule_str(rule));
+			m_out.println("struct ", typed_name(rule), " : TypedNode");
+			m_out.println("{");
+			if (RuleMod::OPERATORS == rule.mod())
+			{
+				m_out.println("\tNodeList<TypedNode> items;");
+			}
+			else
+			{
+				for (auto &field : typed_fields(rule_id))
+				{
+					Rule &callee = m_grammar.rule(field.rule_id);
+					if (field.max > 1)
+					{
+						m_out.println("\tNodeList<", field_type(field.rule_id), "> ", field_name(callee), ";");
+					}
+					else
+					{
+						m_out.println("\t", field_type(field.rule_id), " *", field_name(callee), " = nullptr;");
+					}
+				}
+			}
+			m_out.println("};");
+		}
+
+		CodeWriter::Indent tabs1(1), tabs2(2);
+		m_out.prints(
+R"foo(
+// typed nodes directly below tn, field by field, each list in input order
+inline void typed_children(const TypedNode *tn, std::vector<const TypedNode *> &children)
+{
+	switch (tn->rule_id)
+	{
+)foo");
+		if (any_ops)
+		{
+			m_out.println(tabs1, "case TypedNode::OP_LEVEL:");
+			m_out.println(tabs2, "for (auto item : ((const OpNode *)tn)->items) children.push_back(item);");
+			m_out.println(tabs2, "break;");
+		}
+		for (uint32_t rule_id = 0; rule_id < m_grammar.rules().size(); rule_id++)
+		{
+			Rule &rule = m_grammar.rule(rule_id);
+			if (!builds_node(rule)) continue;
+			std::vector<TypedField> fields;
+			if (RuleMod::OPERATORS != rule.mod())
+			{
+				fields = typed_fields(rule_id);
+				if (fields.empty()) continue;
+			}
+			m_out.println(tabs1, "case ", rule_id, ":");
+			m_out.println(tabs1, "{");
+			m_out.println(tabs2, "const ", typed_name(rule), " *node = (const ", typed_name(rule), " *)tn;");
+			if (RuleMod::OPERATORS == rule.mod())
+			{
+				m_out.println(tabs2, "for (auto item : node->items) children.push_back(item);");
+			}
+			for (auto &field : fields)
+			{
+				const std::string member = "node->" + field_name(m_grammar.rule(field.rule_id));
+				if (field.max > 1) m_out.println(tabs2, "for (auto item : ", member, ") children.push_back(item);");
+				else m_out.println(tabs2, "if (nullptr != ", member, ") children.push_back(", member, ");");
+			}
+			m_out.println(tabs2, "break;");
+			m_out.println(tabs1, "}");
+		}
+		m_out.prints(
+R"foo(	default:
+		break;
+	}
+}
+)foo");
+	}
+
+	// ------------------------------------------------------------------------
+	// public access to the typed nodes parse() built
+	void print_typed_api()
+	{
+		m_out.prints(
+R"foo(	// typed node of the root rule's match after parse() (see TypedAST.h),
+	// or nullptr; it and the nodes below it live in arena() until the next
+	// parse()
+	TypedNode *typed_root()
+	{
+		for (auto &item : m_typed)
+		{
+			if (nullptr != item.node) return item.node;
+		}
+		return nullptr;
+	}
+	Arena &arena() { return m_arena; }
+
+)foo");
+	}
+
+	// ------------------------------------------------------------------------
+	// how parse_*() fills typed nodes: the text and nodes matched by rules
+	// that have not ended yet wait on a stack, in input order, like values
+	// of actions do; a rule that ends takes its own off into its node, an
+	// alternate that fails drops what it added and resets the arena to
+	// before it, at the same points as it erases ASTNode children
+	void print_typed_fill()
+	{
+		m_out.prints(
+R"foo(
+	// text (node nullptr) or node matched by a rule that has not ended
+	struct TypedItem
+	{
+		TypedNode *node;
+		uint32_t pos;
+		uint32_t line;
+		uint32_t col;
+		uint32_t len;
+	};
+	Arena m_arena;
+	std::vector<TypedItem> m_typed;
+
+	// drop the items from from on and what the arena allocated since mark
+	void typed_drop(size_t from, Arena::Mark mark)
+	{
+		m_typed.resize(from);
+		m_arena.reset(mark);
+	}
+
+	// set a typed node's rule id and position, and allocate its text
+	char *typed_init(TypedNode *tn, uint32_t rule_id, uint32_t pos, uint32_t line, uint32_t col, uint32_t text_len)
+	{
+		tn->rule_id = rule_id;
+		tn->pos = pos;
+		tn->line = line;
+		tn->col = col;
+		char *text = m_arena.chars(text_len);
+		tn->text = text;
+		tn->text_len = text_len;
+		return text;
+	}
+
+	// copy the text of a text item to text, returning where it ends
+	char *typed_text(char *text, const TypedItem &item)
+	{
+		memcpy(text, m_in.span(item.pos, item.len), item.len);
+		return text + item.len;
+	}
+)foo");
+		bool any_ops = false;
+		for (auto &rule : m_grammar.rules()) any_ops |= (RuleMod::OPERATORS == rule.mod());
+		if (any_ops)
+		{
+			m_out.prints(
+R"foo(
+	// the items from from on as nodes, text items made text nodes
+	void typed_items(size_t from, NodeList<TypedNode> &items)
+	{
+		items.items = m_arena.ptrs<TypedNode>((uint32_t)(m_typed.size() - from));
+		for (size_t i = from; i < m_typed.size(); i++)
+		{
+			TypedItem &item = m_typed[i];
+			TypedNode *tn = item.node;
+			if (nullptr == tn)
+			{
+				tn = m_arena.make<TypedNode>();
+				typed_text(typed_init(tn, TypedNode::NO_RULE, item.pos, item.line, item.col, item.len), item);
+			}
+			items.items[items.size++] = tn;
+		}
+	}
+
+	// replace the items from from on with the node of the operator level
+	// named name that holds them
+	void typed_op_level(size_t from, const char *name, uint32_t pos, uint32_t line, uint32_t col)
+	{
+		OpNode *op = m_arena.make<OpNode>();
+		op->rule_id = TypedNode::OP_LEVEL;
+		op->pos = pos;
+		op->line = line;
+		op->col = col;
+		op->text = name;
+		op->text_len = (uint32_t)strlen(name);
+		typed_items(from, op->items);
+		m_typed.resize(from);
+		m_typed.push_back(TypedItem{op, pos, line, col, 0});
+	}
+)foo");
+		}
+		for (uint32_t rule_id = 0; rule_id < m_grammar.rules().size(); rule_id++)
+		{
+			if (builds_node(m_grammar.rule(rule_id))) print_typed_rule(rule_id);
+		}
+	}
+
+	// ------------------------------------------------------------------------
+	// build_*() function replacing the items of a rule's match with its
+	// typed node: one pass to size text and lists, one to fill them,
+	// switching on the rule ids of the nodes
+	void print_typed_rule(uint32_t rule_id)
+	{
+		Rule &rule = m_grammar.rule(rule_id);
+		const std::string &name = m_grammar.name(rule);
+		const std::string type = typed_name(rule);
+		CodeWriter::Indent tabs1(1), tabs2(2), tabs3(3);
+
+		// rule ids each field takes; an id claimed by an earlier field (via
+		// collapsing) is not matched again
+		std::vector<TypedField> fields;
+		if (RuleMod::OPERATORS != rule.mod()) fields = typed_fields(rule_id);
+		std::vector<std::vector<uint32_t>> field_ids;
+		std::vector<bool> claimed(m_grammar.rules().size(), false);
+		bool any_list = false;
+		bool any_field = false;
+		for (auto &field : fields)
+		{
+			std::vector<uint32_t> ids;
+			if (collapses(m_grammar.rule(field.rule_id))) ids = collapse_closure(field.rule_id);
+			else ids.push_back(field.rule_id);
+			field_ids.push_back(std::vector<uint32_t>());
+			for (auto id : ids)
+			{
+				if (claimed[id]) continue;
+				claimed[id] = true;
+				field_ids.back().push_back(id);
+			}
+			if (field_ids.back().empty()) continue;
+			any_field = true;
+			any_list |= (field.max > 1);
+		}
+
+		m_out.println("");
+		m_out.println(tabs1, "// ***TYPED*** ", rule_str(rule));
+		m_out.println(tabs1, "void build_", name, "(size_t from, uint32_t pos, uint32_t line, uint32_t col)");
+		m_out.println(tabs1, "{");
+		m_out.println(tabs2, type, " *tn = m_arena.make<", type, ">();");
+		m_out.println(tabs2, "uint32_t text_len = 0;");
+		m_out.println(tabs2, "for (size_t i = from; i < m_typed.size(); i++)");
+		m_out.println(tabs2, "{");
+		m_out.println(tabs3, "TypedItem &item = m_typed[i];");
+		m_out.println(tabs3, "if (nullptr == item.node) text_len += item.len;");
+		if (any_list)
+		{
+			m_out.println(tabs3, "else switch (item.node->rule_id)");
+			m_out.println(tabs3, "{");
+			for (size_t f = 0; f < fields.size(); f++)
+			{
+				if (fields[f].max < 2 || field_ids[f].empty()) continue;
+				print_typed_cases(tabs3, field_ids[f]);
+				m_out.println("tn->", field_name(m_grammar.rule(fields[f].rule_id)), ".size++; break;");
+			}
+			m_out.println(tabs3, "}");
+		}
+		m_out.println(tabs2, "}");
+		m_out.println(tabs2, "char *text = typed_init(tn, ", rule_id, ", pos, line, col, text_len);");
+		for (size_t f = 0; f < fields.size(); f++)
+		{
+			if (fields[f].max < 2 || field_ids[f].empty()) continue;
+			const std::string field = field_name(m_grammar.rule(fields[f].rule_id));
+			m_out.println(tabs2, "tn->", field, ".items = m_arena.ptrs<", field_type(fields[f].rule_id), ">(tn->", field, ".size);");
+			m_out.println(tabs2, "tn->", field, ".size = 0;");
+		}
+		m_out.println(tabs2, "for (size_t i = from; i < m_typed.size(); i++)");
+		m_out.println(tabs2, "{");
+		m_out.println(tabs3, "TypedItem &item = m_typed[i];");
+		m_out.println(tabs3, "if (nullptr == item.node) text = typed_text(text, item);");
+		if (any_field)
+		{
+			m_out.println(tabs3, "else switch (item.node->rule_id)");
+			m_out.println(tabs3, "{");
+			for (size_t f = 0; f < fields.size(); f++)
+			{
+				if (field_ids[f].empty()) continue;
+				const std::string field = field_name(m_grammar.rule(fields[f].rule_id));
+				const std::string node = "(" + field_type(fields[f].rule_id) + " *)item.node";
+				print_typed_cases(tabs3, field_ids[f]);
+				if (fields[f].max < 2) m_out.println("tn->", field, " = ", node, "; break;");
+				else m_out.println("tn->", field, ".items[tn->", field, ".size++] = ", node, "; break;");
+			}
+			m_out.println(tabs3, "}");
+		}
+		m_out.println(tabs2, "}");
+		if (RuleMod::OPERATORS == rule.mod()) m_out.println(tabs2, "typed_items(from, tn->items);");
+		m_out.println(tabs2, "m_typed.resize(from);");
+		m_out.println(tabs2, "m_typed.push_back(TypedItem{tn, pos, line, col, 0});");
+		m_out.println(tabs1, "}");
+	}
+
+	// ------------------------------------------------------------------------
+	// "case a: case b: " on one line, left open for the statement
+	void print_typed_cases(CodeWriter::Indent tabs, const std::vector<uint32_t> &ids)
+	{
+		m_out.prints(tabs);
+		for (auto id : ids) m_out.prints("case ", id, ": ");
+	}
+
+	// ------------------------------------------------------------------------
+	void print_eval(Rule &rule)
+	{
+		CodeWriter::Indent tabs1(1), tabs2(2), tabs3(3);
+		m_out.println("");
+		m_out.println(tabs1, "// ***RULE*** ", rule_str(rule));
+		if (m_out_of_class)
+		{
+			m_out.println("bool Evaluator::eval_", m_grammar.name(rule), "(ASTNode &node, EvaluationState &eval_state)");
+		}
+		else
+		{
+			m_out.println(tabs1, "virtual bool eval_", m_grammar.name(rule), "(ASTNode &node, EvaluationState &eval_state)");
+		}
+		m_out.println(tabs1, "{");
+		// level nodes built from the operator table do not follow the rule's
+		// elements, so the tree is left to overrides
+		if (RuleMod::OPERATORS == rule.mod())
+		{
+			m_out.println(tabs2, "return true;");
+			m_out.println(tabs1, "}");
+			return;
+		}
+		m_out.println(tabs2, "bool result = false;");
+		m_out.println(tabs2, "int c = 0;");
+		m_out.println(tabs2, "int c_prev = 0;");
+// TODO: fix this KLUDGE that handles empty elements with all children having quantifiers * or ?
+m_out.println(tabs2, "if (0 == node.children().size()) return true;");
+		m_out.println(tabs2, "for (;;)");
+		m_out.println(tabs2, "{");
+		for (auto &elem : m_grammar.alts(rule)) print_eval_elem(elem, 3);
+		m_out.println(tabs3, "break;");
+		m_out.println(tabs2, "}");
+// TODO: re-enable this check when other bugs fixed?
+		//~ m_out.println(tabs2, "fprintf(stderr, \"%d %d\\n\", c, node.children().size());");
+		//~ m_out.println(tabs2, "if (c < node.children().size()) return false;");
+		m_out.println(tabs2, "return result;");
+		m_out.println(tabs1, "}");
+	}
+
+	// ------------------------------------------------------------------------
+	// only rules with no modifier (or 'operators', 'collapse' or 'lazy') and
+	// at least one NAME type element or sub-element get an eval_*() function
+	bool has_eval(Rule &rule)
+	{
+		return builds_node(rule) && rule_has_named_elem(rule);
+	}
+
+	// ------------------------------------------------------------------------
+	// whether rule adds a node of its own to the AST (unless collapsed)
+	bool builds_node(Rule &rule)
+	{
+		if (Rule::NO_NAME != rule.action_id()) return false;
+		return RuleMod::NONE == rule.mod() || RuleMod::OPERATORS == rule.mod()
+			|| RuleMod::COLLAPSE == rule.mod() || RuleMod::LAZY == rule.mod();
+	}
+
+	// ------------------------------------------------------------------------
+	// opening and closing delimiters of a 'lazy' rule: the strings its only
+	// alternative starts and ends with; false if it has no such delimiters
+	bool lazy_delims(Rule &rule, char &open, char &close)
+	{
+		Span<Elem> alts = m_grammar.alts(rule);
+		if (1 != alts.size()) return false;
+		Span<Elem> elems = m_grammar.subs(alts[0]);
+		if (elems.size() < 2) return false;
+		Elem &first = elems[0];
+		Elem &last = elems[elems.size() - 1];
+		for (Elem *elem : {&first, &last})
+		{
+			if (ElemType::STRING != elem->type() || QuantifierType::ONE != elem->quantifier()) return false;
+			if (1 != unescape_string(m_grammar.tok(*elem, 0)).size()) return false;
+		}
+		open = unescape_string(m_grammar.tok(first, 0))[0];
+		close = unescape_string(m_grammar.tok(last, 0))[0];
+		return open != close;
+	}
+
+	// ------------------------------------------------------------------------
+	// whether parser keeps a stack of action values (recognizers keep none)
+	bool has_values() { return !m_grammar.value_type().empty() && !m_recognizer; }
+
+	// ------------------------------------------------------------------------
+	// whether the code printed fills typed nodes (recognizers fill none)
+	bool fills_typed() { return m_typed && !m_recognizer; }
+
+	// ------------------------------------------------------------------------
+	// whether the code printed keeps the text it matches, for ASTNode text
+	// leaves or typed nodes
+	bool keeps_text() { return !m_no_tree || fills_typed(); }
+
+	// ------------------------------------------------------------------------
+	// whether rule's node is replaced by its child when that is its only one
+	bool collapses(Rule &rule)
+	{
+		if (RuleMod::COLLAPSE == rule.mod()) return true;
+		return m_collapse_all && (RuleMod::NONE == rule.mod() || RuleMod::OPERATORS == rule.mod());
+	}
+
+	// ------------------------------------------------------------------------
+	// ids of rules whose node may stand where a node of collapsing rule_id is
+	// expected: its own, and that of any rule that can be its only child
+	std::vector<uint32_t> collapse_closure(uint32_t rule_id)
+	{
+		std::vector<uint32_t> ids;
+		std::vector<bool> visited(m_grammar.rules().size(), false);
+		std::vector<uint32_t> to_visit(1, rule_id);
+		visited[rule_id] = true;
+		std::vector<uint32_t> callees;
+		while (!to_visit.empty())
+		{
+			uint32_t id = to_visit.back();
+			to_visit.pop_back();
+			Rule &rule = m_grammar.rule(id);
+			// children of merged-up rules are added in their caller's place
+			if (RuleMod::MERGEUP != rule.mod()) ids.push_back(id);
+			if (RuleMod::MERGEUP != rule.mod() && id != rule_id && !collapses(rule)) continue;
+			callees.clear();
+			for (auto &elem : m_grammar.alts(rule)) collect_callees(elem, callees);
+			for (auto callee_id : callees)
+			{
+				Rule &callee = m_grammar.rule(callee_id);
+				if (visited[callee_id]) continue;
+				if (!builds_node(callee) && RuleMod::MERGEUP != callee.mod()) continue;
+				visited[callee_id] = true;
+				to_visit.push_back(callee_id);
+			}
+		}
+		std::sort(ids.begin(), ids.end());
+		return ids;
+	}
+
+	// ------------------------------------------------------------------------
+	// check if rule contains at least one named element
+	bool rule_has_named_elem(Rule &rule)
+	{
+		bool has_named_elem = false;
+		for (auto &elem : m_grammar.alts(rule))
+		{
+			has_named_elem |= elem_or_sub_has_name(elem);
+		}
+		return has_named_elem;
+	}
+
+	// ------------------------------------------------------------------------
+	// check if element or any of its child elements contain at least one node
+	// with ElemType::NAME
+	bool elem_or_sub_has_name(Elem &elem)
+	{
+		if (Lookahead::NONE != elem.lookahead()) return false;
+		if (elem.type() == ElemType::NAME
+			|| elem.type() == ElemType::STRING
+			|| elem.type() == ElemType::CH_CLASS
+			|| elem.type() == ElemType::UNTIL) return true;
+		else if (elem.type() == ElemType::ALT
+			|| elem.type() == ElemType::GROUP)
+		{
+			for (auto &sub_elem : m_grammar.subs(elem))
+			{
+				if (elem_or_sub_has_name(sub_elem)) return true;
+			}
+		}
+		return false;
+	}
+
+	// ------------------------------------------------------------------------
+	void print_eval_elem(Elem &elem, int depth)
+	{
+		CodeWriter::Indent tabs(depth);
+
+		// predicates add no nodes
+		if (Lookahead::NONE != elem.lookahead())
+		{
+			m_out.println(tabs, "// PREDICATE:", elem_str(elem));
+			return;
+		}
+
+		if (elem.type() == ElemType::NAME
+			|| elem.type() == ElemType::STRING
+			|| elem.type() == ElemType::CH_CLASS
+			|| elem.type() == ElemType::UNTIL)
+		{
+			Rule *rule = nullptr;
+			if (ElemType::NAME == elem.type()) rule = &m_grammar.rule(elem.rule());
+			// only need to print_eval() if rule contains NAME type elements or
+			// sub-elements
+			if (nullptr != rule && rule_has_named_elem(*rule))
+			{
+				const std::string &name = m_grammar.name(*rule);
+				if (builds_node(*rule))
+				{
+					// a collapsed node may have been replaced by its only child,
+					// so match any rule that can stand in and dispatch on it
+					std::string match = "node.children()[c].text() == \"" + name + "\"";
+					std::string call = "eval_" + name + "(node.children()[c], eval_state)";
+					if (collapses(*rule))
+					{
+						match = "node_in(node.children()[c], {";
+						std::vector<uint32_t> ids = collapse_closure(elem.rule());
+						for (size_t i = 0; i < ids.size(); i++)
+						{
+							if (i > 0) match += ", ";
+							match += std::to_string(ids[i]);
+						}
+						match += "})";
+						call = "eval_node(node.children()[c], eval_state)";
+					}
+m_out.println(tabs, "// \"", name, "\" has QUANTIFIER = ", (uint32_t)elem.quantifier());
+					if (QuantifierType::ONE == elem.quantifier())
+					{
+						m_out.println(tabs, "if (c >= node.children().size())");
+						m_out.println(tabs, "{");
+						m_out.println(tabs, "\tresult = false;");
+						m_out.println(tabs, "\tbreak;");
+						m_out.println(tabs, "}");
+						m_out.println(tabs, "if (", match, ")");
+						m_out.println(tabs, "{");
+						m_out.println(tabs, "\tresult = ", call, ";");
+						m_out.println(tabs, "\tif (!result) break;");
+						m_out.println(tabs, "\tc++;");
+						m_out.println(tabs, "}");
+					}
+					else if (QuantifierType::ZERO_ONE == elem.quantifier())
+					{
+						m_out.println(tabs, "if (c < node.children().size() && ", match, ")");
+						m_out.println(tabs, "{");
+						m_out.println(tabs, "\tresult = ", call, ";");
+						m_out.println(tabs, "\tif (result) c++;");
+						//~ m_out.println(tabs, "\tresult = true;");
+						m_out.println(tabs, "}");
+					}
+					// the parse already checked counts
+					else if (QuantifierType::ZERO_PLUS == elem.quantifier()
+						|| QuantifierType::COUNT == elem.quantifier())
+					{
+						m_out.println(tabs, "while (c < node.children().size() && ", match, ")");
+						m_out.println(tabs, "{");
+						m_out.println(tabs, "\tresult = ", call, ";");
+						m_out.println(tabs, "\tif (!result) break;");
+						m_out.println(tabs, "\tc++;");
+						m_out.println(tabs, "}");
+						//~ m_out.println(tabs, "result = true;");
+					}
+					else if (QuantifierType::ONE_PLUS == elem.quantifier())
+					{
+						m_out.println(tabs, "c_prev = c;");
+						//~ m_out.println(tabs, "result = false;");
+						m_out.println(tabs, "while (c < node.children().size() && ", match, ")");
+						m_out.println(tabs, "{");
+						m_out.println(tabs, "\tresult = ", call, ";");
+						m_out.println(tabs, "\tif (!result) break;");
+						m_out.println(tabs, "\tc++;");
+						m_out.println(tabs, "}");
+						m_out.println(tabs, "if (c_prev == c) break;");
+						m_out.println(tabs, "result = true;");
+					}
+					else
+					{
+						eprintln("FATAL ERROR: unsupported quantifier type '",
+							std::to_string((uint32_t)elem.quantifier()), "'");
+						exit(1);
+					}
+				}
+				// rules with an action leave a value instead of a node
+				else if (RuleMod::NONE == rule->mod() || RuleMod::COLLAPSE == rule->mod()
+					|| RuleMod::LAZY == rule->mod())
+				{
+					m_out.println(tabs, "// VALUE: ", name);
+					m_out.println(tabs, "result = true;");
+				}
+				// rules with 'discard' mod should not appear in AST, so eval
+				// code should not try to process them
+				else if (RuleMod::DISCARD == rule->mod())
+				{
+					m_out.println(tabs, "// DISCARDED: ", name);
+				}
+				// rules with 'inline' mod should not appear in AST, so eval
+				// code should not try to process them
+				else if (RuleMod::INLINE == rule->mod())
+				{
+// TODO: should be processed?
+					m_out.println(tabs, "// INLINED: ", name);
+					m_out.println(tabs, "result = true;");
+				}
+				// process child nodes as if they are children of grandparent
+				// and omit eval_*() for this rule
+				else if (RuleMod::MERGEUP == rule->mod())
+				{
+					m_out.println(tabs, "// MERGING: ", name);
+					for (auto &sub_elem : m_grammar.alts(*rule))
+					{
+						print_eval_elem(sub_elem, depth);
+					}
+				}
+				else
+				{
+					eprintln("FATAL ERROR: unsupported rule modifier '", (uint32_t)rule->mod(), "'");
+					exit(1);
+				}
+			}
+			else
+			{
+				if (elem.type() == ElemType::STRING)
+				{
+					m_out.println(tabs, "if (c < node.children().size() && node.children()[c].text() == ", c_literal(unescape_string(m_grammar.tok(elem, 0))), ")");
+					m_out.println(tabs, "{");
+					m_out.println(tabs, "\tresult = true;");
+					m_out.println(tabs, "\tc++;");
+					m_out.println(tabs, "}");
+				}
+				else
+				{
+					m_out.println(tabs, "// TODO: type = ", (uint32_t)elem.type(), ", string = ", elem_str(elem));
+				}
+			}
+		}
+		else if (elem.type() == ElemType::ALT)
+		{
+			m_out.println(tabs, "// ALT");
+			m_out.println(tabs, "while (!result)");
+			m_out.println(tabs, "{");
+			for (auto &sub_elem : m_grammar.subs(elem))
+			{
+				print_eval_elem(sub_elem, depth + 1);
+			}
+			m_out.println(tabs, "\tbreak;");
+			m_out.println(tabs, "}");
+			//~ m_out.println(tabs, "if (result) break;");
+		}
+		else if (elem.type() == ElemType::GROUP)
+		{
+			m_out.println(tabs, "// GROUP");
+			m_out.println(tabs, "result = false;");
+			if (QuantifierType::ONE == elem.quantifier())
+			{
+				m_out.println(tabs, "for (;;)");
+				m_out.println(tabs, "{");
+				for (auto &sub_elem : m_grammar.subs(elem))
+				{
+					print_eval_elem(sub_elem, depth + 1);
+				}
+				//~ m_out.println(tabs, "\tif (!result) break;");
+				m_out.println(tabs, "\tbreak;");
+				m_out.println(tabs, "}");
+			}
+			else if (QuantifierType::ZERO_ONE == elem.quantifier())
+			{
+				m_out.println(tabs, "for (;;)");
+				m_out.println(tabs, "{");
+				for (auto &sub_elem : m_grammar.subs(elem))
+				{
+					print_eval_elem(sub_elem, depth + 1);
+				}
+				//~ m_out.println(tabs, "\tresult = true;");
+				m_out.println(tabs, "\tbreak;");
+				m_out.println(tabs, "}");
+			}
+			else if (QuantifierType::ZERO_PLUS == elem.quantifier()
+				|| QuantifierType::COUNT == elem.quantifier())
+			{
+				m_out.println(tabs, "result = true;");
+				m_out.println(tabs, "while (result)");
+				m_out.println(tabs, "{");
+				m_out.println(tabs, "\tint c_loop = c;");
+				m_out.println(tabs, "\tresult = false;");
+				for (auto &sub_elem : m_grammar.subs(elem))
+				{
+					print_eval_elem(sub_elem, depth + 1);
+				}
+				// stop once an iteration consumes no children, e.g. when
+				// group has only discarded or inlined elements
+				m_out.println(tabs, "\tif (c_loop == c) break;");
+				m_out.println(tabs, "}");
+				m_out.println(tabs, "result = true;");
+			}
+			else if (QuantifierType::ONE_PLUS == elem.quantifier())
+			{
+				m_out.println(tabs, "c_prev = c;");
+				m_out.println(tabs, "while (result)");
+				m_out.println(tabs, "{");
+				m_out.println(tabs, "\tint c_loop = c;");
+				m_out.println(tabs, "\tresult = false;");
+				for (auto &sub_elem : m_grammar.subs(elem))
+				{
+					print_eval_elem(sub_elem, depth + 1);
+				}
+				m_out.println(tabs, "\tif (c_loop == c) break;");
+				m_out.println(tabs, "}");
+				m_out.println(tabs, "if (c_prev != c) result = true;");
+			}
+			else
+			{
+				eprintln("FATAL ERROR: unsupported quantifier type '",
+					std::to_string((uint32_t)elem.quantifier()), "'");
+				exit(1);
+			}
+		}
+	}
+
+	// ------------------------------------------------------------------------
+	void print_rule(uint32_t rule_id)
+	{
+		Rule &rule = m_grammar.rule(rule_id);
+		const std::string &name = m_grammar.name(rule);
+		CodeWriter::Indent tabs1(1), tabs2(2), tabs3(3);
+		m_out.println("");
+		m_out.println(tabs1, "// ***RULE*** ", rule_str(rule));
+		// a left-recursive rule's body is grow_*(), which its parse_*()
+		// calls until the match is as long as the table says
+		bool grows = m_bottom_up && !m_recognizer && m_left_rec[rule_id];
+		if (grows) print_grow_rule(rule_id);
+		const char *prefix = m_recognizer ? "check_" : (grows ? "grow_" : "parse_");
+		m_skipping = Elem::NO_RULE != m_skip_rule && !m_lexical[rule_id];
+		m_drops_text = RuleMod::DISCARD == rule.mod() || RuleMod::INLINE == rule.mod();
+		if (m_out_of_class) m_out.println(tabs1, "template<typename Input>");
+		m_out.println(tabs1, heat_attr(rule_id), "int32_t ", (m_out_of_class ? "ParserT<Input>::" : ""), prefix, name, "(ASTNode &node)");
+		m_out.println(tabs1, "{");
+		// operator tables are only compiled into climb_*(), which builds
+		// level nodes; a check_*() of the rule parses into a throwaway node
+		if (RuleMod::OPERATORS == rule.mod() && m_recognizer)
+		{
+			m_out.println(tabs2, "ASTNode astn0;");
+			m_out.println(tabs2, "return parse_", name, "(astn0);");
+			m_out.println(tabs1, "}");
+			return;
+		}
+		if (RuleMod::OPERATORS == rule.mod())
+		{
+			print_op_rule(rule_id);
+			return;
+		}
+		if (SCC_DEBUG) m_out.println(tabs2, "println(\"", prefix, name, "()\");");
+		if (!m_recognizer)
+		{
+			m_out.println("#ifdef IPG_PROFILE");
+			m_out.println(tabs2, "m_prof_calls[", rule_id, "]++;");
+			m_out.println("#endif");
+		}
+		// fill() found whether the rule matches here
+		if (m_bottom_up && !m_recognizer && !grows) m_out.println(tabs2, "if (memo(", rule_id, ", m_pos) < 0) return RET_FAIL;");
+		if (RuleMod::LAZY == rule.mod()) print_lazy_skip(rule_id);
+		if (reuses(rule))
+		{
+			m_out.println(tabs2, "if (m_reusing)");
+			m_out.println(tabs2, "{");
+			m_out.println(tabs3, "ASTNode *old = reusable(", rule_id, ");");
+			m_out.println(tabs3, "if (nullptr != old)");
+			m_out.println(tabs3, "{");
+			m_out.println("#ifdef IPG_PROFILE");
+			m_out.println(tabs3, "\tm_prof_ok[", rule_id, "]++;");
+			m_out.println("#endif");
+			m_out.println(tabs3, "\treturn reuse(node, *old);");
+			m_out.println(tabs3, "}");
+			m_out.println(tabs2, "}");
+			m_out.println(tabs2, "uint32_t reach_prev = m_reach;");
+			m_out.println(tabs2, "m_reach = m_pos;");
+		}
+		m_out.println(tabs2, "uint32_t pos_prev = m_pos;");
+		m_out.println(tabs2, "uint32_t line_prev = m_line;");
+		m_out.println(tabs2, "uint32_t col_prev = m_col;");
+		std::vector<std::string> captures;
+		for (auto &alt : m_grammar.alts(rule)) collect_captures(alt, captures);
+		for (auto &cap : captures) m_out.println(tabs2, "uint64_t cap_", cap, " = 0;");
+		if (RuleMod::MERGEUP == rule.mod())
+		{
+			m_out.println(tabs2, "ASTNode &astn0 = node;");
+		}
+		// an unsubscribed rule adds its children to node, like 'mergeup'
+		else if (subscribable(rule))
+		{
+			m_out.println(tabs2, "bool keep_prev = m_keep_text;");
+			m_out.println(tabs2, "m_keep_text = m_subscribed[", rule_id, "];");
+			m_out.println(tabs2, "ASTNode astn0_own;");
+			m_out.println(tabs2, "if (m_keep_text) astn0_own = ASTNode(m_pos, m_line, m_col, \"", name, "\", ", rule_id, ");");
+			m_out.println(tabs2, "ASTNode &astn0 = m_keep_text ? astn0_own : node;");
+		}
+		else
+		{
+			m_out.println(tabs2, "ASTNode astn0(m_pos, m_line, m_col, \"", name, "\", ", rule_id, ");");
+		}
+		m_out.println("");
+
+		print_alts(m_grammar.alts(rule));
+
+		m_out.println("");
+		print_fail_check(tabs2, fail_hint(rule_id), 0);
+		m_out.println(tabs2, "{");
+		m_out.println(tabs3, "m_pos = pos_prev;");
+		m_out.println(tabs3, "m_line = line_prev;");
+		m_out.println(tabs3, "m_col = col_prev;");
+		m_out.println(tabs2, "}");
+		// a rule with an action adds its value instead of a node
+		if (Rule::NO_NAME != rule.action_id() && has_values())
+		{
+			m_out.println(tabs2, "else");
+			m_out.println(tabs2, "{");
+			print_action(tabs3, rule);
+			m_out.println(tabs2, "}");
+		}
+		// only add to AST if discard, inline and mergeup modifications not set
+		else if (m_no_tree) {}
+		else if (RuleMod::NONE == rule.mod() || RuleMod::COLLAPSE == rule.mod()
+			|| RuleMod::LAZY == rule.mod())
+		{
+			m_out.println(tabs2, subscribable(rule) ? "else if (m_keep_text)" : "else");
+			m_out.println(tabs2, "{");
+			if (collapses(rule)) print_collapse(tabs3, rule_id);
+			else
+			{
+				if (reuses(rule))
+				{
+					m_out.println(tabs3, "astn0.set_end(m_pos, m_line, m_col, ((m_reach > m_pos) ? m_reach : m_pos) + READ_AHEAD);");
+				}
+				m_out.println(tabs3, "node.add_child(std::move(astn0));");
+			}
+			m_out.println(tabs2, "}");
+		}
+		if (fills_typed()) print_typed_end(tabs2, rule_id);
+		if (reuses(rule)) m_out.println(tabs2, "if (reach_prev > m_reach) m_reach = reach_prev;");
+		if (subscribable(rule)) m_out.println(tabs2, "m_keep_text = keep_prev;");
+		if (!m_recognizer)
+		{
+			m_out.println("#ifdef IPG_PROFILE");
+			m_out.println(tabs2, "if (ok0) m_prof_ok[", rule_id, "]++;");
+			m_out.println("#endif");
+		}
+		const char *ret_str = (RuleMod::INLINE == rule.mod()) ? "RET_INLINE" : "RET_OK";
+		m_out.println(tabs2, "if (ok0) return ", ret_str, ";");
+		m_out.println(tabs2, "else return RET_FAIL;");
+		m_out.println(tabs1, "}");
+	}
+
+	// ------------------------------------------------------------------------
+	// after rule's match: replace its typed items with its typed node, or
+	// (unless it is 'mergeup', whose items are its caller's) drop them if it
+	// builds no node
+	void print_typed_end(CodeWriter::Indent tabs, uint32_t rule_id)
+	{
+		Rule &rule = m_grammar.rule(rule_id);
+		const std::string &name = m_grammar.name(rule);
+		const char *start = (RuleMod::OPERATORS == rule.mod()) ? "astn0.pos(), astn0.line(), astn0.col()"
+			: "pos_prev, line_prev, col_prev";
+		if (RuleMod::MERGEUP == rule.mod()) return;
+		if (!builds_node(rule)) m_out.println(tabs, "if (ok0) typed_drop(n_typed0, mark0);");
+		else if (collapses(rule))
+		{
+			m_out.println(tabs, "if (ok0 && (m_typed.size() != n_typed0 + 1 || nullptr == m_typed.back().node))");
+			m_out.println(tabs, "{");
+			m_out.println(tabs, "\tbuild_", name, "(n_typed0, ", start, ");");
+			m_out.println(tabs, "}");
+		}
+		else m_out.println(tabs, "if (ok0) build_", name, "(n_typed0, ", start, ");");
+	}
+
+	// ------------------------------------------------------------------------
+	// parse_*() of a left-recursive rule for -b: a call where a match of
+	// the rule is being grown gets the match so far, any other grows one
+	void print_grow_rule(uint32_t rule_id)
+	{
+		const std::string &name = m_grammar.name(rule_id);
+		CodeWriter::Indent tabs1(1), tabs2(2);
+		if (m_out_of_class) m_out.println(tabs1, "template<typename Input>");
+		m_out.println(tabs1, "int32_t ", (m_out_of_class ? "ParserT<Input>::" : ""), "parse_", name, "(ASTNode &node)");
+		m_out.println(tabs1, "{");
+		m_out.println(tabs2, "if (growing(", rule_id, ")) return take_seed(node);");
+		m_out.println(tabs2, "if (memo(", rule_id, ", m_pos) < 0) return RET_FAIL;");
+		m_out.println(tabs2, "return grow(node, ", rule_id, ", &ParserT::grow_", name, ");");
+		m_out.println(tabs1, "}");
+		m_out.println("");
+	}
+
+	// ------------------------------------------------------------------------
+	// fill_*() function of a rule for -b: its parse_*() as a recognizer
+	// whose rule calls read the table, storing the length matched at pos
+	//
+	// a left-recursive rule is matched again with its calls to itself at
+	// pos reading the last match, for as long as that makes it longer
+	void print_fill_rule(uint32_t rule_id)
+	{
+		Rule &rule = m_grammar.rule(rule_id);
+		const std::string &name = m_grammar.name(rule);
+		CodeWriter::Indent tabs1(1), tabs2(2);
+		bool left_rec = m_left_rec[rule_id];
+		m_out.println("");
+		m_out.println(tabs1, "// ***FILL*** ", rule_str(rule));
+		if (m_out_of_class) m_out.println(tabs1, "template<typename Input>");
+		m_out.println(tabs1, "void ", (m_out_of_class ? "ParserT<Input>::" : ""), "fill_", name, "(uint32_t pos)");
+		m_out.println(tabs1, "{");
+		if (left_rec)
+		{
+			m_out.println(tabs2, "memo(", rule_id, ", pos) = -1;");
+			m_out.println(tabs2, "for (;;)");
+			m_out.println(tabs2, "{");
+			m_out.indent_base()++;
+		}
+		m_out.println(tabs2, "m_pos = pos;");
+		std::vector<std::string> captures;
+		for (auto &alt : m_grammar.alts(rule)) collect_captures(alt, captures);
+		for (auto &cap : captures) m_out.println(tabs2, "uint64_t cap_", cap, " = 0;");
+		m_out.println(tabs2, "ASTNode astn0;");
+		m_out.println("");
+
+		m_skipping = Elem::NO_RULE != m_skip_rule && !m_lexical[rule_id];
+		bool no_tree_prev = m_no_tree;
+		m_no_tree = true;
+		m_recognizer = true;
+		m_fill = true;
+		// a left-recursive rule's loops read its column while it changes
+		m_rep_cache = !left_rec;
+		m_next_rep = m_rep_base[rule_id];
+		print_alts(m_grammar.alts(rule));
+		m_rep_cache = false;
+		m_fill = false;
+		m_recognizer = false;
+		m_no_tree = no_tree_prev;
+
+		m_out.println("");
+		if (left_rec)
+		{
+			m_out.println(tabs2, "if (!ok0 || (int32_t)(m_pos - pos) <= memo(", rule_id, ", pos)) break;");
+			m_out.println(tabs2, "memo(", rule_id, ", pos) = (int32_t)(m_pos - pos);");
+			m_out.indent_base()--;
+			m_out.println(tabs2, "}");
+		}
+		else m_out.println(tabs2, "memo(", rule_id, ", pos) = ok0 ? (int32_t)(m_pos - pos) : -1;");
+		m_out.println(tabs1, "}");
+	}
+
+	// ------------------------------------------------------------------------
+	// check_*() function of a rule called from a predicate: its parse_*()
+	// as a recognizer
+	void print_check_rule(uint32_t rule_id)
+	{
+		bool no_tree_prev = m_no_tree;
+		m_no_tree = true;
+		m_recognizer = true;
+		print_rule(rule_id);
+		m_recognizer = false;
+		m_no_tree = no_tree_prev;
+	}
+
+	// ------------------------------------------------------------------------
+	// rest of parse_*() for an 'operators' rule, then its operand_*() and
+	// climb_*() functions
+	//
+	// climb_*() parses by precedence climbing over the rule's operator table
+	// rather than with one function per level. A level's node is built only
+	// where one of its operators applies, and a run of operators of a left or
+	// postfix level shares one node, so the tree is that of the equivalent
+	// rule-per-level grammar (sum : product (ws ("+" | "-") ws product)*; ...)
+	// with its single-child level nodes left out. Operators are matched
+	// longest first, with the skip rule (if any) matched before and after each
+	void print_op_rule(uint32_t rule_id)
+	{
+		Rule &rule = m_grammar.rule(rule_id);
+		const std::string &name = m_grammar.name(rule);
+		const char *scope = m_out_of_class ? "ParserT<Input>::" : "";
+		CodeWriter::Indent tabs1(1), tabs2(2), tabs3(3), tabs4(4), tabs5(5);
+
+		if (SCC_DEBUG) m_out.println(tabs2, "println(\"parse_", name, "()\");");
+		m_out.println("#ifdef IPG_PROFILE");
+		m_out.println(tabs2, "m_prof_calls[", rule_id, "]++;");
+		m_out.println("#endif");
+		if (subscribable(rule))
+		{
+			m_out.println(tabs2, "bool keep_prev = m_keep_text;");
+			m_out.println(tabs2, "m_keep_text = m_subscribed[", rule_id, "];");
+		}
+		m_out.println(tabs2, "ASTNode astn0(m_pos, m_line, m_col, \"", name, "\", ", rule_id, ");");
+		if (m_typed) m_out.println(tabs2, "size_t n_typed0 = m_typed.size();");
+		m_out.println(tabs2, "bool ok0 = climb_", name, "(astn0, 0);");
+		if (m_typed) print_typed_end(tabs2, rule_id);
+		if (m_no_tree) {}
+		// level nodes are not kept for an unsubscribed rule, only the rule
+		// nodes within them
+		else if (subscribable(rule))
+		{
+			m_out.println(tabs2, "if (ok0 && !m_keep_text) hoist_rule_nodes(astn0, node);");
+			m_out.println(tabs2, "else if (ok0)");
+			m_out.println(tabs2, "{");
+			if (collapses(rule)) print_collapse(tabs3, rule_id);
+			else m_out.println(tabs3, "node.add_child(std::move(astn0));");
+			m_out.println(tabs2, "}");
+			m_out.println(tabs2, "m_keep_text = keep_prev;");
+		}
+		else if (collapses(rule))
+		{
+			m_out.println(tabs2, "if (ok0)");
+			m_out.println(tabs2, "{");
+			print_collapse(tabs3, rule_id);
+			m_out.println(tabs2, "}");
+		}
+		else m_out.println(tabs2, "if (ok0) node.add_child(std::move(astn0));");
+		m_out.println("#ifdef IPG_PROFILE");
+		m_out.println(tabs2, "if (ok0) m_prof_ok[", rule_id, "]++;");
+		m_out.println("#endif");
+		m_out.println(tabs2, "if (ok0) return RET_OK;");
+		m_out.println(tabs2, "else return RET_FAIL;");
+		m_out.println(tabs1, "}");
+
+		m_out.println("");
+		m_out.println(tabs1, "// operand of ", name, "; restores position on failure");
+		if (m_out_of_class) m_out.println(tabs1, "template<typename Input>");
+		m_out.println(tabs1, "bool ", scope, "operand_", name, "(ASTNode &astn0)");
+		m_out.println(tabs1, "{");
+		print_alts(m_grammar.alts(rule));
+		m_out.println(tabs2, "return ok0;");
+		m_out.println(tabs1, "}");
+
+		// table entries, longest operator first
+		struct OpEntry
+		{
+			std::string tok;
+			size_t len;
+			uint32_t level;
+			OpKind kind;
+		};
+		std::vector<OpEntry> entries;
+		Span<OpLevel> levels = m_grammar.op_levels(rule);
+		for (uint32_t l = 0; l < levels.size(); l++)
+		{
+			for (uint32_t i = 0; i < levels[l].tok_count; i++)
+			{
+				const std::string &tok = m_grammar.tok(levels[l], i);
+				entries.push_back(OpEntry{tok, unescape_string(tok).size(), l, levels[l].kind});
+			}
+		}
+		std::stable_sort(entries.begin(), entries.end(), [](const OpEntry &a, const OpEntry &b)
+		{
+			return a.len > b.len;
+		});
+
+		m_out.println("");
+		m_out.println(tabs1, "// ", name, " using only operators of level min_level or higher, added");
+		m_out.println(tabs1, "// to node; restores position on failure");
+		if (m_out_of_class) m_out.println(tabs1, "template<typename Input>");
+		m_out.println(tabs1, "bool ", scope, "climb_", name, "(ASTNode &node, uint32_t min_level)");
+		m_out.println(tabs1, "{");
+		static const char *const kind_names[] = {"OP_LEFT", "OP_RIGHT", "OP_PREFIX", "OP_POSTFIX"};
+		m_out.println(tabs2, "static const OpDef ops[] =");
+		m_out.println(tabs2, "{");
+		for (auto &entry : entries)
+		{
+			m_out.println(tabs3, "{", entry.tok, ", ", (unsigned long)entry.len, ", ", entry.level,
+				", ", kind_names[(int)entry.kind], "},");
+		}
+		m_out.println(tabs2, "};");
+		m_out.prints(tabs2, "static const char *const level_names[] = {");
+		for (uint32_t l = 0; l < levels.size(); l++)
+		{
+			m_out.prints((l > 0) ? ", " : "", "\"", m_grammar.name(levels[l]), "\"");
+		}
+		m_out.println("};");
+		m_out.println(tabs2, "const uint32_t n_ops = ", (unsigned long)entries.size(), ";");
+		// nodes of the skip rule are dropped
+		std::string skip_call;
+		if (Elem::NO_RULE != rule.op_skip())
+		{
+			skip_call = "parse_" + m_grammar.name(rule.op_skip()) + "(skipped);";
+			m_out.println(tabs2, "ASTNode skipped;");
+			if (m_typed)
+			{
+				skip_call = "{ size_t n_skip = m_typed.size(); Arena::Mark mark_skip = m_arena.mark(); "
+					+ skip_call + " typed_drop(n_skip, mark_skip); }";
+			}
+		}
+		else if (m_skipping) skip_call = "skip();";
+		m_out.println(tabs2, "uint32_t pos_start = m_pos;");
+		m_out.println(tabs2, "uint32_t line_start = m_line;");
+		m_out.println(tabs2, "uint32_t col_start = m_col;");
+		m_out.println(tabs2, "// left operand so far (as children of lhs) and level of the node in");
+		m_out.println(tabs2, "// it if this call built one");
+		m_out.println(tabs2, "ASTNode lhs(m_pos, m_line, m_col, \"\");");
+		m_out.println(tabs2, "uint32_t lhs_level = NO_OP_LEVEL;");
+		if (m_typed)
+		{
+			m_out.println(tabs2, "// the left operand's typed items, and the level whose node, to hold");
+			m_out.println(tabs2, "// them, is built once no more operators of it follow");
+			m_out.println(tabs2, "size_t lhs_from = m_typed.size();");
+			m_out.println(tabs2, "uint32_t typed_level = NO_OP_LEVEL;");
+		}
+		m_out.println(tabs2, "bool have_lhs = false;");
+		m_out.println(tabs2, "int32_t i = match_op(ops, n_ops, true);");
+		m_out.println(tabs2, "if (i >= 0 && ops[i].level >= min_level)");
+		m_out.println(tabs2, "{");
+		m_out.println(tabs3, "ASTNode prefix(m_pos, m_line, m_col, level_names[ops[i].level]);");
+		if (m_typed) m_out.println(tabs3, "Arena::Mark mark_prefix = m_arena.mark();");
+		m_out.println(tabs3, "add_op(prefix, ops[i]);");
+		if (!skip_call.empty()) m_out.println(tabs3, skip_call);
+		m_out.println(tabs3, "have_lhs = climb_", name, "(prefix, ops[i].level);");
+		if (m_typed)
+		{
+			m_out.println(tabs3, "if (have_lhs)");
+			m_out.println(tabs3, "{");
+			m_out.println(tabs4, "lhs.add_child(std::move(prefix));");
+			m_out.println(tabs4, "typed_op_level(lhs_from, level_names[ops[i].level], pos_start, line_start, col_start);");
+			m_out.println(tabs3, "}");
+		}
+		else m_out.println(tabs3, "if (have_lhs) lhs.add_child(std::move(prefix));");
+		m_out.println(tabs3, "else");
+		m_out.println(tabs3, "{");
+		m_out.println(tabs4, "m_pos = pos_start;");
+		m_out.println(tabs4, "m_line = line_start;");
+		m_out.println(tabs4, "m_col = col_start;");
+		if (m_typed) m_out.println(tabs4, "typed_drop(lhs_from, mark_prefix);");
+		m_out.println(tabs3, "}");
+		m_out.println(tabs2, "}");
+		m_out.println(tabs2, "if (!have_lhs && !operand_", name, "(lhs)) return false;");
+		m_out.println(tabs2, "for (;;)");
+		m_out.println(tabs2, "{");
+		m_out.println(tabs3, "uint32_t pos_op = m_pos;");
+		m_out.println(tabs3, "uint32_t line_op = m_line;");
+		m_out.println(tabs3, "uint32_t col_op = m_col;");
+		if (!skip_call.empty()) m_out.println(tabs3, skip_call);
+		m_out.println(tabs3, "i = match_op(ops, n_ops, false);");
+		m_out.println(tabs3, "if (i < 0 || ops[i].level < min_level)");
+		m_out.println(tabs3, "{");
+		m_out.println(tabs4, "m_pos = pos_op;");
+		m_out.println(tabs4, "m_line = line_op;");
+		m_out.println(tabs4, "m_col = col_op;");
+		m_out.println(tabs4, "break;");
+		m_out.println(tabs3, "}");
+		m_out.println(tabs3, "const OpDef &op = ops[i];");
+		m_out.println(tabs3, "bool wrapped = (op.level != lhs_level);");
+		m_out.println(tabs3, "if (wrapped)");
+		m_out.println(tabs3, "{");
+		m_out.println(tabs4, "ASTNode level_node(pos_start, line_start, col_start, level_names[op.level]);");
+		m_out.println(tabs4, "level_node.children().swap(lhs.children());");
+		m_out.println(tabs4, "lhs.add_child(std::move(level_node));");
+		m_out.println(tabs4, "lhs_level = op.level;");
+		if (m_typed)
+		{
+			m_out.println(tabs4, "if (NO_OP_LEVEL != typed_level) typed_op_level(lhs_from, level_names[typed_level], pos_start, line_start, col_start);");
+			m_out.println(tabs4, "typed_level = op.level;");
+		}
+		m_out.println(tabs3, "}");
+		m_out.println(tabs3, "ASTNode &cur = lhs.children().back();");
+		if (m_typed)
+		{
+			m_out.println(tabs3, "size_t n_typed_op = m_typed.size();");
+			m_out.println(tabs3, "Arena::Mark mark_op = m_arena.mark();");
+		}
+		m_out.println(tabs3, "add_op(cur, op);");
+		m_out.println(tabs3, "if (OP_POSTFIX == op.kind) continue;");
+		if (!skip_call.empty()) m_out.println(tabs3, skip_call);
+		m_out.println(tabs3, "if (!climb_", name, "(cur, (OP_LEFT == op.kind) ? op.level + 1 : op.level))");
+		m_out.println(tabs3, "{");
+		m_out.println(tabs4, "// no right operand: leave operator to caller");
+		m_out.println(tabs4, "cur.children().pop_back();");
+		if (m_typed) m_out.println(tabs4, "typed_drop(n_typed_op, mark_op);");
+		m_out.println(tabs4, "if (wrapped)");
+		m_out.println(tabs4, "{");
+		m_out.println(tabs5, "std::vector<ASTNode> operand;");
+		m_out.println(tabs5, "operand.swap(cur.children());");
+		m_out.println(tabs5, "lhs.children().swap(operand);");
+		if (m_typed) m_out.println(tabs5, "typed_level = NO_OP_LEVEL;");
+		m_out.println(tabs4, "}");
+		m_out.println(tabs4, "m_pos = pos_op;");
+		m_out.println(tabs4, "m_line = line_op;");
+		m_out.println(tabs4, "m_col = col_op;");
+		m_out.println(tabs4, "break;");
+		m_out.println(tabs3, "}");
+		m_out.println(tabs2, "}");
+		if (m_typed)
+		{
+			m_out.println(tabs2, "if (NO_OP_LEVEL != typed_level) typed_op_level(lhs_from, level_names[typed_level], pos_start, line_start, col_start);");
+		}
+		m_out.println(tabs2, "for (auto &child : lhs.children()) node.add_child(std::move(child));");
+		m_out.println(tabs2, "return true;");
+		m_out.println(tabs1, "}");
+	}
+
+	// ------------------------------------------------------------------------
+	void print_alts(Span<Elem> elems, uint32_t depth = 0)
+	{
+		CodeWriter::Indent tabs(depth + 2);
+		m_out.println(tabs, "// ***ALTERNATES***");
+		m_out.println(tabs, "bool ok", depth, " = false;");
+		m_out.println(tabs, "uint32_t pos_start", depth, " = m_pos;");
+		m_out.println(tabs, "uint32_t line_start", depth, " = m_line;");
+		m_out.println(tabs, "uint32_t col_start", depth, " = m_col;");
+		if (depth > 0)
+		{
+			m_out.println(tabs, "ASTNode astn", depth, "(m_pos, m_line, m_col, \"alts_tmp\");");
+		}
+		// children added by a failed alternate are dropped before the next
+		m_out.println(tabs, "size_t n_children", depth, " = astn", depth, ".children().size();");
+		if (has_values()) m_out.println(tabs, "size_t n_vals", depth, " = m_vals.size();");
+		if (fills_typed())
+		{
+			m_out.println(tabs, "size_t n_typed", depth, " = m_typed.size();");
+			m_out.println(tabs, "Arena::Mark mark", depth, " = m_arena.mark();");
+		}
+		bool any_cut = false;
+		for (auto &elem : elems) any_cut |= alt_has_cut(elem);
+		// set once an alternate passes its cut, so no other is tried
+		if (any_cut) m_out.println(tabs, "bool cut", depth, " = false;");
+		// a failure from a cut nested in an alternate ends here, where there
+		// are other alternates to try, or at the rule; a lone group passes it
+		// on, so quantifiers around it do not take it as a plain miss
+		bool takes_cut = (0 == depth || elems.size() > 1);
+		m_out.println(tabs, "for (;;)");
+		m_out.println(tabs, "{");
+		std::vector<uint32_t> order = alt_order(elems);
+		size_t n_elems = elems.size();
+		for (size_t e = 0; e < n_elems; e++)
+		{
+			if (e > 0) m_out.println("");
+			print_alt(elems[order[e]], depth + 1, n_elems > 1 && !m_recognizer);
+			m_out.println(tabs, "\tif (ok", depth, ") break;");
+			if (alt_has_cut(elems[order[e]]))
+			{
+				m_out.println(tabs, "\tif (cut", depth, ")");
+				m_out.println(tabs, "\t{");
+				m_out.println(tabs, "\t\tm_cut_failed = true;");
+				m_out.println(tabs, "\t\tbreak;");
+				m_out.println(tabs, "\t}");
+			}
+			if (takes_cut && has_cut(elems[order[e]])) m_out.println(tabs, "\tm_cut_failed = false;");
+			m_out.println(tabs, "\tm_pos = pos_start", depth, ";");
+			m_out.println(tabs, "\tm_line = line_start", depth, ";");
+			m_out.println(tabs, "\tm_col = col_start", depth, ";");
+			m_out.println(tabs, "\tastn", depth, ".children().erase(astn", depth, ".children().begin() + n_children", depth, ", astn", depth, ".children().end());");
+			if (has_values()) m_out.println(tabs, "\tm_vals.resize(n_vals", depth, ");");
+			if (fills_typed()) m_out.println(tabs, "\ttyped_drop(n_typed", depth, ", mark", depth, ");");
+		}
+		m_out.println("");
+		m_out.println(tabs, "\tbreak;");
+		m_out.println(tabs, "}");
+		m_out.println(tabs, "if (!ok", depth, ")");
+		m_out.println(tabs, "{");
+		m_out.println(tabs, "\tm_pos = pos_start", depth, ";");
+		m_out.println(tabs, "\tm_line = line_start", depth, ";");
+		m_out.println(tabs, "\tm_col = col_start", depth, ";");
+		if (0 == depth && any_cut) m_out.println(tabs, "\tm_cut_failed = false;");
+		// an alternate failing after its cut leaves what it added
+		if (fills_typed() && any_cut) m_out.println(tabs, "\ttyped_drop(n_typed", depth, ", mark", depth, ");");
+		//~ if (depth > 0) m_out.println(tabs, "\tbreak;");
+		m_out.println(tabs, "}");
+		m_out.println(tabs, "else");
+		m_out.println(tabs, "{");
+		if (SCC_DEBUG)
+		{
+			m_out.println(tabs, "\tprintln(\"*\", std::string(m_in.span(pos_start", depth, ", m_pos - pos_start", depth, "), m_pos - pos_start", depth, "), \"*\");");
+		}
+		if (depth > 0 && !m_no_tree)
+		{
+			m_out.println(tabs, "\tfor (auto &child", depth, " : astn", depth, ".children())");
+			m_out.println(tabs, "\t{");
+			m_out.println(tabs, "\t\tastn", depth - 2, ".add_child(std::move(child", depth, "));");
+			m_out.println(tabs, "\t}");
+		}
+		m_out.println(tabs, "}");
+	}
+
+	// ------------------------------------------------------------------------
+	// whether alternate commits with a cut (~) of its own
+	bool alt_has_cut(Elem &alt)
+	{
+		for (auto &elem : m_grammar.subs(alt))
+		{
+			if (ElemType::CUT == elem.type()) return true;
+		}
+		return false;
+	}
+
+	// ------------------------------------------------------------------------
+	// whether elem is or contains a cut
+	bool has_cut(Elem &elem)
+	{
+		if (ElemType::CUT == elem.type()) return true;
+		for (auto &sub_elem : m_grammar.subs(elem))
+		{
+			if (has_cut(sub_elem)) return true;
+		}
+		return false;
+	}
+
+	// ------------------------------------------------------------------------
+	// whether any rule uses a cut
+	bool any_cut()
+	{
+		for (auto &rule : m_grammar.rules())
+		{
+			for (auto &alt : m_grammar.alts(rule))
+			{
+				if (has_cut(alt)) return true;
+			}
+		}
+		return false;
+	}
+
+	// ------------------------------------------------------------------------
+	// counted: alternate is one of several, so its profile counters are kept
+	void print_alt(Elem &elem, uint32_t depth = 0, bool counted = false)
+	{
+		// sanity check
+		if (ElemType::ALT != elem.type()) return;
+
+		CodeWriter::Indent tabs(depth + 2);
+		uint32_t alt_rule = m_grammar.alt_rule(elem.alt_id());
+		uint32_t alt_index = m_grammar.alt_index(elem.alt_id());
+
+		m_out.println(tabs, "// ***ALTERNATE***", elem_str(elem));
+		m_out.println(tabs, "for (;;)");
+		m_out.println(tabs, "{");
+		if (counted)
+		{
+			m_out.println("#ifdef IPG_PROFILE");
+			m_out.println(tabs, "\tprof_alt(m_prof_alt_calls, ", alt_rule, ", ", alt_index, ");");
+			m_out.println("#endif");
+		}
+		m_out.println(tabs, "\tint32_t counter", depth + 1, " = 0;");
+		m_out.println(tabs, "\tbool ok", depth , " = false;");
+		m_out.println(tabs, "\tuint32_t pos_start", depth , " = m_pos;");
+		m_out.println(tabs, "\tuint32_t line_start", depth , " = m_line;");
+		m_out.println(tabs, "\tuint32_t col_start", depth , " = m_col;");
+		m_out.println("");
+
+		uint32_t e = 0;
+		for (auto &sub_elem : m_grammar.subs(elem))
+		{
+			if (e++ > 0) m_out.println("");
+			print_elem(sub_elem, depth + 1);
+		}
+
+		m_out.println("");
+		//~ m_out.println(tabs, "\tok", depth - 1, " = true;");
+		m_out.println(tabs, "\tok", depth - 1 ," = ok", depth, ";");
+		if (counted)
+		{
+			m_out.println("#ifdef IPG_PROFILE");
+			m_out.println(tabs, "\tif (ok", depth - 1, ") prof_alt(m_prof_alt_ok, ", alt_rule, ", ", alt_index, ");");
+			m_out.println("#endif");
+		}
+		m_out.println(tabs, "\tbreak;");
+		m_out.println(tabs, "}");
+	}
+
+	// ------------------------------------------------------------------------
+	void print_elem(Elem &elem, uint32_t depth = 0)
+	{
+		// sanity check
+		if (ElemType::ALT == elem.type()) return;
+		if (Lookahead::NONE != elem.lookahead())
+		{
+			print_predicate(elem, depth);
+			return;
+		}
+
+		CodeWriter::Indent tabs(depth + 2);
+
+		m_out.println(tabs, "// ***ELEMENT***", elem_str(elem));
+		// commit to this alternate: a later failure fails the alternates
+		if (ElemType::CUT == elem.type())
+		{
+			m_out.println(tabs, "cut", depth - 2, " = true;");
+			m_out.println(tabs, "ok", depth - 1, " = true;");
+			return;
+		}
+		// a capture holds the start of the match until it is complete
+		if (StrPool::NO_STR != elem.capture_id())
+		{
+			m_out.println(tabs, "cap_", m_grammar.capture(elem), " = m_pos;");
+		}
+
+		if (elem.quantifier() == QuantifierType::COUNT && skips_bytes(elem))
+		{
+			print_skip_bytes(elem, depth);
+		}
+		else if (runs_structural(elem))
+		{
+			print_structural_run(elem, depth);
+		}
+		else if (elem.quantifier() == QuantifierType::ZERO_ONE)
+		{
+			m_out.println(tabs, "ok", depth - 1, " = false;");
+			m_out.println(tabs, "for (;;)");
+			m_out.println(tabs, "{");
+			print_elem_start(tabs, depth);
+			print_elem_inner(elem, depth);
+			m_out.println(tabs, "\tok", depth - 1, " = true;");
+			m_out.println(tabs, "\tbreak;");
+			m_out.println(tabs, "}");
+		}
+		else if (elem.quantifier() == QuantifierType::ZERO_PLUS && rep_cached(elem))
+		{
+			uint32_t rep = m_next_rep++;
+			m_out.println(tabs, "size_t walk", rep, " = m_rep_walk.size();");
+			m_out.println(tabs, "for (;;)");
+			m_out.println(tabs, "{");
+			m_out.println(tabs, "\tif (rep_known(", rep, ")) break;");
+			m_out.println(tabs, "\tm_rep_walk.push_back(m_pos);");
+			print_elem_start(tabs, depth);
+			print_elem_inner(elem, depth);
+			m_out.println(tabs, "\tif (ok", depth, ") continue;");
+			m_out.println(tabs, "\tbreak;");
+			m_out.println(tabs, "}");
+			m_out.println(tabs, "rep_walked(", rep, ", walk", rep, ");");
+			m_out.println(tabs, "ok", depth - 1, " = true;");
+		}
+		else if (elem.quantifier() == QuantifierType::ZERO_PLUS)
+		{
+			if (m_rep_cache) m_next_rep++;
+			m_out.println(tabs, "ok", depth - 1, " = false;");
+			m_out.println(tabs, "for (;;)");
+			m_out.println(tabs, "{");
+			print_elem_start(tabs, depth);
+			print_elem_inner(elem, depth);
+			m_out.println(tabs, "\tif (ok", depth, ") continue;");
+			m_out.println(tabs, "\tok", depth - 1, " = true;");
+			m_out.println(tabs, "\tbreak;");
+			m_out.println(tabs, "}");
+		}
+		else if (elem.quantifier() == QuantifierType::ONE_PLUS)
+		{
+			// after the first match, the rest is a cached repetition
+			bool cached = rep_cached(elem);
+			uint32_t rep = m_rep_cache ? m_next_rep++ : 0;
+			m_out.println(tabs, "ok", depth - 1, " = false;");
+			m_out.println(tabs, "counter", depth, " = 0;");
+			if (cached) m_out.println(tabs, "size_t walk", rep, " = m_rep_walk.size();");
+			m_out.println(tabs, "for (;;)");
+			m_out.println(tabs, "{");
+			if (cached)
+			{
+				m_out.println(tabs, "\tif (counter", depth, " > 0)");
+				m_out.println(tabs, "\t{");
+				m_out.println(tabs, "\t\tif (rep_known(", rep, ")) break;");
+				m_out.println(tabs, "\t\tm_rep_walk.push_back(m_pos);");
+				m_out.println(tabs, "\t}");
+			}
+			print_elem_start(tabs, depth);
+			print_elem_inner(elem, depth);
+			m_out.println(tabs, "\tif (!ok", depth, ") break;");
+			m_out.println(tabs, "\tcounter", depth, "++;");
+			m_out.println(tabs, "}");
+			if (cached) m_out.println(tabs, "rep_walked(", rep, ", walk", rep, ");");
+			m_out.println(tabs, "ok", depth - 1, " = (counter", depth, " > 0);");
+		}
+		else if (elem.quantifier() == QuantifierType::COUNT)
+		{
+			m_out.println(tabs, "ok", depth - 1, " = false;");
+			m_out.println(tabs, "counter", depth, " = 0;");
+			m_out.println(tabs, "for (;;)");
+			m_out.println(tabs, "{");
+			print_elem_start(tabs, depth);
+			// a captured count that overflowed matches no number of repetitions
+			if (captured_count(elem)) m_out.println(tabs, "\tif (CAPTURE_OVERFLOW == ", count_expr(elem), ") break;");
+			m_out.println(tabs, "\tif ((uint64_t)counter", depth, " == ", count_expr(elem), ") break;");
+			print_elem_inner(elem, depth);
+			m_out.println(tabs, "\tif (!ok", depth, ") break;");
+			m_out.println(tabs, "\tcounter", depth, "++;");
+			m_out.println(tabs, "}");
+			m_out.println(tabs, "ok", depth - 1, " = ((uint64_t)counter", depth, " == ", count_expr(elem), ")",
+				captured_count(elem) ? " && CAPTURE_OVERFLOW != " + count_expr(elem) : "", ";");
+		}
+		else if (elem.quantifier() == QuantifierType::ONE)
+		{
+			m_out.println(tabs, "ok", depth - 1, " = false;");
+			m_out.println(tabs, "for (;;)");
+			m_out.println(tabs, "{");
+			print_elem_start(tabs, depth);
+			print_elem_inner(elem, depth);
+			m_out.println(tabs, "\tok", depth - 1, " = ok", depth, ";");
+			m_out.println(tabs, "\tbreak;");
+			m_out.println(tabs, "}");
+		}
+		else
+		{
+			uint32_t qt = (uint32_t)elem.quantifier();
+			eprintln("FATAL ERROR: unsupported quantifier '", qt, "'");
+			exit(1);
+		}
+
+		// a failure after a cut within a repetition or optional fails it, rather
+		// than ending it
+		if (has_cut(elem) && (QuantifierType::ZERO_ONE == elem.quantifier()
+			|| QuantifierType::ZERO_PLUS == elem.quantifier() || QuantifierType::ONE_PLUS == elem.quantifier()))
+		{
+			m_out.println(tabs, "if (m_cut_failed) ok", depth - 1, " = false;");
+		}
+
+		// only a required named element fails exactly when its rule does
+		const char *hint = "";
+		if (ElemType::NAME == elem.type()
+			&& (QuantifierType::ONE == elem.quantifier() || QuantifierType::ONE_PLUS == elem.quantifier()))
+		{
+			hint = fail_hint(elem.rule());
+		}
+		print_fail_check(tabs, hint, depth - 1);
+		m_out.println(tabs, "{");
+		m_out.println(tabs, "\tm_pos = pos_start", depth - 1, ";");
+		m_out.println(tabs, "\tm_line = line_start", depth - 1, ";");
+		m_out.println(tabs, "\tm_col = col_start", depth - 1, ";");
+		m_out.println(tabs, "\tbreak;");
+		m_out.println(tabs, "}");
+		if (!m_recognizer)
+		{
+			m_out.println(tabs, "else");
+			m_out.println(tabs, "{");
+			m_out.println(tabs, "\tif (m_pos > m_pos_ok)");
+			m_out.println(tabs, "\t{");
+			m_out.println(tabs, "\t\tm_pos_ok = m_pos;");
+			m_out.println(tabs, "\t\tm_line_ok = m_line;");
+			m_out.println(tabs, "\t\tm_col_ok = m_col;");
+			m_out.println(tabs, "\t}");
+			m_out.println(tabs, "}");
+		}
+		if (StrPool::NO_STR != elem.capture_id())
+		{
+			const std::string &cap = m_grammar.capture(elem);
+			m_out.println(tabs, "cap_", cap, " = capture_value((uint32_t)cap_", cap, ", m_pos);");
+		}
+	}
+
+	// ------------------------------------------------------------------------
+	// whether repetition elem in a fill_*() function keeps where its loop
+	// ends
+	bool rep_cached(Elem &elem)
+	{
+		return m_rep_cache && rep_cacheable(elem);
+	}
+
+	// ------------------------------------------------------------------------
+	// start of one match of an element, inside its loop: skip() first in
+	// rules that are not lexical, so each repetition is preceded by it too;
+	// its nodes, and a failed match, take the position it starts at
+	void print_elem_start(CodeWriter::Indent tabs, uint32_t depth)
+	{
+		if (m_skipping) m_out.println(tabs, "\tskip();");
+		m_out.println(tabs, "\tpos_start", depth - 1, " = m_pos;");
+		m_out.println(tabs, "\tline_start", depth - 1, " = m_line;");
+		m_out.println(tabs, "\tcol_start", depth - 1, " = m_col;");
+		if (m_incremental) m_out.println(tabs, "\tif (m_pos > m_reach) m_reach = m_pos;");
+	}
+
+	// ------------------------------------------------------------------------
+	// C++ expression for the count of a QuantifierType::COUNT element
+	std::string count_expr(Elem &elem)
+	{
+		const std::string &count = m_grammar.count(elem);
+		return isdigit((uint8_t)count[0]) ? count : "cap_" + count;
+	}
+
+	// ------------------------------------------------------------------------
+	// whether the count of a QuantifierType::COUNT element is a capture
+	bool captured_count(Elem &elem) { return !isdigit((uint8_t)m_grammar.count(elem)[0]); }
+
+	// ------------------------------------------------------------------------
+	// whether counted element is a payload of raw bytes: a class matching
+	// every byte, which needs no look at the input at all
+	bool skips_bytes(Elem &elem)
+	{
+		if (!m_grammar.bytes() || ElemType::CH_CLASS != elem.type()) return false;
+		ChClass cc = m_grammar.ch_class(elem);
+		for (int32_t ch = 0; ch < 256; ch++)
+		{
+			if (!cc.matches(ch)) return false;
+		}
+		return true;
+	}
+
+	// ------------------------------------------------------------------------
+	// move past a counted payload of raw bytes with one bounds check, adding
+	// a single node that spans it; its text is not copied, and newlines in
+	// it are not counted into line and column
+	void print_skip_bytes(Elem &elem, uint32_t depth)
+	{
+		CodeWriter::Indent tabs(depth + 2), tabs_inner(depth + 3);
+		m_out.println(tabs, "ok", depth - 1, " = false;");
+		m_out.println(tabs, "for (;;)");
+		m_out.println(tabs, "{");
+		print_elem_start(tabs, depth);
+		m_out.println(tabs, "\tconst uint64_t n = ", count_expr(elem), ";");
+		m_out.println(tabs, "\tbool ok", depth, " = (", captured_count(elem) ? "CAPTURE_OVERFLOW != n && " : "", "m_len - m_pos >= n);");
+		m_out.println(tabs, "\tif (ok", depth, ")");
+		m_out.println(tabs, "\t{");
+		m_out.println(tabs, "\t\tm_pos += (uint32_t)n;");
+		m_out.println(tabs, "\t\tm_col += (uint32_t)n;");
+		// an item without text, standing for the payload's node, so that a
+		// collapsing rule counts it as the tree does
+		if (fills_typed())
+		{
+			m_out.println(tabs_inner, "\tm_typed.push_back(TypedItem{nullptr, pos_start", depth - 1, ", line_start", depth - 1,
+				", col_start", depth - 1, ", 0});");
+		}
+		if (!m_no_tree)
+		{
+			if (m_subscribe)
+			{
+				m_out.println(tabs_inner, "\tif (m_keep_text)");
+				m_out.println(tabs_inner, "\t{");
+				tabs_inner.n++;
+			}
+			m_out.println(tabs_inner, "\tASTNode astn", depth, "(pos_start", depth - 1,
+				", line_start", depth - 1, ", col_start", depth - 1, ", \"\");");
+			m_out.println(tabs_inner, "\tastn", depth, ".set_span_len((uint32_t)n);");
+			m_out.println(tabs_inner, "\tastn", depth - 2, ".add_child(std::move(astn", depth, "));");
+			if (m_subscribe)
+			{
+				tabs_inner.n--;
+				m_out.println(tabs_inner, "\t}");
+			}
+		}
+		m_out.println(tabs, "\t}");
+		// failing depends on the end of the input
+		if (m_incremental) m_out.println(tabs, "\telse if (m_reach <= m_len) m_reach = m_len + 1;");
+		m_out.println(tabs, "\tok", depth - 1, " = ok", depth, ";");
+		m_out.println(tabs, "\tbreak;");
+		m_out.println(tabs, "}");
+	}
+
+	// ------------------------------------------------------------------------
+	// lookahead predicate: match the element as a recognizer, restore the
+	// position, then fail or go on by the result
+	void print_predicate(Elem &elem, uint32_t depth)
+	{
+		CodeWriter::Indent tabs(depth + 2);
+		m_out.println(tabs, "// ***PREDICATE***", elem_str(elem));
+		m_out.println(tabs, "{");
+		m_out.println(tabs, "\tuint32_t pos_pred = m_pos;");
+		m_out.println(tabs, "\tuint32_t line_pred = m_line;");
+		m_out.println(tabs, "\tuint32_t col_pred = m_col;");
+		m_out.println(tabs, "\tfor (;;)");
+		m_out.println(tabs, "\t{");
+		Elem inner = elem;
+		inner.lookahead() = Lookahead::NONE;
+		bool no_tree_prev = m_no_tree;
+		bool recognizer_prev = m_recognizer;
+		bool fill_prev = m_fill;
+		m_no_tree = true;
+		m_recognizer = true;
+		// with -b, rules are looked up in the table, except in check_*()
+		// functions, which only skip() runs
+		if (m_bottom_up && !recognizer_prev) m_fill = true;
+		m_out.indent_base() += 2;
+		print_elem(inner, depth);
+		m_out.indent_base() -= 2;
+		m_no_tree = no_tree_prev;
+		m_recognizer = recognizer_prev;
+		m_fill = fill_prev;
+		m_out.println(tabs, "\t\tbreak;");
+		m_out.println(tabs, "\t}");
+		// a cut failing within the element is just its failure
+		if (has_cut(elem)) m_out.println(tabs, "\tm_cut_failed = false;");
+		m_out.println(tabs, "\tm_pos = pos_pred;");
+		m_out.println(tabs, "\tm_line = line_pred;");
+		m_out.println(tabs, "\tm_col = col_pred;");
+		m_out.println(tabs, "}");
+		if (Lookahead::NOT == elem.lookahead()) m_out.println(tabs, "ok", depth - 1, " = !ok", depth - 1, ";");
+		print_fail_check(tabs, "", depth - 1);
+		m_out.println(tabs, "{");
+		m_out.println(tabs, "\tbreak;");
+		m_out.println(tabs, "}");
+	}
+
+	// ------------------------------------------------------------------------
+	// run rule's action on the values its match left on the stack and
+	// replace them with the result
+	//
+	// in the action, $$ is the result, $1, $2, .. the values, and vals,
+	// n_vals, text and len the values and matched text as pointer and count
+	void print_action(CodeWriter::Indent tabs, Rule &rule)
+	{
+		const std::string &code = m_grammar.action(rule);
+		std::string translated;
+		for (size_t i = 0; i < code.size(); i++)
+		{
+			if ('$' == code[i] && i + 1 < code.size() && '$' == code[i + 1])
+			{
+				translated += "val";
+				i++;
+			}
+			else if ('$' == code[i] && i + 1 < code.size() && isdigit((unsigned char)code[i + 1]))
+			{
+				uint32_t n = 0;
+				while (i + 1 < code.size() && isdigit((unsigned char)code[i + 1])) n = n * 10 + (code[++i] - '0');
+				translated += "vals[" + std::to_string(n - 1) + "]";
+			}
+			else translated += code[i];
+		}
+		m_out.println(tabs, "Value val = Value();");
+		m_out.println(tabs, "Value *vals = m_vals.data() + n_vals0;");
+		m_out.println(tabs, "size_t n_vals = m_vals.size() - n_vals0;");
+		m_out.println(tabs, "uint32_t len = m_pos - pos_prev;");
+		m_out.println(tabs, "const char *text = m_in.span(pos_prev, len);");
+		m_out.println(tabs, "(void)vals; (void)n_vals; (void)text; (void)len;");
+		m_out.println(tabs, "{", translated, "}");
+		m_out.println(tabs, "m_vals.resize(n_vals0);");
+		m_out.println(tabs, "m_vals.push_back(val);");
+	}
+
+	// ------------------------------------------------------------------------
+	// add rule's node astn0 to node, or instead just its child if that is its
+	// only one and was itself built by a rule
+	void print_collapse(CodeWriter::Indent tabs, uint32_t rule_id)
+	{
+		m_out.println(tabs, "if (1 == astn0.children().size() && ASTNode::NO_RULE != astn0.children()[0].rule_id())");
+		m_out.println(tabs, "{");
+		if (m_record_elided) m_out.println(tabs, "\tastn0.children()[0].add_elided(", rule_id, ");");
+		m_out.println(tabs, "\tnode.add_child(std::move(astn0.children()[0]));");
+		m_out.println(tabs, "}");
+		m_out.println(tabs, "else node.add_child(std::move(astn0));");
+	}
+
+	// ------------------------------------------------------------------------
+	// after a string is matched: the lines and column it moved to, if it
+	// holds newlines (its match counted only columns)
+	void print_string_lines(CodeWriter::Indent tabs, const std::string &str)
+	{
+		size_t last = str.rfind('\n');
+		if (std::string::npos == last) return;
+		uint32_t lines = (uint32_t)std::count(str.begin(), str.end(), '\n');
+		m_out.println(tabs, "\tm_line += ", lines, ";");
+		m_out.println(tabs, "\tm_col = ", (uint32_t)(str.size() - last), ";");
+	}
+
+	// ------------------------------------------------------------------------
+	// add node for text matched by element at depth to its rule's node, and
+	// with -t an item for it to the typed items
+	void print_text_leaf(CodeWriter::Indent tabs, uint32_t depth)
+	{
+		if (fills_typed())
+		{
+			m_out.println(tabs, "\tm_typed.push_back(TypedItem{nullptr, pos_start", depth - 1, ", line_start", depth - 1,
+				", col_start", depth - 1, ", m_pos - pos_start", depth - 1, "});");
+		}
+		if (m_no_tree) return;
+		// only kept under a subscribed rule's node
+		if (m_subscribe)
+		{
+			m_out.println(tabs, "\tif (m_keep_text)");
+			m_out.println(tabs, "\t{");
+			tabs.n++;
+		}
+		m_out.println(tabs, "\tASTNode astn", depth, "(pos_start", depth - 1,
+			", line_start", depth - 1, ", col_start", depth - 1,
+			", std::string(m_in.span(pos_start", depth - 1, ", m_pos - pos_start", depth - 1, "), m_pos - pos_start", depth - 1, "));");
+		m_out.println(tabs, "\tastn", depth - 2, ".add_child(std::move(astn", depth, "));");
+		if (m_subscribe)
+		{
+			tabs.n--;
+			m_out.println(tabs, "\t}");
+		}
+	}
+
+	// ------------------------------------------------------------------------
+	// print "if (!ok<depth>)", wrapped in branch hint if given
+	void print_fail_check(CodeWriter::Indent tabs, const char *hint, uint32_t depth)
+	{
+		if ('\0' == hint[0]) m_out.println(tabs, "if (!ok", depth, ")");
+		else m_out.println(tabs, "if (", hint, "(!ok", depth, "))");
+	}
+
+	// ------------------------------------------------------------------------
+	void print_elem_inner(Elem &elem, uint32_t depth = 0)
+	{
+		CodeWriter::Indent tabs(depth + 3);
+
+		// the table already holds the rule's match here
+		if (ElemType::NAME == elem.type() && m_fill)
+		{
+			m_out.println(tabs, "int32_t ok", depth, " = memo_match(", elem.rule(), ");");
+		}
+		else if (ElemType::NAME == elem.type())
+		{
+			const char *prefix = m_recognizer ? "check_" : "parse_";
+			m_out.println(tabs, "int32_t ok", depth, " = ", prefix, m_grammar.tok(elem, 0), "(astn", depth - 2, ");");
+			if (RuleMod::INLINE == m_grammar.rule(elem.rule()).mod() && keeps_text())
+			{
+				m_out.println(tabs, "if (RET_INLINE == ok", depth, ")");
+				m_out.println(tabs, "{");
+				print_text_leaf(tabs, depth);
+				m_out.println(tabs, "}");
+			}
+		}
+		// raw bytes: one load and a test in a 256-bit table
+		else if (ElemType::CH_CLASS == elem.type() && m_grammar.bytes())
+		{
+			ChClass cc = m_grammar.ch_class(elem);
+			uint32_t bits[8] = {};
+			for (int32_t ch = 0; ch < 256; ch++)
+			{
+				if (cc.matches(ch)) bits[ch >> 5] |= 1u << (ch & 31);
+			}
+			m_out.prints(tabs, "static const uint32_t bits[8] = {");
+			for (int32_t w = 0; w < 8; w++)
+			{
+				char word[16];
+				snprintf(word, sizeof(word), "0x%08xu", bits[w]);
+				m_out.prints((w > 0 ? ", " : ""), word);
+			}
+			m_out.println("};");
+			m_out.println(tabs, "bool ok", depth, " = false;");
+			m_out.println(tabs, "uint8_t byte = 0;");
+			m_out.println(tabs, "if (m_pos < m_len)");
+			m_out.println(tabs, "{");
+			m_out.println(tabs, "\tbyte = (uint8_t)m_in[m_pos];");
+			m_out.println(tabs, "\tok", depth, " = (bits[byte >> 5] >> (byte & 31)) & 1;");
+			m_out.println(tabs, "}");
+			m_out.println(tabs, "if (ok", depth, ")");
+			m_out.println(tabs, "{");
+			m_out.println(tabs, "\tm_pos++;");
+			m_out.println(tabs, "\tm_col++;");
+			if (keeps_text()) print_text_leaf(tabs, depth);
+			m_out.println(tabs, "\tif ('\\n' == byte)");
+			m_out.println(tabs, "\t{");
+			m_out.println(tabs, "\t\tm_line++;");
+			m_out.println(tabs, "\t\tm_col = 1;");
+			m_out.println(tabs, "\t}");
+			m_out.println(tabs, "}");
+		}
+		// table lookups instead of a comparison per range
+		else if (ElemType::CH_CLASS == elem.type() && has_property(elem))
+		{
+			m_out.println(tabs, "bool ok", depth, " = false;");
+			m_out.println(tabs, "int32_t ch_decoded;");
+			m_out.println(tabs, "int32_t len_item", depth, " = (m_pos < m_len) ? utf8_to_int32(&ch_decoded, m_in.span(m_pos, 4)) : -1;");
+			m_out.println(tabs, "if (len_item", depth, " > 0 && ", uclass_name(elem), "(ch_decoded))");
+			m_out.println(tabs, "{ m_pos += len_item", depth, "; m_col += len_item", depth, "; ok", depth, " = true; }");
+			m_out.println(tabs, "if (ok", depth, ")");
+			m_out.println(tabs, "{");
+			if (keeps_text()) print_text_leaf(tabs, depth);
+			m_out.println(tabs, "\tif ('\\n' == ch_decoded)");
+			m_out.println(tabs, "\t{");
+			m_out.println(tabs, "\t\tm_line++;");
+			m_out.println(tabs, "\t\tm_col = 1;");
+			m_out.println(tabs, "\t}");
+			m_out.println(tabs, "}");
+		}
+		// NOTE: assumes valid expression since parser should have validated
+		else if (ElemType::CH_CLASS == elem.type())
+		{
+			m_out.println(tabs, "bool ok", depth, " = false;");
+			m_out.println(tabs, "int32_t ch_decoded;");
+			m_out.println(tabs, "int32_t len_item", depth, " = (m_pos < m_len) ? utf8_to_int32(&ch_decoded, m_in.span(m_pos, 4)) : -1;");
+
+			int32_t idx = 1;
+			bool flag_negate_all = false;
+			int32_t range_ch1;
+			int32_t range_ch2;
+			bool escaped = false;
+			int32_t ch32 = decode_to_int32(&escaped, m_grammar.tok(elem, idx).c_str());
+			if ('^' == ch32 && !escaped)
+			{
+				flag_negate_all = true;
+				idx++;
+			}
+
+			// print expression to check if char matches character class
+			m_out.prints(tabs, "if (len_item", depth, " > 0 && ", (flag_negate_all ? "!" : ""), "(true");
+
+			// negative expressions
+			// loop over all tokens except leading and trailing [ ]
+			for (int32_t idx2 = idx; idx2 < elem.tok_count() - 1;)
+			{
+				bool flag_is_range = false;
+
+				bool flag_negate = false;
+				ch32 = decode_to_int32(&escaped, m_grammar.tok(elem, idx2).c_str());
+				// check for negation
+				if ('!' == ch32 && !escaped)
+				{
+					flag_negate = true;
+					idx2++;
+				}
+				// get first char in range
+				range_ch1 = decode_to_int32(&escaped, m_grammar.tok(elem, idx2).c_str());
+				idx2++;
+				ch32 = decode_to_int32(&escaped, m_grammar.tok(elem, idx2).c_str());
+				// check for range separator
+				if ('-' == ch32 && !escaped)
+				{
+					flag_is_range = true;
+					idx2++;
+					range_ch2 = decode_to_int32(&escaped, m_grammar.tok(elem, idx2).c_str());
+					idx2++;
+				}
+
+				if (flag_negate)
+				{
+					m_out.prints(" && ");
+
+					// print expression for this part of character class
+					if (!flag_is_range)
+					{
+						m_out.prints((flag_negate ? "!" : ""), "(ch_decoded == ", range_ch1, ")");
+					}
+					else
+					{
+						m_out.prints((flag_negate ? "!" : ""), "(ch_decoded >= ", range_ch1,
+							" && ch_decoded <= ", range_ch2, ")");
+					}
+				}
+			}
+
+			// positive expressions
+			// loop over all tokens except leading and trailing [ ]
+			m_out.prints(" && (false");
+			for (; idx < elem.tok_count() - 1;)
+			{
+				bool flag_is_range = false;
+
+				bool flag_negate = false;
+				ch32 = decode_to_int32(&escaped, m_grammar.tok(elem, idx).c_str());
+				// check for negation
+				if ('!' == ch32 && !escaped)
+				{
+					flag_negate = true;
+					idx++;
+				}
+				// get first char in range
+				range_ch1 = decode_to_int32(&escaped, m_grammar.tok(elem, idx).c_str());
+				idx++;
+				ch32 = decode_to_int32(&escaped, m_grammar.tok(elem, idx).c_str());
+				// check for range separator
+				if ('-' == ch32 && !escaped)
+				{
+					flag_is_range = true;
+					idx++;
+					range_ch2 = decode_to_int32(&escaped, m_grammar.tok(elem, idx).c_str());
+					idx++;
+				}
+
+				if (!flag_negate)
+				{
+					m_out.prints(" || ");
+
+					// print expression for this part of character class
+					if (!flag_is_range)
+					{
+						m_out.prints("(ch_decoded == ", range_ch1, ")");
+					}
+					else
+					{
+						m_out.prints("(ch_decoded >= ", range_ch1, " && ch_decoded <= ", range_ch2, ")");
+					}
+				}
+			}
+			m_out.println(")))");
+			m_out.println(tabs, "{ m_pos += len_item", depth, "; m_col += len_item", depth, "; ok", depth, " = true; }");
+
+			m_out.println(tabs, "if (ok", depth, ")");
+			m_out.println(tabs, "{");
+			if (keeps_text()) print_text_leaf(tabs, depth);
+			m_out.println(tabs, "\tif ('\\n' == ch_decoded)");
+			m_out.println(tabs, "\t{");
+			m_out.println(tabs, "\t\tm_line++;");
+			m_out.println(tabs, "\t\tm_col = 1;");
+			m_out.println(tabs, "\t}");
+			m_out.println(tabs, "}");
+		}
+		// raw bytes, which may include '\0'
+		else if (ElemType::STRING == elem.type() && m_grammar.bytes())
+		{
+			m_out.println(tabs, "static const char str[] = ", c_literal(unescape_string(m_grammar.tok(elem, 0))), ";");
+			m_out.println(tabs, "const uint32_t len_str = sizeof(str) - 1;");
+			m_out.println(tabs, "bool ok", depth, " = (m_len - m_pos >= len_str && 0 == memcmp(m_in.span(m_pos, len_str), str, len_str));");
+			m_out.println(tabs, "if (ok", depth, ")");
+			m_out.println(tabs, "{");
+			m_out.println(tabs, "\tm_pos += len_str;");
+			m_out.println(tabs, "\tm_col += len_str;");
+			if (keeps_text()) print_text_leaf(tabs, depth);
+			print_string_lines(tabs, unescape_string(m_grammar.tok(elem, 0)));
+			m_out.println(tabs, "}");
+		}
+		else if (ElemType::STRING == elem.type())
+		{
+			m_out.println(tabs, "bool ok", depth, " = false;");
+			m_out.println(tabs, "const char *str = ", c_literal(unescape_string(m_grammar.tok(elem, 0))), ";");
+			m_out.println(tabs, "int32_t i = 0;");
+			m_out.println(tabs, "for (; i < strlen(str) && m_in[m_pos] == str[i]; i++, m_pos++, m_col++);");
+			m_out.println(tabs, "if (i == strlen(str)) ok", depth, " = true;");
+
+			m_out.println(tabs, "if (ok", depth, ")");
+			m_out.println(tabs, "{");
+			if (keeps_text()) print_text_leaf(tabs, depth);
+			print_string_lines(tabs, unescape_string(m_grammar.tok(elem, 0)));
+			m_out.println(tabs, "}");
+		}
+		// find the terminator with the input's find() (memchr() for candidates,
+		// memcmp() to check them, as raw bytes may include '\0') and count the
+		// newlines skipped with memchr()
+		else if (ElemType::UNTIL == elem.type())
+		{
+			m_out.println(tabs, "static const char str[] = ", c_literal(unescape_string(m_grammar.tok(elem, 0))), ";");
+			m_out.println(tabs, "const size_t len_str = sizeof(str) - 1;");
+			m_out.println(tabs, "size_t to = m_in.find(m_pos, str, len_str);");
+			m_out.println(tabs, "bool ok", depth, " = (std::string::npos != to);");
+			m_out.println(tabs, "if (ok", depth, ")");
+			m_out.println(tabs, "{");
+			m_out.println(tabs, "\tto += len_str;");
+			m_out.println(tabs, "\tsize_t line = m_pos;");
+			m_out.println(tabs, "\tuint32_t lines = m_in.newlines(m_pos, to, line);");
+			m_out.println(tabs, "\tif (lines > 0)");
+			m_out.println(tabs, "\t{");
+			m_out.println(tabs, "\t\tm_line += lines;");
+			m_out.println(tabs, "\t\tm_col = 1;");
+			m_out.println(tabs, "\t}");
+			m_out.println(tabs, "\tm_col += to - line;");
+			m_out.println(tabs, "\tm_pos = to;");
+			if (keeps_text()) print_text_leaf(tabs, depth);
+			m_out.println(tabs, "}");
+			// the search read on to the end of the input
+			if (m_incremental) m_out.println(tabs, "else if (m_reach <= m_len) m_reach = m_len + 1;");
+		}
+		else if (ElemType::GROUP == elem.type())
+		{
+			m_out.println(tabs, "int32_t len_item", depth, " = -1;");
+			print_alts(m_grammar.subs(elem), depth);
+		}
+		else
+		{
+			eprintln("FATAL ERROR: unsupported element type: ", (int)elem.type());
+			exit(1);
+		}
+	}
+
+	// ------------------------------------------------------------------------
+	// add rules referenced by named elem and/or sub-elems to to_visit if not
+	// already visited
+	void check_rule_elems(
+		Elem &elem,
+		std::vector<uint32_t> &to_visit,
+		std::vector<bool> &visited)
+	{
+		if (ElemType::NAME == elem.type() && !visited[elem.rule()])
+		{
+			visited[elem.rule()] = true;
+			to_visit.push_back(elem.rule());
+		}
+		// if there are sub elems to this elem, loop over them
+		for (auto &sub_elem : m_grammar.subs(elem))
+		{
+			check_rule_elems(sub_elem, to_visit, visited);
+		}
+	}
+
+	// ------------------------------------------------------------------------
+	// append ids of rules referenced inside predicates in element or its
+	// sub-elements
+	void collect_predicate_callees(Elem &elem, std::vector<uint32_t> &callees)
+	{
+		if (Lookahead::NONE != elem.lookahead()) collect_callees(elem, callees);
+		else
+		{
+			for (auto &sub_elem : m_grammar.subs(elem)) collect_predicate_callees(sub_elem, callees);
+		}
+	}
+
+	// ------------------------------------------------------------------------
+	// whether character classes in element and its sub-elements only name
+	// byte values, as %bytes grammars need
+	bool byte_classes_ok(Elem &elem)
+	{
+		if (ElemType::CH_CLASS == elem.type())
+		{
+			ChClass cc = m_grammar.ch_class(elem);
+			for (auto &range : cc.pos)
+			{
+				if (range.second > 0xff) return false;
+			}
+			for (auto &range : cc.neg)
+			{
+				if (range.second > 0xff) return false;
+			}
+		}
+		for (auto &sub_elem : m_grammar.subs(elem))
+		{
+			if (!byte_classes_ok(sub_elem)) return false;
+		}
+		return true;
+	}
+
+	// ------------------------------------------------------------------------
+	// whether element (with the rules it calls) matches nothing but ASCII
+	// digits, as a capture in a text grammar must; rules being visited count
+	// as digits
+	bool digits_only(Elem &elem, std::vector<bool> &visiting)
+	{
+		if (ElemType::UNTIL == elem.type()) return false;
+		if (ElemType::STRING == elem.type())
+		{
+			for (char ch : unescape_string(m_grammar.tok(elem, 0)))
+			{
+				if (ch < '0' || ch > '9') return false;
+			}
+		}
+		if (ElemType::CH_CLASS == elem.type())
+		{
+			ChClass cc = m_grammar.ch_class(elem);
+			if (cc.negate_all) return false;
+			for (auto &range : cc.pos)
+			{
+				if (range.first < '0' || range.second > '9') return false;
+			}
+		}
+		if (ElemType::NAME == elem.type() && !visiting[elem.rule()])
+		{
+			visiting[elem.rule()] = true;
+			Rule &rule = m_grammar.rule(elem.rule());
+			if (RuleMod::OPERATORS == rule.mod()) return false;
+			for (auto &alt : m_grammar.alts(rule))
+			{
+				if (!digits_only(alt, visiting)) return false;
+			}
+		}
+		for (auto &sub_elem : m_grammar.subs(elem))
+		{
+			if (Lookahead::NONE == sub_elem.lookahead() && !digits_only(sub_elem, visiting)) return false;
+		}
+		return true;
+	}
+
+	// ------------------------------------------------------------------------
+	// whether captures in element and its sub-elements match only digits
+	bool text_captures_ok(Elem &elem)
+	{
+		if (StrPool::NO_STR != elem.capture_id())
+		{
+			std::vector<bool> visiting(m_grammar.rules().size(), false);
+			if (!digits_only(elem, visiting)) return false;
+		}
+		for (auto &sub_elem : m_grammar.subs(elem))
+		{
+			if (!text_captures_ok(sub_elem)) return false;
+		}
+		return true;
+	}
+
+	// ------------------------------------------------------------------------
+	// whether counts in element and its sub-elements are numbers or names in
+	// captures
+	bool counts_ok(Elem &elem, const std::vector<std::string> &captures)
+	{
+		if (QuantifierType::COUNT == elem.quantifier())
+		{
+			const std::string &count = m_grammar.count(elem);
+			if (!isdigit((uint8_t)count[0])
+				&& std::find(captures.begin(), captures.end(), count) == captures.end()) return false;
+		}
+		for (auto &sub_elem : m_grammar.subs(elem))
+		{
+			if (!counts_ok(sub_elem, captures)) return false;
+		}
+		return true;
+	}
+
+	// ------------------------------------------------------------------------
+	// check for:
+	//  1) named elems referring to non-existent rules
+	//  2) unreachable rules (no usage tracing to root rule)
+	bool check_rules()
+	{
+		if (m_grammar.rules().size() == 0)
+		{
+			eprintln("ERROR: grammar has no rules");
+			return false;
+		}
+		if (!m_grammar.resolve()) return false;
+		m_skip_rule = Elem::NO_RULE;
+		if (!m_grammar.skip().empty())
+		{
+			m_skip_rule = m_grammar.find_rule(m_grammar.skip());
+			if (Elem::NO_RULE == m_skip_rule)
+			{
+				eprintln("ERROR: undefined %skip rule '", m_grammar.skip(), "'");
+				return false;
+			}
+			if (!skip_rule_ok())
+			{
+				eprintln("ERROR: %skip rule '", m_grammar.skip(), "' must be one * or + repetition");
+				return false;
+			}
+		}
+		// reparse() reuses nodes, not values, and needs every node built
+		if (m_incremental && (m_no_tree || m_subscribe || has_values()))
+		{
+			eprintln("ERROR: -i cannot be combined with -n, -m or a %value type");
+			return false;
+		}
+		if (m_bottom_up && m_incremental)
+		{
+			eprintln("ERROR: -b cannot be combined with -i");
+			return false;
+		}
+		// typed nodes are filled as rules match, which reusing or leaving
+		// out ASTNodes does not do
+		if (m_typed && (m_incremental || m_subscribe))
+		{
+			eprintln("ERROR: -t cannot be combined with -i or -m");
+			return false;
+		}
+		if (indexed() && !structural_ok()) return false;
+		for (auto &rule : m_grammar.rules())
+		{
+			if (Rule::NO_NAME != rule.action_id() && !has_values())
+			{
+				eprintln("ERROR: rule '", m_grammar.name(rule), "' has an action but no %value type is given");
+				return false;
+			}
+			char open, close;
+			if (RuleMod::LAZY == rule.mod()
+				&& (!lazy_delims(rule, open, close) || Rule::NO_NAME != rule.action_id()))
+			{
+				eprintln("ERROR: lazy rule '", m_grammar.name(rule), "' must have one alternative starting and ending with different one-character strings, and no action");
+				return false;
+			}
+			std::vector<std::string> captures;
+			for (auto &elem : m_grammar.alts(rule)) collect_captures(elem, captures);
+			if (RuleMod::OPERATORS == rule.mod() && !captures.empty())
+			{
+				eprintln("ERROR: operators rule '", m_grammar.name(rule), "' cannot capture");
+				return false;
+			}
+			// fill() gives one match per rule and position, which neither
+			// climbing nor skipping over a lazy body reproduces
+			if (m_bottom_up && (RuleMod::OPERATORS == rule.mod() || RuleMod::LAZY == rule.mod()))
+			{
+				eprintln("ERROR: ", rule_mod_str(rule.mod()), " rule '", m_grammar.name(rule), "' cannot be used with -b");
+				return false;
+			}
+			// a skipped body has no typed nodes to fill when expanded
+			if (m_typed && RuleMod::LAZY == rule.mod())
+			{
+				eprintln("ERROR: lazy rule '", m_grammar.name(rule), "' cannot be used with -t");
+				return false;
+			}
+			for (auto &elem : m_grammar.alts(rule))
+			{
+				if (m_grammar.bytes() && !byte_classes_ok(elem))
+				{
+					eprintln("ERROR: rule '", m_grammar.name(rule), "' has a character class beyond \\xff in a %bytes grammar");
+					return false;
+				}
+				if (!m_grammar.bytes() && !text_captures_ok(elem))
+				{
+					eprintln("ERROR: rule '", m_grammar.name(rule), "' captures something other than digits 0-9 in a text grammar");
+					return false;
+				}
+				if (!counts_ok(elem, captures))
+				{
+					eprintln("ERROR: rule '", m_grammar.name(rule), "' has a count naming none of its captures");
+					return false;
+				}
+			}
+		}
+		m_rule_heat.assign(m_grammar.rules().size(), RuleHeat::NORMAL);
+
+		std::vector<bool> visited(m_grammar.rules().size(), false);
+		std::vector<uint32_t> to_visit;
+		// initialize to_visit list with root rule (and skip rule)
+		visited[m_grammar.rule_root()] = true;
+		to_visit.push_back(m_grammar.rule_root());
+		if (Elem::NO_RULE != m_skip_rule && !visited[m_skip_rule])
+		{
+			visited[m_skip_rule] = true;
+			to_visit.push_back(m_skip_rule);
+		}
+		// loop until to_visit list is empty
+		while (to_visit.size() > 0)
+		{
+			uint32_t rule_id = to_visit.back();
+			to_visit.pop_back();
+			// loop over child elems
+			Rule &rule = m_grammar.rule(rule_id);
+			for (auto &elem : m_grammar.alts(rule))
+			{
+				check_rule_elems(elem, to_visit, visited);
+			}
+			if (Elem::NO_RULE != rule.op_skip() && !visited[rule.op_skip()])
+			{
+				visited[rule.op_skip()] = true;
+				to_visit.push_back(rule.op_skip());
+			}
+		}
+
+		// rules called from predicates (or by skip() unless fused), directly
+		// or not, need check_*(); with -b, predicates read the table instead
+		m_checked.assign(m_grammar.rules().size(), false);
+		to_visit.clear();
+		for (auto &rule : m_grammar.rules())
+		{
+			if (m_bottom_up) break;
+			for (auto &elem : m_grammar.alts(rule)) collect_predicate_callees(elem, to_visit);
+		}
+		uint32_t bits[8];
+		if (Elem::NO_RULE != m_skip_rule && !skip_fused(bits)) to_visit.push_back(m_skip_rule);
+		while (to_visit.size() > 0)
+		{
+			uint32_t rule_id = to_visit.back();
+			to_visit.pop_back();
+			if (m_checked[rule_id]) continue;
+			m_checked[rule_id] = true;
+			if (RuleMod::OPERATORS != m_grammar.rule(rule_id).mod()) rule_callees(rule_id, to_visit);
+		}
+
+		// 'token' rules, the skip rule and everything they call are lexical
+		m_lexical.assign(m_grammar.rules().size(), false);
+		to_visit.clear();
+		for (uint32_t r = 0; r < m_grammar.rules().size(); r++)
+		{
+			if (m_grammar.rule(r).token()) to_visit.push_back(r);
+		}
+		if (Elem::NO_RULE != m_skip_rule) to_visit.push_back(m_skip_rule);
+		while (to_visit.size() > 0)
+		{
+			uint32_t rule_id = to_visit.back();
+			to_visit.pop_back();
+			if (m_lexical[rule_id]) continue;
+			m_lexical[rule_id] = true;
+			rule_callees(rule_id, to_visit);
+		}
+
+		// print unreachable rules
+		bool retval = true;
+		for (uint32_t r = 0; r < visited.size(); r++)
+		{
+			if (!visited[r])
+			{
+				eprintln("ERROR: unreachable rule '", m_grammar.name(r), "'");
+				retval = false;
+			}
+		}
+		if (retval && m_bottom_up) retval = order_fill();
+
+		return retval;
+	}
+
+	// ------------------------------------------------------------------------
+	// for -b, find the rules that call themselves where their match starts
+	// (m_left_rec) and the groups fill() fills the table by (m_fill_groups)
+	//
+	// a rule's column only depends on the columns of the rules it calls, so
+	// strongly connected components of the call graph are filled callees
+	// first. Within a component, a call where the caller's match starts
+	// reads the same position, so those calls must not form a cycle other
+	// than a rule calling itself; members are ordered callees first by
+	// them. Returns false, printing why, if they do or a left-recursive rule
+	// needs what growing its match cannot give
+	bool order_fill()
+	{
+		uint32_t n_rules = m_grammar.rules().size();
+		analyze_first();
+		std::vector<std::vector<uint32_t>> callees(n_rules), left_callees(n_rules);
+		m_left_rec.assign(n_rules, false);
+		m_rep_base.assign(n_rules, 0);
+		m_n_reps = 0;
+		for (uint32_t r = 0; r < n_rules; r++)
+		{
+			m_rep_base[r] = m_n_reps;
+			for (auto &alt : m_grammar.alts(m_grammar.rule(r))) m_n_reps += count_reps(alt);
+			rule_callees(r, callees[r]);
+			for (auto &alt : m_grammar.alts(m_grammar.rule(r))) alt_left_callees(alt, left_callees[r]);
+			for (auto callee_id : left_callees[r]) m_left_rec[r] = m_left_rec[r] || callee_id == r;
+		}
+		for (uint32_t r = 0; r < n_rules; r++)
+		{
+			if (!m_left_rec[r]) continue;
+			Rule &rule = m_grammar.rule(r);
+			// the tree is grown with placeholders for one node (see grow())
+			if ((RuleMod::NONE != rule.mod() && RuleMod::COLLAPSE != rule.mod())
+				|| Rule::NO_NAME != rule.action_id() || m_no_tree || m_subscribe || m_typed || has_values())
+			{
+				eprintln("ERROR: left-recursive rule '", m_grammar.name(rule), "' needs no modifier but collapse, no action, and a tree without -n, -m, -t or %value");
+				return false;
+			}
+			// skip() runs top-down check_*() functions
+			if (m_checked[r])
+			{
+				eprintln("ERROR: left-recursive rule '", m_grammar.name(rule), "' cannot be reached from the %skip rule");
+				return false;
+			}
+		}
+
+		// Tarjan's algorithm, which finds components callees first
+		m_fill_groups.clear();
+		std::vector<uint32_t> index(n_rules, 0), low(n_rules, 0), stack;
+		std::vector<bool> on_stack(n_rules, false);
+		uint32_t next_index = 1;
+		for (uint32_t r = 0; r < n_rules; r++)
+		{
+			if (0 == index[r]) scc_visit(r, callees, index, low, stack, on_stack, next_index);
+		}
+
+		// order members by their calls where matches start
+		for (auto &group : m_fill_groups)
+		{
+			if (!group.recursive) continue;
+			std::vector<uint32_t> order;
+			std::vector<bool> placed(n_rules, true);
+			for (auto r : group.rules) placed[r] = false;
+			while (order.size() < group.rules.size())
+			{
+				bool progress = false;
+				for (auto r : group.rules)
+				{
+					if (placed[r]) continue;
+					bool ready = true;
+					for (auto callee_id : left_callees[r]) ready = ready && (placed[callee_id] || callee_id == r);
+					if (!ready) continue;
+					placed[r] = true;
+					order.push_back(r);
+					progress = true;
+				}
+				if (progress) continue;
+				std::string names;
+				for (auto r : group.rules)
+				{
+					if (!placed[r]) names += (names.empty() ? "'" : ", '") + m_grammar.name(r) + "'";
+				}
+				eprintln("ERROR: rules ", names, " call each other where their matches start, which -b does not support");
+				return false;
+			}
+			group.rules = order;
+		}
+		return true;
+	}
+
+	// ------------------------------------------------------------------------
+	// number of repetitions (* and +) in element and its sub-elements
+	uint32_t count_reps(Elem &elem)
+	{
+		uint32_t n = (QuantifierType::ZERO_PLUS == elem.quantifier() || QuantifierType::ONE_PLUS == elem.quantifier()) ? 1 : 0;
+		for (auto &sub_elem : m_grammar.subs(elem)) n += count_reps(sub_elem);
+		return n;
+	}
+
+	// ------------------------------------------------------------------------
+	// whether where a repetition's loop ends depends only on where it
+	// starts: nothing in it captures, counts by a capture or cuts
+	bool rep_cacheable(Elem &elem, bool outer = true)
+	{
+		if (!outer && StrPool::NO_STR != elem.capture_id()) return false;
+		if (ElemType::CUT == elem.type()) return false;
+		if (QuantifierType::COUNT == elem.quantifier() && !isdigit((uint8_t)m_grammar.count(elem)[0])) return false;
+		for (auto &sub_elem : m_grammar.subs(elem))
+		{
+			if (!rep_cacheable(sub_elem, false)) return false;
+		}
+		return true;
+	}
+
+	// ------------------------------------------------------------------------
+	// visit rule_id for order_fill(), adding its component to m_fill_groups
+	// once all of it is found
+	void scc_visit(uint32_t rule_id, const std::vector<std::vector<uint32_t>> &callees,
+		std::vector<uint32_t> &index, std::vector<uint32_t> &low, std::vector<uint32_t> &stack,
+		std::vector<bool> &on_stack, uint32_t &next_index)
+	{
+		index[rule_id] = low[rule_id] = next_index++;
+		stack.push_back(rule_id);
+		on_stack[rule_id] = true;
+		bool calls_self = false;
+		for (auto callee_id : callees[rule_id])
+		{
+			calls_self = calls_self || callee_id == rule_id;
+			if (0 == index[callee_id])
+			{
+				scc_visit(callee_id, callees, index, low, stack, on_stack, next_index);
+				low[rule_id] = std::min(low[rule_id], low[callee_id]);
+			}
+			else if (on_stack[callee_id]) low[rule_id] = std::min(low[rule_id], index[callee_id]);
+		}
+		if (low[rule_id] != index[rule_id]) return;
+		FillGroup group;
+		uint32_t member;
+		do
+		{
+			member = stack.back();
+			stack.pop_back();
+			on_stack[member] = false;
+			group.rules.push_back(member);
+		}
+		while (member != rule_id);
+		std::reverse(group.rules.begin(), group.rules.end());
+		group.recursive = group.rules.size() > 1 || calls_self;
+		m_fill_groups.push_back(group);
+	}
+
+	// ------------------------------------------------------------------------
+	// append ids of rules alternate calls where its match starts: those of
+	// its elements up to the first that cannot match empty, and those in
+	// predicates, which match where they are
+	bool alt_left_callees(Elem &alt, std::vector<uint32_t> &callees)
+	{
+		for (auto &sub_elem : m_grammar.subs(alt))
+		{
+			if (!elem_left_callees(sub_elem, callees)) return false;
+		}
+		return true;
+	}
+
+	// ------------------------------------------------------------------------
+	// append ids of rules element calls where its match starts; returns true
+	// if it is nullable, i.e. the next element may start there too
+	bool elem_left_callees(Elem &elem, std::vector<uint32_t> &callees)
+	{
+		if (ElemType::NAME == elem.type()) callees.push_back(elem.rule());
+		else if (ElemType::GROUP == elem.type())
+		{
+			for (auto &alt : m_grammar.subs(elem)) alt_left_callees(alt, callees);
+		}
+		std::bitset<256> first;
+		return elem_first(elem, first);
+	}
+
+	// ------------------------------------------------------------------------
+	// rules : ws (comment ws)* rule+;
+	bool parse_grammar(const char *text_r)
+	{
+		if (SCC_DEBUG) eprintln("parse_grammar ", m_pos);
+		m_text = text_r;
+
+		parse_ws();
+		uint32_t m_pos_prev;
+		do
+		{
+			m_pos_prev = m_pos;
+			parse_comment();
+			parse_ws();
+		}
+		while (m_text[m_pos] != '\0' && m_pos_prev != m_pos);
+
+		while (m_text[m_pos] != '\0')
+		{
+			bool ok;
+			if ('%' != m_text[m_pos]) ok = parse_rule();
+			else if (m_grammar.rules().size() > 0)
+			{
+				eprintln("ERROR: directives must come before the first rule");
+				return false;
+			}
+			else ok = parse_directive();
+			if (!ok) return false;
+		}
+
+		return true;
+	}
+
+	// ------------------------------------------------------------------------
+	// directive : "%" id ws [^;]* ";" ws (comment ws)*;
+	// "%value TYPE;", the C++ type of action values, the "%lazy_quotes
+	// CHARS;" and "%lazy_comment STR;" settings of 'lazy' rule scanning, and
+	// "%bytes;" for grammars over raw bytes, "%skip RULE;", the rule run
+	// between tokens, and "%structural CHARS;", the characters indexed
+	// before parsing (with string escapes, e.g. \n or \x3b for ';'), and
+	// "%structural_escape CHAR;", the escape in quoted strings (default \\,
+	// none if empty)
+	bool parse_directive()
+	{
+		if (SCC_DEBUG) eprintln("parse_directive ", m_pos);
+		m_pos++;
+		m_col++;
+		int32_t len_name = parse_id();
+		if (len_name <= 0) return false;
+		std::string name(&m_text[m_pos - len_name], len_name);
+		parse_ws();
+
+		uint32_t arg_start = m_pos;
+		while (m_text[m_pos] != '\0' && m_text[m_pos] != ';' && m_text[m_pos] != '\n')
+		{
+			m_pos++;
+			m_col++;
+		}
+		if (m_text[m_pos] != ';') return false;
+		std::string arg(&m_text[arg_start], m_pos - arg_start);
+		while (!arg.empty() && isspace((unsigned char)arg.back())) arg.pop_back();
+		m_pos++;
+		m_col++;
+
+		if ("value" == name && !arg.empty()) m_grammar.value_type() = arg;
+		else if ("lazy_quotes" == name) m_grammar.lazy_quotes() = arg;
+		else if ("lazy_comment" == name) m_grammar.lazy_comment() = arg;
+		else if ("bytes" == name && arg.empty()) m_grammar.bytes() = true;
+		else if ("skip" == name && !arg.empty()) m_grammar.skip() = arg;
+		else if ("structural" == name && !arg.empty()) m_grammar.structural() = unescape_string("\"" + arg + "\"");
+		else if ("structural_escape" == name) m_grammar.structural_escape() = unescape_string("\"" + arg + "\"");
+		else
+		{
+			eprintln("ERROR: invalid directive '%", name, "'");
+			return false;
+		}
+
+		parse_ws();
+		uint32_t m_pos_prev;
+		do
+		{
+			m_pos_prev = m_pos;
+			parse_comment();
+			parse_ws();
+		}
+		while (m_text[m_pos] != '\0' && m_pos_prev != m_pos);
+		return true;
+	}
+
+	// ------------------------------------------------------------------------
+	// rule : ws id ws ("discard" | "inline" | "mergeup" | "collapse" | "lazy")? ws ":" ws alts ws action? ";" ws (comment ws)*;
+	bool parse_rule()
+	{
+		if (SCC_DEBUG) eprintln("parse_rule ", m_pos);
+		parse_ws();
+
+		int32_t len_name = parse_id();
+		if (len_name <= 0) return false;
+
+		// first parsed rule (id 0) is root of grammar
+		std::string rule_name(&m_text[m_pos - len_name], len_name);
+		uint32_t rule_id = m_grammar.add_rule(rule_name);
+		if (Elem::NO_RULE == rule_id)
+		{
+			eprintln("ERROR: duplicate rule name '", rule_name, "'");
+			return false;
+		}
+
+		parse_ws();
+
+		// optional 'token' flag, then rule modifier
+		int32_t len_mod = parse_id();
+		if (len_mod > 0 && std::string(&m_text[m_pos - len_mod], len_mod) == "token")
+		{
+			m_grammar.rule(rule_id).token() = true;
+			parse_ws();
+			len_mod = parse_id();
+		}
+		if (len_mod > 0)
+		{
+			std::string rule_mod(&m_text[m_pos - len_mod], len_mod);
+			RuleMod &mod = m_grammar.rule(rule_id).mod();
+			if ("discard" == rule_mod) mod = RuleMod::DISCARD;
+			else if ("inline" == rule_mod) mod = RuleMod::INLINE;
+			else if ("mergeup" == rule_mod) mod = RuleMod::MERGEUP;
+			else if ("operators" == rule_mod) mod = RuleMod::OPERATORS;
+			else if ("collapse" == rule_mod) mod = RuleMod::COLLAPSE;
+			else if ("lazy" == rule_mod) mod = RuleMod::LAZY;
+			else return false;
+		}
+
+		parse_ws();
+
+		if (m_text[m_pos] != ':') return false;
+		m_pos++;
+		m_col++;
+
+		parse_ws();
+
+		std::vector<Elem> alts;
+		if (RuleMod::OPERATORS == m_grammar.rule(rule_id).mod())
+		{
+			if (!parse_op_table(rule_id, alts)) return false;
+		}
+		else
+		{
+			int32_t len_alts = parse_alts(alts);
+			if (-1 == len_alts) return false;
+		}
+		m_grammar.set_alts(m_grammar.rule(rule_id), alts);
+
+		parse_ws();
+
+		if ('{' == m_text[m_pos])
+		{
+			if (RuleMod::OPERATORS == m_grammar.rule(rule_id).mod())
+			{
+				eprintln("ERROR: 'operators' rule '", rule_name, "' cannot have an action");
+				return false;
+			}
+			if (!parse_action(rule_id)) return false;
+			parse_ws();
+		}
+
+		if (m_text[m_pos] != ';') return false;
+		m_pos++;
+		m_col++;
+
+		parse_ws();
+		uint32_t m_pos_prev;
+		do
+		{
+			m_pos_prev = m_pos;
+			parse_comment();
+			parse_ws();
+		}
+		while (m_text[m_pos] != '\0' && m_pos_prev != m_pos);
+
+		if (SCC_DEBUG) eprintln("exiting parse_rule ", m_pos);
+		return true;
+	}
+
+// private methods
+private:
+	// ------------------------------------------------------------------------
+	// action : "{" ([^{}"'] | quoted | action)* "}";
+	// C++ code between balanced braces (outside string and character
+	// literals), stored without the outer braces
+	bool parse_action(uint32_t rule_id)
+	{
+		if (SCC_DEBUG) eprintln("parse_action ", m_pos);
+		uint32_t depth = 0;
+		uint32_t start = m_pos + 1;
+		char quote = '\0';
+		for (;;)
+		{
+			char ch = m_text[m_pos];
+			if ('\0' == ch)
+			{
+				eprintln("ERROR: unterminated action");
+				return false;
+			}
+			m_pos++;
+			m_col++;
+			if ('\n' == ch)
+			{
+				m_line++;
+				m_col = 1;
+			}
+			if ('\0' != quote)
+			{
+				if ('\\' == ch && '\0' != m_text[m_pos])
+				{
+					m_pos++;
+					m_col++;
+				}
+				else if (quote == ch) quote = '\0';
+			}
+			else if ('"' == ch || '\'' == ch) quote = ch;
+			else if ('{' == ch) depth++;
+			else if ('}' == ch && 0 == --depth) break;
+		}
+		std::string code(&m_text[start], m_pos - 1 - start);
+		m_grammar.rule(rule_id).action_id() = m_grammar.strs().intern(code);
+		return true;
+	}
+
+	// ------------------------------------------------------------------------
+	// ws discard : [ \n\r\t]*;
+	// parse and discard whitespace
+	void parse_ws()
+	{
+		if (SCC_DEBUG) eprintln("parse_ws");
+		for (;;)
+		{
+			char ch = m_text[m_pos];
+			if (ch == ' ' || ch == '\t' || ch == '\r')
+			{
+				m_pos++;
+				if (ch != '\r') m_col++;
+				continue;
+			}
+			else if (ch == '\n')
+			{
+				m_pos++;
+				m_line++;
+				m_col = 1;
+				continue;
+			}
+			break;
+		}
+	}
+
+	// ------------------------------------------------------------------------
+	// comment discard : "#" [^\r\n]*;
+	// parse and discard comment
+	void parse_comment()
+	{
+		if (SCC_DEBUG) eprintln("parse_comment");
+		char ch = m_text[m_pos];
+		if (ch != '#') return;
+		for (;;)
+		{
+			m_pos++;
+			m_col++;
+			ch = m_text[m_pos];
+			if (ch == '\r' || ch == '\n' || ch == '\0') break;
+		}
+	}
+
+	// ------------------------------------------------------------------------
+	// id : [A-Za-z][0-9A-Za-z_]*;
+	// returns length on success, -1 on failure
+	int32_t parse_id()
+	{
+		if (SCC_DEBUG) eprintln("parse_id");
+		int32_t len = 0;
+		char ch = m_text[m_pos];
+		if (!((ch >= 'A' && ch <= 'Z') || (ch >= 'a' && ch <= 'z'))) return -1;
+		m_pos++;
+		m_col++;
+		len++;
+		for (;;)
+		{
+			ch = m_text[m_pos];
+			if (ch == '_' || (ch >= '0' && ch <= '9')
+			|| (ch >= 'A' && ch <= 'Z') || (ch >= 'a' && ch <= 'z'))
+			{
+				m_pos++;
+				m_col++;
+				len++;
+				continue;
+			}
+			return len;
+		}
+	}
+
+	// ------------------------------------------------------------------------
+	// alts : alt (ws "|" ws alt)*;
+	// returns length on success, -1 on failure
+	int32_t parse_alts(std::vector<Elem> &elems)
+	{
+		if (SCC_DEBUG) eprintln("parse_alts");
+		int32_t len = 0;
+		bool trailing_bar;
+		while (m_text[m_pos] != '\0')
+		{
+			std::vector<Elem> sub_elems;
+			int32_t len_el = parse_alt(sub_elems);
+			if (-1 == len_el) break;
+			Elem elem_alt(ElemType::ALT);
+			m_grammar.set_subs(elem_alt, sub_elems);
+			len += len_el;
+			trailing_bar = false;
+			elems.push_back(elem_alt);
+
+			parse_ws();
+
+			char ch = m_text[m_pos];
+			if (ch == '|')
+			{
+				trailing_bar = true;
+				m_pos++;
+				m_col++;
+				len++;
+
+				parse_ws();
+				continue;
+			}
+			break;
+		}
+		if (len <= 0 || trailing_bar) return -1;
+		return len;
+	}
+
+	// ------------------------------------------------------------------------
+	// body of an 'operators' rule: the operand, then precedence levels from
+	// lowest to highest and optionally a rule to skip around operators
+	// op_table : alt (ws "|" ws id ws (op_kind (ws string)+ | "skip"))+;
+	// returns false on failure
+	bool parse_op_table(uint32_t rule_id, std::vector<Elem> &elems)
+	{
+		if (SCC_DEBUG) eprintln("parse_op_table ", m_pos);
+		std::vector<Elem> sub_elems;
+		if (-1 == parse_alt(sub_elems)) return false;
+		Elem elem_alt(ElemType::ALT);
+		m_grammar.set_subs(elem_alt, sub_elems);
+		elems.push_back(elem_alt);
+
+		parse_ws();
+		while (m_text[m_pos] == '|')
+		{
+			m_pos++;
+			m_col++;
+			parse_ws();
+
+			int32_t len_name = parse_id();
+			if (len_name <= 0) return false;
+			std::string level_name(&m_text[m_pos - len_name], len_name);
+			parse_ws();
+
+			int32_t len_kind = parse_id();
+			if (len_kind <= 0) return false;
+			std::string kind_name(&m_text[m_pos - len_kind], len_kind);
+			parse_ws();
+			if ("skip" == kind_name)
+			{
+				Rule &rule = m_grammar.rule(rule_id);
+				if (Rule::NO_NAME != rule.op_skip_name_id()) return false;
+				rule.op_skip_name_id() = m_grammar.strs().intern(level_name);
+				continue;
+			}
+			OpKind kind;
+			if ("left" == kind_name) kind = OpKind::LEFT;
+			else if ("right" == kind_name) kind = OpKind::RIGHT;
+			else if ("prefix" == kind_name) kind = OpKind::PREFIX;
+			else if ("postfix" == kind_name) kind = OpKind::POSTFIX;
+			else
+			{
+				eprintln("ERROR: operator kind must be left, right, prefix, postfix or skip, not '", kind_name, "'");
+				return false;
+			}
+
+			std::vector<Elem> op_elems;
+			while (parse_string(op_elems) > 0) parse_ws();
+			if (op_elems.empty()) return false;
+			std::vector<std::string> toks;
+			for (auto &op_elem : op_elems)
+			{
+				toks.push_back(m_grammar.tok(op_elem, 0));
+				if (unescape_string(toks.back()).empty())
+				{
+					eprintln("ERROR: empty operator in level '", level_name, "'");
+					return false;
+				}
+			}
+			m_grammar.add_op_level(m_grammar.rule(rule_id), level_name, kind, toks);
+		}
+		if (0 == m_grammar.rule(rule_id).op_count())
+		{
+			eprintln("ERROR: operators rule '", m_grammar.name(rule_id), "' has no operator levels");
+			return false;
+		}
+		return true;
+	}
+
+	// ------------------------------------------------------------------------
+	// alt : elem (ws elem)*;
+	// returns length on success, -1 on failure
+	int32_t parse_alt(std::vector<Elem> &elems)
+	{
+		if (SCC_DEBUG) eprintln("parse_alt ", m_pos);
+		int32_t len = 0;
+		while (m_text[m_pos] != '\0')
+		{
+			int32_t len_el = parse_element(elems);
+			if (len_el <= 0) break;
+			len += len_el;
+
+			parse_ws();
+		}
+		if (len <= 0) return -1;
+		return len;
+	}
+
+	// ------------------------------------------------------------------------
+	// elem mergeup: cut | predicate? capture? (group | until | id | ch_class | string) ([?*+] | count)?;
+	// returns length on success, -1 on failure
+	int32_t parse_element(std::vector<Elem> &elems)
+	{
+		if (SCC_DEBUG) eprintln("parse_element");
+
+		int32_t len = 0;
+		while (m_text[m_pos] != ';' && m_text[m_pos] != '\0')
+		{
+			// optional lookahead predicate prefix
+			Lookahead lookahead = Lookahead::NONE;
+			size_t n_elems = elems.size();
+			if ('&' == m_text[m_pos] || '!' == m_text[m_pos])
+			{
+				lookahead = ('&' == m_text[m_pos]) ? Lookahead::AND : Lookahead::NOT;
+				m_pos++;
+				m_col++;
+				len++;
+				parse_ws();
+			}
+
+			// optional capture prefix
+			uint32_t capture_id = parse_capture();
+			if (StrPool::NO_STR != capture_id) len += m_grammar.strs().str(capture_id).size() + 1;
+
+			int32_t len_item;
+			for (int32_t i = 0; i < 1; i++)
+			{
+				// cut : "~";
+				if ('~' == m_text[m_pos])
+				{
+					m_pos++;
+					m_col++;
+					Elem elem(ElemType::CUT);
+					m_grammar.set_tok(elem, "~");
+					elems.push_back(elem);
+					len_item = 1;
+					len += len_item;
+					break;
+				}
+				len_item = parse_group(elems);
+				if (len_item > 0)
+				{
+					len += len_item;
+					break;
+				}
+				len_item = parse_until(elems);
+				if (len_item > 0)
+				{
+					len += len_item;
+					break;
+				}
+				len_item = parse_id();
+				if (len_item > 0)
+				{
+					std::string name(&m_text[m_pos - len_item], len_item);
+					Elem elem(ElemType::NAME);
+					m_grammar.set_tok(elem, name);
+					elems.push_back(elem);
+					len += len_item;
+					break;
+				}
+				len_item = parse_ch_class(elems);
 				if (len_item > 0)
 				{
-					len += len_item;
-					break;
+					len += len_item;
+					break;
+				}
+				len_item = parse_string(elems);
+				if (len_item >= 0)
+				{
+					len += len_item;
+					break;
+				}
+			}
+
+			if (len <= 0) return -1;
+			if ((Lookahead::NONE != lookahead || StrPool::NO_STR != capture_id)
+				&& elems.size() == n_elems) return -1;
+
+			// a count must follow its element directly, which tells it from
+			// the rule's action
+			int32_t len_count = (elems.size() > n_elems) ? parse_count(elems[elems.size() - 1]) : -1;
+			if (len_count > 0) len += len_count;
+
+			parse_ws();
+
+			// the last pass, at the end of a group or alternative, pushes no
+			// element and must leave the one before it alone
+			if (elems.size() == n_elems) break;
+
+			char ch = m_text[m_pos];
+			if (len_count > 0) {}
+			else if (ch == '?' || ch == '*' || ch == '+')
+			{
+				QuantifierType qt;
+				if (ch == '?') qt = QuantifierType::ZERO_ONE;
+				else if (ch == '*') qt = QuantifierType::ZERO_PLUS;
+				else if (ch == '+') qt = QuantifierType::ONE_PLUS;
+				elems[elems.size() - 1].quantifier() = qt;
+				m_pos++;
+				m_col++;
+				len++;
+
+				parse_ws();
+			}
+			Elem &last = elems[elems.size() - 1];
+			if (Lookahead::NONE != lookahead) last.lookahead() = lookahead;
+			last.capture_id() = capture_id;
+			if (ElemType::CUT == last.type()
+				&& (Lookahead::NONE != last.lookahead() || QuantifierType::ONE != last.quantifier()
+				|| StrPool::NO_STR != last.capture_id()))
+			{
+				eprintln("ERROR: a cut (~) cannot have a quantifier, predicate or capture");
+				return -1;
+			}
+
+			if (len_item <= 0) break;
+		}
+
+		return len;
+	}
+
+	// ------------------------------------------------------------------------
+	// capture : id "=";
+	// returns string id of the name, or StrPool::NO_STR (without moving) if
+	// there is no capture
+	uint32_t parse_capture()
+	{
+		if (SCC_DEBUG) eprintln("parse_capture ", m_pos);
+		uint32_t pos_prev = m_pos;
+		uint32_t col_prev = m_col;
+		int32_t len_id = parse_id();
+		if (len_id <= 0 || '=' != m_text[m_pos])
+		{
+			m_pos = pos_prev;
+			m_col = col_prev;
+			return StrPool::NO_STR;
+		}
+		uint32_t id = m_grammar.strs().intern(std::string(&m_text[pos_prev], len_id));
+		m_pos++;
+		m_col++;
+		return id;
+	}
+
+	// ------------------------------------------------------------------------
+	// count : "{" (id | [0-9]+) "}";
+	// makes elem match exactly that many times
+	// returns length on success, -1 (without moving) on failure
+	int32_t parse_count(Elem &elem)
+	{
+		if (SCC_DEBUG) eprintln("parse_count ", m_pos);
+		if ('{' != m_text[m_pos]) return -1;
+		uint32_t end = m_pos + 1;
+		if (isdigit((uint8_t)m_text[end]))
+		{
+			while (isdigit((uint8_t)m_text[end])) end++;
+		}
+		else if (isalpha((uint8_t)m_text[end]))
+		{
+			while (isalnum((uint8_t)m_text[end]) || '_' == m_text[end]) end++;
+		}
+		if ('}' != m_text[end] || end == m_pos + 1) return -1;
+		elem.quantifier() = QuantifierType::COUNT;
+		elem.count_id() = m_grammar.strs().intern(std::string(&m_text[m_pos + 1], end - m_pos - 1));
+		int32_t len = end + 1 - m_pos;
+		m_pos += len;
+		m_col += len;
+		return len;
+	}
+
+	// ------------------------------------------------------------------------
+	// until : "until" ws string;
+	// matches input up to and including the first occurrence of the string
+	// returns length on success, -1 on failure
+	int32_t parse_until(std::vector<Elem> &elems)
+	{
+		if (SCC_DEBUG) eprintln("parse_until ", m_pos);
+		uint32_t pos_prev = m_pos;
+		uint32_t col_prev = m_col;
+		uint32_t line_prev = m_line;
+		int32_t len_id = parse_id();
+		bool is_until = (len_id > 0 && std::string(&m_text[m_pos - len_id], len_id) == "until");
+		if (is_until) parse_ws();
+		std::vector<Elem> strs;
+		if (!is_until || parse_string(strs) < 0)
+		{
+			m_pos = pos_prev;
+			m_col = col_prev;
+			m_line = line_prev;
+			return -1;
+		}
+		std::string str = m_grammar.tok(strs[0], 0);
+		Elem elem(ElemType::UNTIL);
+		m_grammar.set_tok(elem, str);
+		elems.push_back(elem);
+		return m_pos - pos_prev;
+	}
+
+	// ------------------------------------------------------------------------
+	// group : "(" ws alts ws ")";
+	// returns length on success, -1 on failure
+	int32_t parse_group(std::vector<Elem> &elems)
+	{
+		if (SCC_DEBUG) eprintln("parse_group");
+
+		uint32_t pos_prev = m_pos;
+		uint32_t col_prev = m_col;
+		uint32_t line_prev = m_line;
+		int32_t len = 0;
+
+		char ch = m_text[m_pos];
+		if (ch != '(')
+		{
+			pos_prev = m_pos;
+			col_prev = m_col;
+			line_prev = m_line;
+			return -1;
+		}
+		m_pos++;
+		m_col++;
+		len++;
+
+		parse_ws();
+
+		std::vector<Elem> alts;
+		int32_t len_alts = parse_alts(alts);
+		if (len_alts < 0)
+		{
+			pos_prev = m_pos;
+			col_prev = m_col;
+			line_prev = m_line;
+			return -1;
+		}
+		len += len_alts;
+
+		parse_ws();
+
+		ch = m_text[m_pos];
+		if (ch != ')')
+		{
+			pos_prev = m_pos;
+			col_prev = m_col;
+			line_prev = m_line;
+			return -1;
+		}
+		Elem elem_group(ElemType::GROUP);
+		m_grammar.set_subs(elem_group, alts);
+		elems.push_back(elem_group);
+		m_pos++;
+		m_col++;
+		len++;
+
+		return len;
+	}
+
+	// ------------------------------------------------------------------------
+	// string : "\"" char* "\"";
+	// parse literal string in double quotes
+	// returns length on success, -1 on failure
+	int32_t parse_string(std::vector<Elem> &elems)
+	{
+		if (SCC_DEBUG) eprintln("parse_string ", m_pos);
+		uint32_t pos_prev = m_pos;
+		uint32_t col_prev = m_col;
+		uint32_t line_prev = m_line;
+		char ch = m_text[m_pos];
+		if (ch != '"') return -1;
+		int32_t len = 1;
+		m_pos++;
+		m_col++;
+		bool esc_set = false;
+		for (;; m_pos++, m_col++, len++)
+		{
+			ch = m_text[m_pos];
+			if (ch < ' ') break;
+			if (ch == '\\' && !esc_set)
+			{
+				esc_set = true;
+				continue;
+			}
+			if (ch == '"' && !esc_set)
+			{
+				m_pos++;
+				m_col++;
+				len++;
+				Elem elem(ElemType::STRING);
+				m_grammar.set_tok(elem, std::string(&m_text[m_pos - len], len));
+				elems.push_back(elem);
+				return len;
+			}
+			esc_set = false;
+		}
+		m_pos = pos_prev;
+		m_col = col_prev;
+		m_line = line_prev;
+		return -1;
+	}
+
+	// ------------------------------------------------------------------------
+	// ch_class : "[" "^"? ch_class_range ("!"? ch_class_range)* "]";
+	// parse bracket expression
+	// returns length on success, -1 on failure
+	int32_t parse_ch_class(std::vector<Elem> &elems)
+	{
+		if (SCC_DEBUG) eprintln("parse_ch_class ", m_pos);
+
+		uint32_t pos_prev = m_pos;
+		uint32_t col_prev = m_col;
+		uint32_t line_prev = m_line;
+
+		int32_t len = 0;
+
+		char ch = m_text[m_pos];
+		if (ch != '[')
+		{
+			if (SCC_DEBUG) eprintln("exiting parse_ch_class ", len);
+			return -1;
+		}
+
+		std::vector<std::string> toks;
+		toks.push_back("[");
+
+		m_pos++;
+		m_col++;
+		len++;
+		ch = m_text[m_pos];
+
+		// optional logical not for entire expression
+		if (ch == '^')
+		{
+			toks.push_back("^");
+			m_pos++;
+			m_col++;
+			len++;
+			ch = m_text[m_pos];
+		}
+
+		// first range is required
+		int32_t len_br = parse_ch_class_range(toks);
+		if (-1 == len_br)
+		{
+			m_pos = pos_prev;
+			m_col = col_prev;
+			m_line = line_prev;
+			if (SCC_DEBUG) eprintln("exiting parse_ch_class ", len);
+			return -1;
+		}
+		len += len_br;
+
+		// 0 or more additional ranges
+		for (;;)
+		{
+			ch = m_text[m_pos];
+			if (ch == ']') break;
+
+			size_t n_toks_prev = toks.size();
+			int32_t len_range = 0;
+			uint32_t pos_prev_range = m_pos;
+			uint32_t col_prev_range = m_col;
+			uint32_t line_prev_range = m_line;
+
+			// optional logical not for this range
+			if (ch == '!')
+			{
+				toks.push_back("!");
+				m_pos++;
+				m_col++;
+				len_range++;
+			}
+
+			len_br = parse_ch_class_range(toks);
+			if (-1 == len_br)
+			{
+				m_pos = pos_prev_range;
+				m_col = col_prev_range;
+				m_line = line_prev_range;
+				toks.resize(n_toks_prev);
+				break;
+			}
+			len += len_range + len_br;
+		}
+
+		ch = m_text[m_pos];
+		if (ch != ']' || len <= 0)
+		{
+			m_pos = pos_prev;
+			m_col = col_prev;
+			m_line = line_prev;
+			len = -1;
+		}
+		else
+		{
+			toks.push_back("]");
+			Elem elem(ElemType::CH_CLASS);
+			m_grammar.set_toks(elem, toks);
+			elems.push_back(elem);
+			m_pos++;
+			m_col++;
+			len++;
+		}
+
+		if (SCC_DEBUG) eprintln("exiting parse_ch_class ", len);
+		return len;
+	}
+
+	// ------------------------------------------------------------------------
+	// ch_class_range inline : property | char ("-" char)?;
+	// returns length on success, -1 on failure
+	int32_t parse_ch_class_range(std::vector<std::string> &toks)
+	{
+		if (SCC_DEBUG) eprintln("parse_ch_class_range");
+
+		int32_t len = 0;
+
+		char ch = m_text[m_pos];
+		if (ch == ']') return -1;
+
+		// property : "\\p{" [A-Z] [a-z]? "}";
+		// every character of a Unicode general category (e.g. Nd) or major
+		// class (e.g. L)
+		if ('\\' == ch && 'p' == m_text[m_pos + 1] && '{' == m_text[m_pos + 2])
+		{
+			uint32_t end = m_pos + 3;
+			while (isalpha((uint8_t)m_text[end])) end++;
+			std::string name(&m_text[m_pos + 3], end - m_pos - 3);
+			std::vector<std::pair<int32_t, int32_t>> ranges;
+			if ('}' != m_text[end] || !unicode_ranges(name, ranges))
+			{
+				eprintln("ERROR: unknown Unicode property '\\p{", name, "}'");
+				return -1;
+			}
+			len = end + 1 - m_pos;
+			toks.push_back(std::string(&m_text[m_pos], len));
+			m_pos += len;
+			m_col += len;
+			if ('-' == m_text[m_pos])
+			{
+				eprintln("ERROR: a Unicode property cannot be part of a range");
+				return -1;
+			}
+			return len;
+		}
+
+		int32_t len_char = parse_char(toks);
+		if (len_char < 0) return -1;
+
+		// disallow unescaped reserved character
+		if (len_char == 1)
+		{
+			ch = toks.back()[0];
+			for (int32_t i = 0; ch_class_reserve_chars[i] != '\0'; i++)
+			{
+				if (ch == ch_class_reserve_chars[i])
+				{
+					eprintln("###*", ch, "*");
+					return -1;
 				}
-				len_item = parse_id();
-				if (len_item > 0)
+			}
+		}
+
+		len += len_char;
+
+		ch = m_text[m_pos];
+		if (ch != '-') return len;
+		toks.push_back(std::string(&m_text[m_pos], 1));
+		m_pos++;
+		m_col++;
+		len++;
+
+		// cannot end with trailing '-'
+		ch = m_text[m_pos];
+		if (ch == ']') return -1;
+
+		len_char = parse_char(toks);
+		if (len_char < 0) return -1;
+
+		// disallow unescaped reserved character
+		if (len_char == 1)
+		{
+			for (int32_t i = 0; ch_class_reserve_chars[i] != '\0'; i++)
+			{
+				if (ch == ch_class_reserve_chars[i]) return -1;
+			}
+		}
+
+		// error if first element >= second one
+		std::string ch1 = toks[toks.size() - 3];
+		std::string ch2 = toks.back();
+		bool escaped = false;
+		if (decode_to_int32(&escaped, ch1.c_str()) >= decode_to_int32(&escaped, ch2.c_str()))
+		{
+			eprintln("ERROR: invalid range [", ch1, "-", ch2, "]: '", ch1, "' >= '", ch2, "'. left char must be < right char");
+			return -1;
+		}
+
+		len += len_char;
+
+		return len;
+	}
+
+	// ------------------------------------------------------------------------
+	// char inline : [\u0020-\U0010ffff!'!"!\\] | "\\" esc;
+	// esc inline : [!-[\\]^abfnrtv] | "x" hex hex | unicode;
+	// unicode inline : "u" hex hex hex hex | "U00" hex hex hex hex hex hex;
+	// hex inline : [0-9A-Fa-f];
+	// returns length on success, -1 on failure
+	int32_t parse_char(std::vector<std::string> &toks)
+	{
+		if (SCC_DEBUG) eprintln("parse_char");
+		char ch = m_text[m_pos];
+		if (ch >= 0 && ch < ' ') return -1;
+
+		// if high bit set
+		if (ch < 0)
+		{
+			int32_t len = parse_utf8_char();
+			if (len < 0) return -1;
+			toks.push_back(std::string(&m_text[m_pos], len));
+			m_pos += len;
+			m_col += len;
+			return len;
+		}
+
+		bool is_esc = false;
+		if (ch == '\\')
+		{
+			is_esc = true;
+			m_pos++;
+			m_col++;
+			ch = m_text[m_pos];
+		}
+		if (ch >= 0 && ch < ' ') return -1;
+
+		// 1 byte UTF-8 character
+		if (!is_esc)
+		{
+			toks.push_back(std::string(&m_text[m_pos], 1));
+			m_pos++;
+			m_col++;
+			return 1;
+		}
+
+		// single-char escapes
+		for (int32_t i = 0; esc_chars[i] != '\0'; i++)
+		{
+			if (ch == esc_chars[i])
+			{
+				m_pos++;
+				m_col++;
+				toks.push_back(std::string(&m_text[m_pos - 2], 2));
+				return 2;
+			}
+		}
+
+		// \x[0-9A-Fa-f]{2}
+		if (ch == 'x')
+		{
+			m_pos++;
+			m_col++;
+			int32_t i = 0;
+			for (; i < 2 && is_hex_char(m_text[m_pos]); i++, m_pos++, m_col++);
+			if (i < 2) return -1;
+			toks.push_back(std::string(&m_text[m_pos - 4], 4));
+			return 4;
+		}
+
+		// \u[0-9A-Fa-f]{4}
+		if (ch == 'u')
+		{
+			m_pos++;
+			m_col++;
+			int32_t i = 0;
+			for (; i < 4 && is_hex_char(m_text[m_pos]); i++, m_pos++, m_col++);
+			if (i < 4) return -1;
+			toks.push_back(std::string(&m_text[m_pos - 6], 6));
+			return 6;
+		}
+
+		// \U[0-9A-Fa-f]{8}
+		if (ch == 'U')
+		{
+			m_pos++;
+			m_col++;
+			int32_t i = 0;
+			for (; i < 8 && is_hex_char(m_text[m_pos]); i++, m_pos++, m_col++);
+			if (i < 8) return -1;
+			toks.push_back(std::string(&m_text[m_pos - 10], 10));
+			return 10;
+		}
+
+		return -1;
+	}
+
+	// ------------------------------------------------------------------------
+	// returns length on success, -1 on failure
+	int32_t parse_utf8_char()
+	{
+		int32_t n_bytes;
+		uint8_t byte = (uint8_t)m_text[m_pos];
+		// in 1 byte case, return immediately; all others must be validated
+		if ((byte & 0x80) == 0) return 1;
+		else if ((byte & 0xe0) == 0xc0) n_bytes = 2;
+		else if ((byte & 0xf0) == 0xe0) n_bytes = 3;
+		else if ((byte & 0xf8) == 0xf0) n_bytes = 4;
+		else return -1;
+		for (int32_t i = 0; i < n_bytes; i++)
+		{
+			byte = (uint8_t)m_text[m_pos + i];
+			if ((byte & 0xc0) != 0xc0) return -1;
+		}
+		return n_bytes;
+	}
+
+	// ------------------------------------------------------------------------
+	// converts escape sequence string to int32_t and returns on success,
+	// returns -1 on failure
+	//
+	// esc_seq : '\\' esc;
+	// esc inline : [\!\-\[\\\]\^abfnrtv] | unicode;
+	// unicode inline : "u" hex hex hex hex | "U00" hex hex hex hex hex hex;
+	// hex inline : [0-9A-Fa-f];
+	int32_t esc_to_int32(const char *str)
+	{
+		uint32_t i = 0;
+		if (str[i] != '\\') return -1;
+		char ch = str[i + 1];
+		if (ch == 'a') return 0x7;
+		else if (ch == 'b') return 0x8;
+		else if (ch == 'f') return 0xc;
+		else if (ch == 'n') return 0xa;
+		else if (ch == 'r') return 0xd;
+		else if (ch == 't') return 0x9;
+		else if (ch == 'v') return 0xb;
+		else if (ch == '!') return 0x21;
+		else if (ch == '"') return 0x22;
+		//~ else if (ch == '\'') return 0x27;
+		else if (ch == '-') return 0x2d;
+		//~ else if (ch == '?') return 0x3f;
+		else if (ch == '[') return 0x5b;
+		else if (ch == '\\') return 0x5c;
+		else if (ch == ']') return 0x5d;
+		else if (ch == '^') return 0x5e;
+		else if (ch == 'x') return hex_to_int32(&str[i + 2], 2);
+		else if (ch == 'u') return hex_to_int32(&str[i + 2], 4);
+		else if (ch == 'U') return hex_to_int32(&str[i + 2], 8);
+		return -1;
+	}
+
+	// ------------------------------------------------------------------------
+	int32_t decode_to_int32(bool *escaped, const char *str)
+	{
+		if (str[0] == '\\')
+		{
+			*escaped = true;
+			return esc_to_int32(str);
+		}
+		*escaped = false;
+		int32_t val;
+		int32_t len_item = utf8_to_int32(&val, str);
+		return (len_item > 0) ? val : -1;
+	}
+
+	// ------------------------------------------------------------------------
+	// is character in [0-9A-F]
+	bool is_hex_char(char ch)
+	{
+		return ((ch >= '0' && ch <= '9') || (ch >= 'A' && ch <= 'F')
+				|| (ch >= 'a' && ch <= 'f'));
+	}
+
+	// ------------------------------------------------------------------------
+	// convert hex string of 2, 4 or 8 characters to int32_t
+	// returns value on success or -1 on failure
+	int32_t hex_to_int32(const char *str, int32_t len)
+	{
+		if (len != 2 && len != 4 && len != 8) return -1;
+		int32_t val = 0;
+		for (int32_t i = 0; i < len; i++)
+		{
+			val <<= 4;
+			char ch = str[i];
+			if (ch >= '0' && ch <= '9') val += ch - '0';
+			else if (ch >= 'A' && ch <= 'F') val += ch - 'A' + 10;
+			else if (ch >= 'a' && ch <= 'f') val += ch - 'a' + 10;
+			else return -1;
+		}
+		return val;
+	}
+};
+
+// ----------------------------------------------------------------------------
+// recognizer for a parsed grammar, interpreting it the way generated parsers
+// run it, for checking inputs without generating and building a parser
+//
+// ordered choice, greedy repetition, predicates, cuts, captured counts,
+// %skip and 'operators' rules behave as in ParserT; a 'lazy' rule's body is
+// matched, and must end where scanning for its close does. Rule matches are
+// memoized per position, and a rule calling itself where its match starts
+// is grown from its first match, as with -b. Inputs are read in place, and
+// the memo table is kept from one input to the next
+class GrammarMatcher
+{
+// private members
+private:
+	// element matches allowed per input before giving up on it
+	static const uint64_t STEPS_PER_BYTE = 4096;
+
+	// memoized match of a rule at a position, valid while its stamp is that
+	// of the current input
+	struct MemoEntry
+	{
+		uint32_t stamp = 0;
+		// end of match, NO_MATCH if it fails there, including while it is
+		// being matched
+		uint32_t end = 0;
+		// being matched, and called again where it started (left recursion)
+		bool active = false;
+		bool recursed = false;
+	};
+
+	// operator of an 'operators' rule, unescaped
+	struct Op
+	{
+		std::string text;
+		uint32_t level;
+		bool prefix;
+	};
+
+	Grammar &m_grammar;
+	const std::vector<bool> &m_lexical;
+	uint32_t m_skip_rule = Elem::NO_RULE;
+
+	const char *m_in = nullptr;
+	uint32_t m_len = 0;
+	// by position * rule count + rule id
+	std::vector<MemoEntry> m_memo;
+	uint32_t m_stamp = 0;
+	// set by a choice failing past its cut, until a choice or rule takes it
+	bool m_cut_failed = false;
+	uint64_t m_steps = 0;
+	uint64_t m_max_steps = 0;
+
+	// unescaped strings and decoded classes by the element's first token,
+	// made on first use, and operators by 'operators' rule id
+	std::vector<std::string> m_strs;
+	std::vector<ChClass> m_classes;
+	std::vector<bool> m_decoded;
+	std::vector<std::vector<Op>> m_ops;
+
+	// captured values by name id, within one rule's match
+	typedef std::map<uint32_t, uint64_t> Captures;
+
+// public methods
+public:
+	// ------------------------------------------------------------------------
+	// lexical: per rule id, whether no skip rule runs in it (see
+	// ParseGen::lexical())
+	GrammarMatcher(Grammar &grammar, const std::vector<bool> &lexical)
+		: m_grammar(grammar), m_lexical(lexical)
+	{
+		if (!m_grammar.skip().empty()) m_skip_rule = m_grammar.find_rule(m_grammar.skip());
+		m_ops.resize(m_grammar.rules().size());
+		for (uint32_t r = 0; r < m_ops.size(); r++)
+		{
+			Span<OpLevel> levels = m_grammar.op_levels(m_grammar.rule(r));
+			for (uint32_t l = 0; l < levels.size(); l++)
+			{
+				for (uint32_t i = 0; i < levels[l].tok_count; i++)
 				{
-					std::string name(&m_text[m_pos - len_item], len_item);
-					elems.push_back(Elem(ElemType::NAME, name));
-					len += len_item;
-					break;
+					m_ops[r].push_back(Op{unescape_string(m_grammar.tok(levels[l], i)), l,
+						OpKind::PREFIX == levels[l].kind});
 				}
-				len_item = parse_ch_class(elems);
-				if (len_item > 0)
+			}
+		}
+	}
+
+	// ------------------------------------------------------------------------
+	// whether the root rule, then the skip rule, match all len bytes of in,
+	// as Parser::parse() requires; false too if matching takes too long
+	bool matches(const char *in, uint32_t len)
+	{
+		start(in, len);
+		uint32_t end = match_rule(m_grammar.rule_root(), 0);
+		return finished(end);
+	}
+
+	// ------------------------------------------------------------------------
+	// end of elems, elements of an alternate of rule_id, matched one after
+	// another from pos in the len bytes of in, or NO_MATCH
+	uint32_t match_elems(const char *in, uint32_t len, uint32_t pos, uint32_t rule_id, Span<Elem> elems)
+	{
+		start(in, len);
+		Captures captures;
+		for (auto &elem : elems)
+		{
+			if (ElemType::CUT == elem.type()) continue;
+			pos = match_elem(elem, pos, skipping(rule_id), captures);
+			if (NO_MATCH == pos) break;
+		}
+		return (m_steps <= m_max_steps) ? pos : NO_MATCH;
+	}
+
+	// ------------------------------------------------------------------------
+	// whether elems, as for match_elems(), then the skip rule match all of in
+	bool matches_rest(const char *in, uint32_t len, uint32_t rule_id, Span<Elem> elems)
+	{
+		return finished(match_elems(in, len, 0, rule_id, elems));
+	}
+
+	// ------------------------------------------------------------------------
+	// whether binary and postfix operators of 'operators' rule rule_id, each
+	// followed by its operand, then the skip rule match all of in, as they
+	// do after a first operand
+	bool matches_ops(const char *in, uint32_t len, uint32_t rule_id)
+	{
+		start(in, len);
+		return finished(climb_ops(rule_id, 0, 0));
+	}
+
+	static const uint32_t NO_MATCH = 0xffffffff;
+
+// private methods
+private:
+	// ------------------------------------------------------------------------
+	void start(const char *in, uint32_t len)
+	{
+		m_in = in;
+		m_len = len;
+		size_t size = (size_t)(len + 1) * m_grammar.rules().size();
+		if (m_memo.size() < size) m_memo.resize(size);
+		// stamps wrapped: entries of an earlier input could look current
+		if (0 == ++m_stamp)
+		{
+			for (auto &entry : m_memo) entry.stamp = 0;
+			m_stamp = 1;
+		}
+		m_cut_failed = false;
+		m_steps = 0;
+		m_max_steps = STEPS_PER_BYTE * (len + 1);
+	}
+
+	// ------------------------------------------------------------------------
+	// whether a match ending at end, then the skip rule, reach the end of
+	// input in time
+	bool finished(uint32_t end)
+	{
+		if (NO_MATCH != end) end = skip(end);
+		return end == m_len && m_steps <= m_max_steps;
+	}
+
+	// ------------------------------------------------------------------------
+	bool skipping(uint32_t rule_id)
+	{
+		return Elem::NO_RULE != m_skip_rule && rule_id != m_skip_rule
+			&& !(rule_id < m_lexical.size() && m_lexical[rule_id]);
+	}
+
+	// ------------------------------------------------------------------------
+	uint32_t skip(uint32_t pos)
+	{
+		if (Elem::NO_RULE == m_skip_rule) return pos;
+		uint32_t end = match_rule(m_skip_rule, pos);
+		return (NO_MATCH == end) ? pos : end;
+	}
+
+	// ------------------------------------------------------------------------
+	// returns end of rule's match at pos or NO_MATCH
+	uint32_t match_rule(uint32_t rule_id, uint32_t pos)
+	{
+		MemoEntry &entry = m_memo[(size_t)pos * m_grammar.rules().size() + rule_id];
+		if (m_stamp == entry.stamp)
+		{
+			if (entry.active) entry.recursed = true;
+			return entry.end;
+		}
+		entry.stamp = m_stamp;
+		entry.end = NO_MATCH;
+		entry.active = true;
+		entry.recursed = false;
+		uint32_t end = match_rule_body(rule_id, pos);
+		// called itself where it started: grow the match while it gets longer
+		while (NO_MATCH != end && entry.recursed)
+		{
+			entry.end = end;
+			uint32_t longer = match_rule_body(rule_id, pos);
+			if (NO_MATCH == longer || longer <= end) break;
+			end = longer;
+		}
+		entry.active = false;
+		entry.end = end;
+		return end;
+	}
+
+	// ------------------------------------------------------------------------
+	uint32_t match_rule_body(uint32_t rule_id, uint32_t pos)
+	{
+		Rule &rule = m_grammar.rule(rule_id);
+		uint32_t end = NO_MATCH;
+		if (RuleMod::OPERATORS == rule.mod()) end = climb(rule_id, pos, 0);
+		else
+		{
+			Captures captures;
+			end = match_alts(m_grammar.alts(rule), pos, true, skipping(rule_id), captures);
+		}
+		// a cut's failure does not leave the rule
+		m_cut_failed = false;
+		// ParserT skips a lazy body by scanning for its close, so the match
+		// only counts where that scan ends too
+		if (RuleMod::LAZY == rule.mod() && NO_MATCH != end && lazy_end(rule, pos) != end) end = NO_MATCH;
+		return end;
+	}
+
+	// ------------------------------------------------------------------------
+	// end of the balanced region of lazy rule at pos as ParserT's lazy_skip()
+	// finds it, stepping over quoted strings and line comments; NO_MATCH if
+	// it is not closed
+	uint32_t lazy_end(Rule &rule, uint32_t pos)
+	{
+		Span<Elem> elems = m_grammar.subs(m_grammar.alts(rule)[0]);
+		char open = decoded(elems[0]).first[0];
+		char close = decoded(elems[elems.size() - 1]).first[0];
+		const std::string &quotes = m_grammar.lazy_quotes();
+		const std::string &comment = m_grammar.lazy_comment();
+		if (pos >= m_len || m_in[pos] != open) return NO_MATCH;
+		uint32_t depth = 0;
+		for (uint32_t i = pos; i < m_len; )
+		{
+			char ch = m_in[i];
+			if (open == ch)
+			{
+				depth++;
+				i++;
+			}
+			else if (close == ch)
+			{
+				i++;
+				if (0 == --depth) return i;
+			}
+			else if (!comment.empty() && at(i, comment))
+			{
+				while (i < m_len && m_in[i] != '\n') i++;
+			}
+			else if (0 != ch && std::string::npos != quotes.find(ch))
+			{
+				for (i++; i < m_len && m_in[i] != ch; i++)
 				{
-					len += len_item;
-					break;
+					if ('\\' == m_in[i] && i + 1 < m_len) i++;
 				}
-				len_item = parse_string(elems);
-				if (len_item >= 0)
+				if (i >= m_len) return NO_MATCH;
+				i++;
+			}
+			else i++;
+		}
+		return NO_MATCH;
+	}
+
+	// ------------------------------------------------------------------------
+	// takes_cut: a failure past a cut nested in an alternate ends here
+	uint32_t match_alts(Span<Elem> alts, uint32_t pos, bool takes_cut, bool skips, Captures &captures)
+	{
+		for (auto &alt : alts)
+		{
+			bool cut = false;
+			uint32_t end = match_alt(alt, pos, cut, skips, captures);
+			if (NO_MATCH != end) return end;
+			if (cut)
+			{
+				m_cut_failed = true;
+				return NO_MATCH;
+			}
+			if (takes_cut) m_cut_failed = false;
+		}
+		return NO_MATCH;
+	}
+
+	// ------------------------------------------------------------------------
+	uint32_t match_alt(Elem &alt, uint32_t pos, bool &cut, bool skips, Captures &captures)
+	{
+		for (auto &elem : m_grammar.subs(alt))
+		{
+			if (ElemType::CUT == elem.type())
+			{
+				cut = true;
+				continue;
+			}
+			pos = match_elem(elem, pos, skips, captures);
+			if (NO_MATCH == pos) return NO_MATCH;
+		}
+		return pos;
+	}
+
+	// ------------------------------------------------------------------------
+	// element with its quantifier, each match preceded by the skip rule if
+	// skips; returns end of match or NO_MATCH
+	uint32_t match_elem(Elem &elem, uint32_t pos, bool skips, Captures &captures)
+	{
+		if (++m_steps > m_max_steps) return NO_MATCH;
+		if (Lookahead::NONE != elem.lookahead())
+		{
+			Elem inner = elem;
+			inner.lookahead() = Lookahead::NONE;
+			bool ok = (NO_MATCH != match_elem(inner, pos, skips, captures));
+			m_cut_failed = false;
+			return (ok == (Lookahead::AND == elem.lookahead())) ? pos : NO_MATCH;
+		}
+
+		uint32_t start = pos;
+		uint32_t end = NO_MATCH;
+		QuantifierType quantifier = elem.quantifier();
+		if (QuantifierType::ONE == quantifier)
+		{
+			end = match_once(elem, skips ? skip(pos) : pos, skips, captures);
+		}
+		else if (QuantifierType::ZERO_ONE == quantifier)
+		{
+			pos = skips ? skip(pos) : pos;
+			end = match_once(elem, pos, skips, captures);
+			if (NO_MATCH == end) end = pos;
+		}
+		else if (QuantifierType::COUNT == quantifier)
+		{
+			const std::string &count = m_grammar.count(elem);
+			uint64_t n = isdigit((uint8_t)count[0]) ? strtoull(count.c_str(), nullptr, 10)
+				: captures[elem.count_id()];
+			if (CAPTURE_OVERFLOW == n) pos = NO_MATCH;
+			for (uint64_t i = 0; NO_MATCH != pos; i++)
+			{
+				pos = skips ? skip(pos) : pos;
+				if (i == n) break;
+				pos = match_once(elem, pos, skips, captures);
+				if (NO_MATCH == pos) break;
+			}
+			end = pos;
+		}
+		else
+		{
+			uint32_t n = 0;
+			for (;; n++)
+			{
+				pos = skips ? skip(pos) : pos;
+				uint32_t next = match_once(elem, pos, skips, captures);
+				if (NO_MATCH == next) break;
+				// an empty match would repeat forever
+				if (next == pos)
 				{
-					len += len_item;
+					n++;
 					break;
 				}
+				pos = next;
 			}
+			end = (QuantifierType::ONE_PLUS == quantifier && 0 == n) ? NO_MATCH : pos;
+		}
 
-			if (len <= 0) return -1;
+		// a failure past a cut fails a repetition or optional, rather than
+		// ending it
+		if (m_cut_failed && QuantifierType::ONE != quantifier && QuantifierType::COUNT != quantifier)
+		{
+			end = NO_MATCH;
+		}
+		if (NO_MATCH != end && StrPool::NO_STR != elem.capture_id())
+		{
+			captures[elem.capture_id()] = capture_value(start, end);
+		}
+		return end;
+	}
 
-			parse_ws();
+	// ------------------------------------------------------------------------
+	// one match of element without its quantifier
+	uint32_t match_once(Elem &elem, uint32_t pos, bool skips, Captures &captures)
+	{
+		if (ElemType::NAME == elem.type()) return match_rule(elem.rule(), pos);
+		else if (ElemType::GROUP == elem.type())
+		{
+			Span<Elem> alts = m_grammar.subs(elem);
+			return match_alts(alts, pos, alts.size() > 1, skips, captures);
+		}
+		else if (ElemType::STRING == elem.type())
+		{
+			const std::string &str = decoded(elem).first;
+			return at(pos, str) ? pos + (uint32_t)str.size() : NO_MATCH;
+		}
+		else if (ElemType::UNTIL == elem.type())
+		{
+			const std::string &str = decoded(elem).first;
+			const char *to = std::search(m_in + pos, m_in + m_len, str.begin(), str.end());
+			return (m_in + m_len == to) ? NO_MATCH : (uint32_t)(to - m_in + str.size());
+		}
+		else if (ElemType::CH_CLASS == elem.type())
+		{
+			if (pos >= m_len) return NO_MATCH;
+			ChClass &cc = decoded(elem).second;
+			if (m_grammar.bytes()) return cc.matches((uint8_t)m_in[pos]) ? pos + 1 : NO_MATCH;
+			char buf[5] = {};
+			memcpy(buf, m_in + pos, std::min(4u, m_len - pos));
+			int32_t ch;
+			int32_t len = utf8_to_int32(&ch, buf);
+			return (len > 0 && pos + len <= m_len && cc.matches(ch)) ? pos + len : NO_MATCH;
+		}
+		return NO_MATCH;
+	}
 
-			char ch = m_text[m_pos];
-			if (ch == '?' || ch == '*' || ch == '+')
+	// ------------------------------------------------------------------------
+	// match of an 'operators' rule using only operators of level min_level
+	// or higher, by precedence climbing as in climb_*()
+	uint32_t climb(uint32_t rule_id, uint32_t pos, uint32_t min_level)
+	{
+		if (++m_steps > m_max_steps) return NO_MATCH;
+		bool have_lhs = false;
+		uint32_t level = 0;
+		uint32_t len = match_op(rule_id, pos, true, level);
+		if (len > 0 && level >= min_level)
+		{
+			uint32_t end = climb(rule_id, op_skip(rule_id, pos + len), level);
+			if (NO_MATCH != end)
 			{
-				QuantifierType qt;
-				if (ch == '?') qt = QuantifierType::ZERO_ONE;
-				else if (ch == '*') qt = QuantifierType::ZERO_PLUS;
-				else if (ch == '+') qt = QuantifierType::ONE_PLUS;
-				elems[elems.size() - 1].quantifier() = qt;
-				m_pos++;
-				m_col++;
-				len++;
+				pos = end;
+				have_lhs = true;
+			}
+		}
+		if (!have_lhs)
+		{
+			Captures captures;
+			pos = match_alts(m_grammar.alts(m_grammar.rule(rule_id)), pos, true, skipping(rule_id), captures);
+			m_cut_failed = false;
+			if (NO_MATCH == pos) return NO_MATCH;
+		}
+		return climb_ops(rule_id, pos, min_level);
+	}
 
-				parse_ws();
+	// ------------------------------------------------------------------------
+	// binary and postfix operators of level min_level or higher, with their
+	// operands, after an operand ending at pos
+	uint32_t climb_ops(uint32_t rule_id, uint32_t pos, uint32_t min_level)
+	{
+		Span<OpLevel> levels = m_grammar.op_levels(m_grammar.rule(rule_id));
+		for (;;)
+		{
+			uint32_t at = op_skip(rule_id, pos);
+			uint32_t level = 0;
+			uint32_t len = match_op(rule_id, at, false, level);
+			if (0 == len || level < min_level) break;
+			if (OpKind::POSTFIX == levels[level].kind)
+			{
+				pos = at + len;
+				continue;
+			}
+			uint32_t next_level = (OpKind::LEFT == levels[level].kind) ? level + 1 : level;
+			uint32_t end = climb(rule_id, op_skip(rule_id, at + len), next_level);
+			if (NO_MATCH == end) break;
+			pos = end;
+		}
+		return pos;
+	}
+
+	// ------------------------------------------------------------------------
+	// longest operator at pos that is a prefix operator or is not, as asked
+	// returns its length, setting level to its level, or 0 if none
+	uint32_t match_op(uint32_t rule_id, uint32_t pos, bool prefix, uint32_t &level)
+	{
+		uint32_t best = 0;
+		for (auto &op : m_ops[rule_id])
+		{
+			if (op.prefix != prefix) continue;
+			if (op.text.size() > best && at(pos, op.text))
+			{
+				best = (uint32_t)op.text.size();
+				level = op.level;
+			}
+		}
+		return best;
+	}
+
+	// ------------------------------------------------------------------------
+	// whether str is in the input at pos
+	bool at(uint32_t pos, const std::string &str)
+	{
+		return str.size() <= m_len - pos && 0 == memcmp(m_in + pos, str.data(), str.size());
+	}
+
+	// ------------------------------------------------------------------------
+	// rule matched around an 'operators' rule's operators
+	uint32_t op_skip(uint32_t rule_id, uint32_t pos)
+	{
+		uint32_t op_skip_rule = m_grammar.rule(rule_id).op_skip();
+		if (Elem::NO_RULE == op_skip_rule) return skipping(rule_id) ? skip(pos) : pos;
+		uint32_t end = match_rule(op_skip_rule, pos);
+		return (NO_MATCH == end) ? pos : end;
+	}
+
+	// ------------------------------------------------------------------------
+	// unescaped string of a string or until element, or class of a class
+	std::pair<std::string &, ChClass &> decoded(Elem &elem)
+	{
+		uint32_t index = elem.tok_first();
+		if (index >= m_decoded.size())
+		{
+			m_strs.resize(index + 1);
+			m_classes.resize(index + 1);
+			m_decoded.resize(index + 1);
+		}
+		if (!m_decoded[index])
+		{
+			if (ElemType::CH_CLASS == elem.type()) m_classes[index] = m_grammar.ch_class(elem);
+			else m_strs[index] = unescape_string(m_grammar.tok(elem, 0));
+			m_decoded[index] = true;
+		}
+		return std::pair<std::string &, ChClass &>(m_strs[index], m_classes[index]);
+	}
+
+	// ------------------------------------------------------------------------
+	// value of a capture as Parser::capture_value() computes it
+	uint64_t capture_value(uint32_t from, uint32_t to)
+	{
+		return capture_number(m_grammar.bytes(), m_in + from, to - from);
+	}
+};
+// definitions of the constants above, which may be bound to references
+const uint64_t GrammarMatcher::STEPS_PER_BYTE;
+const uint32_t GrammarMatcher::NO_MATCH;
+
+// ----------------------------------------------------------------------------
+// random sentence generator for a parsed grammar
+//
+// walks rules from the root, choosing alternatives and repetition counts at
+// random, and streams the result to a FILE.  repetitions directly in the root
+// rule's chosen alternative (the last * or + element) are repeated until the
+// target size is reached, after which every choice falls back to its
+// shallowest completion so the sentence can be closed out.
+//
+// choices are made as if the grammar were a CFG, so a sentence can be one
+// the parser rejects (a greedy repetition swallowing what follows it, an
+// earlier alternative shadowing the one chosen, tokens running together).
+// Each repetition of the growing element is therefore checked with a
+// GrammarMatcher, with the text before it, the one before and the text that
+// closes the sentence around it, and generated again if that does not
+// parse; a sentence without one is checked as a whole
+class CorpusGen
+{
+// private members
+private:
+	// cost assigned to rules that cannot terminate
+	static const uint32_t DEPTH_INF = 0xffffffff;
+	// flush streamed output once buffer reaches this size
+	static const size_t BUF_FLUSH = 1 << 16;
+	// tries at a sentence that parses, and at redoing repetitions growing it
+	// without getting further; each try starts 1 / DEEPER_TRIES of the depth
+	// limit deeper than the one before, so from then on only shallowest
+	// completions are tried
+	static const uint32_t ATTEMPTS = 100;
+	static const uint32_t DEEPER_TRIES = 10;
+	// tries at a repetition before the one before it is redone; few parse
+	// once only shallowest completions are left
+	static const uint32_t PIECE_ATTEMPTS = 2 * DEEPER_TRIES;
+
+	Grammar &m_grammar;
+	FILE *m_out;
+	std::mt19937_64 m_rng;
+
+	uint64_t m_target = 0;
+	uint64_t m_emitted = 0;
+	uint32_t m_max_depth = 64;
+	uint32_t m_max_reps = 4;
+
+	// optional weights for top-level alternatives of named rules
+	std::map<std::string, std::vector<uint32_t>> m_weights;
+	// m_weights by rule id; empty for uniform choice
+	std::vector<std::vector<uint32_t>> m_rule_weights;
+	// minimum rule nesting needed to complete each rule, by rule id
+	std::vector<uint32_t> m_min_depth;
+	// per rule id, whether the skip rule is written before its elements
+	std::vector<bool> m_lexical;
+	uint32_t m_skip_rule = Elem::NO_RULE;
+	// whether elements of the rule being generated are preceded by the skip
+	// rule
+	bool m_skipping = false;
+	// values captured so far in each rule being generated, innermost last
+	std::vector<std::map<uint32_t, uint64_t>> m_captures;
+	std::unordered_map<const Elem *, ChClass> m_classes;
+
+	GrammarMatcher m_matcher;
+	// generating the text that closes the sentence, before the repetitions
+	// that come ahead of it
+	bool m_closing = false;
+	// repetitions growing the sentence were checked, so it needs no check
+	// as a whole
+	bool m_grown = false;
+
+	std::string m_buf;
+
+// public methods
+public:
+	// ------------------------------------------------------------------------
+	CorpusGen(Grammar &grammar, FILE *out, uint64_t seed)
+		: m_grammar(grammar), m_out(out), m_rng(seed), m_matcher(grammar, m_lexical)
+	{
+		m_buf.reserve(BUF_FLUSH * 2);
+	}
+
+	// ------------------------------------------------------------------------
+	uint32_t &max_depth() { return m_max_depth; }
+
+	// ------------------------------------------------------------------------
+	uint32_t &max_reps() { return m_max_reps; }
+
+	// ------------------------------------------------------------------------
+	std::map<std::string, std::vector<uint32_t>> &weights() { return m_weights; }
+
+	// ------------------------------------------------------------------------
+	// per rule id, whether it is lexical (see ParseGen::lexical()); the skip
+	// rule is written before elements of other rules
+	std::vector<bool> &lexical() { return m_lexical; }
+
+	// ------------------------------------------------------------------------
+	// returns number of bytes written
+	uint64_t emitted() { return m_emitted; }
+
+	// ------------------------------------------------------------------------
+	// generate one sentence of at least target bytes (if the root rule has
+	// a repetition to grow) and write it to the output
+	// returns false if grammar cannot produce a finite sentence, or none
+	// that parses was found
+	bool generate(uint64_t target)
+	{
+		m_target = target;
+		m_emitted = 0;
+
+		compute_min_depths();
+		for (uint32_t r = 0; r < m_min_depth.size(); r++)
+		{
+			if (DEPTH_INF == m_min_depth[r])
+			{
+				eprintln("ERROR: rule '", m_grammar.name(r), "' cannot terminate");
+				return false;
+			}
+		}
+		m_rule_weights.assign(m_grammar.rules().size(), std::vector<uint32_t>());
+		for (auto &weight : m_weights)
+		{
+			uint32_t rule_id = m_grammar.find_rule(weight.first);
+			if (Elem::NO_RULE == rule_id
+				|| m_grammar.rule(rule_id).alt_count() != weight.second.size())
+			{
+				eprintln("ERROR: weights for '", weight.first,
+					"' must name a rule and give one weight per alternative");
+				return false;
 			}
+			m_rule_weights[rule_id] = weight.second;
+		}
+		m_skip_rule = m_grammar.skip().empty() ? Elem::NO_RULE : m_grammar.find_rule(m_grammar.skip());
+
+		for (uint32_t attempt = 0; ; attempt++)
+		{
+			if (ATTEMPTS == attempt)
+			{
+				eprintln("ERROR: none of ", ATTEMPTS, " sentences generated parses");
+				return false;
+			}
+			m_buf.clear();
+			m_grown = false;
+			// later tries fall back to shallowest completions sooner
+			uint32_t depth = std::min(m_max_depth, m_max_depth * attempt / DEEPER_TRIES);
+			if (!gen_rule(m_grammar.rule_root(), depth, true)) continue;
+			if (m_grown || m_matcher.matches(m_buf.data(), (uint32_t)m_buf.size())) break;
+		}
+		flush();
+		return true;
+	}
 
-			if (len_item <= 0) break;
-		}
+// private methods
+private:
+	// ------------------------------------------------------------------------
+	bool finishing() { return m_closing || m_emitted + m_buf.size() >= m_target; }
 
-		return len;
-	}
+	// ------------------------------------------------------------------------
+	uint64_t rand_below(uint64_t n) { return (n <= 1) ? 0 : m_rng() % n; }
 
 	// ------------------------------------------------------------------------
-	// group : "(" ws alts ws ")";
-	// returns length on success, -1 on failure
-	int32_t parse_group(std::vector<Elem> &elems)
+	// write out all but the last keep bytes of the buffer
+	void flush(size_t keep = 0)
 	{
-		if (SCC_DEBUG) eprintln("parse_group");
+		size_t n = m_buf.size() - keep;
+		if (n > 0) fwrite(m_buf.data(), 1, n, m_out);
+		m_emitted += n;
+		m_buf.erase(0, n);
+	}
 
-		uint32_t pos_prev = m_pos;
-		uint32_t col_prev = m_col;
-		uint32_t line_prev = m_line;
-		int32_t len = 0;
+	// ------------------------------------------------------------------------
+	// output is only flushed by grow(), once what it holds is checked
+	void emit(const std::string &str) { m_buf += str; }
 
-		char ch = m_text[m_pos];
-		if (ch != '(')
+	// ------------------------------------------------------------------------
+	// fixed-point computation of the minimum rule nesting depth needed to
+	// complete each rule; rules that never terminate keep DEPTH_INF
+	void compute_min_depths()
+	{
+		m_min_depth.assign(m_grammar.rules().size(), (uint32_t)DEPTH_INF);
+		bool changed = true;
+		while (changed)
 		{
-			pos_prev = m_pos;
-			col_prev = m_col;
-			line_prev = m_line;
-			return -1;
+			changed = false;
+			for (uint32_t r = 0; r < m_min_depth.size(); r++)
+			{
+				uint32_t cost = alts_cost(m_grammar.alts(m_grammar.rule(r)));
+				if (cost < m_min_depth[r])
+				{
+					m_min_depth[r] = cost;
+					changed = true;
+				}
+			}
 		}
-		Elem elem_group(ElemType::GROUP);
-		m_pos++;
-		m_col++;
-		len++;
-
-		parse_ws();
+	}
 
-		int32_t len_alts = parse_alts(elem_group.sub_elems());
-		if (len_alts < 0)
+	// ------------------------------------------------------------------------
+	uint32_t alts_cost(Span<Elem> alts)
+	{
+		uint32_t best = DEPTH_INF;
+		for (auto &alt : alts)
 		{
-			pos_prev = m_pos;
-			col_prev = m_col;
-			line_prev = m_line;
-			return -1;
+			uint32_t cost = alt_cost(alt);
+			if (cost < best) best = cost;
 		}
-		len += len_alts;
-
-		parse_ws();
+		return best;
+	}
 
-		ch = m_text[m_pos];
-		if (ch != ')')
+	// ------------------------------------------------------------------------
+	uint32_t alt_cost(Elem &alt)
+	{
+		uint32_t worst = 0;
+		for (auto &elem : m_grammar.subs(alt))
 		{
-			pos_prev = m_pos;
-			col_prev = m_col;
-			line_prev = m_line;
-			return -1;
+			uint32_t cost = elem_cost(elem);
+			if (cost > worst) worst = cost;
 		}
-		elems.push_back(elem_group);
-		m_pos++;
-		m_col++;
-		len++;
+		return worst;
+	}
 
-		return len;
+	// ------------------------------------------------------------------------
+	uint32_t elem_cost(Elem &elem)
+	{
+		if (QuantifierType::ZERO_ONE == elem.quantifier()
+			|| QuantifierType::ZERO_PLUS == elem.quantifier()) return 0;
+		if (QuantifierType::COUNT == elem.quantifier()
+			&& 0 == strtoul(m_grammar.count(elem).c_str(), nullptr, 10)) return 0;
+		if (ElemType::NAME == elem.type())
+		{
+			uint32_t cost = m_min_depth[elem.rule()];
+			return (DEPTH_INF == cost) ? DEPTH_INF : cost + 1;
+		}
+		if (ElemType::GROUP == elem.type()) return alts_cost(m_grammar.subs(elem));
+		return 0;
 	}
 
 	// ------------------------------------------------------------------------
-	// string : "\"" char* "\"";
-	// parse literal string in double quotes
-	// returns length on success, -1 on failure
-	int32_t parse_string(std::vector<Elem> &elems)
+	// pick alternative: a random one of the cheapest when past depth limit or
+	// target size, otherwise weighted (or uniform) random
+	Elem &choose_alt(Span<Elem> alts, uint32_t depth,
+		std::vector<uint32_t> *weights)
 	{
-		if (SCC_DEBUG) eprintln("parse_string ", m_pos);
-		uint32_t pos_prev = m_pos;
-		uint32_t col_prev = m_col;
-		uint32_t line_prev = m_line;
-		char ch = m_text[m_pos];
-		if (ch != '"') return -1;
-		int32_t len = 1;
-		m_pos++;
-		m_col++;
-		bool esc_set = false;
-		for (;; m_pos++, m_col++, len++)
+		if (depth >= m_max_depth || finishing())
 		{
-			ch = m_text[m_pos];
-			if (ch < ' ') break;
-			if (ch == '\\' && !esc_set)
-			{
-				esc_set = true;
-				continue;
-			}
-			if (ch == '"' && !esc_set)
+			uint32_t best = 0;
+			uint32_t best_cost = DEPTH_INF;
+			uint32_t n_best = 0;
+			for (uint32_t a = 0; a < alts.size(); a++)
 			{
-				m_pos++;
-				m_col++;
-				len++;
-				std::string str(&m_text[m_pos - len], len);
-				elems.push_back(Elem(ElemType::STRING, str));
-				return len;
+				uint32_t cost = alt_cost(alts[a]);
+				if (cost < best_cost || DEPTH_INF == best_cost)
+				{
+					best = a;
+					best_cost = cost;
+					n_best = 1;
+				}
+				// ties are picked uniformly, one pass (reservoir sampling)
+				else if (cost == best_cost && 0 == rand_below(++n_best)) best = a;
 			}
-			esc_set = false;
+			return alts[best];
 		}
-		m_pos = pos_prev;
-		m_col = col_prev;
-		m_line = line_prev;
-		return -1;
+		if (nullptr == weights) return alts[rand_below(alts.size())];
+
+		uint64_t total = 0;
+		for (auto w : *weights) total += w;
+		uint64_t pick = rand_below(total);
+		for (uint32_t a = 0; a < alts.size(); a++)
+		{
+			if (pick < (*weights)[a]) return alts[a];
+			pick -= (*weights)[a];
+		}
+		return alts[alts.size() - 1];
 	}
 
 	// ------------------------------------------------------------------------
-	// ch_class : "[" "^"? ch_class_range ("!"? ch_class_range)* "]";
-	// parse bracket expression
-	// returns length on success, -1 on failure
-	int32_t parse_ch_class(std::vector<Elem> &elems)
+	// returns false if fill found no repetition to grow the sentence with
+	// that parses (see grow())
+	bool gen_rule(uint32_t rule_id, uint32_t depth, bool fill)
 	{
-		if (SCC_DEBUG) eprintln("parse_ch_class ", m_pos);
-
-		uint32_t pos_prev = m_pos;
-		uint32_t col_prev = m_col;
-		uint32_t line_prev = m_line;
-
-		int32_t len = 0;
-
-		char ch = m_text[m_pos];
-		if (ch != '[')
+		bool skipping_prev = m_skipping;
+		m_skipping = Elem::NO_RULE != m_skip_rule && rule_id != m_skip_rule
+			&& !(rule_id < m_lexical.size() && m_lexical[rule_id]);
+		m_captures.push_back(std::map<uint32_t, uint64_t>());
+		bool retval = true;
+		if (RuleMod::OPERATORS == m_grammar.rule(rule_id).mod())
 		{
-			if (SCC_DEBUG) eprintln("exiting parse_ch_class ", len);
-			return -1;
+			retval = gen_op_expr(m_grammar.rule(rule_id), depth, fill);
 		}
-
-		Elem elem(ElemType::CH_CLASS);
-		elem.text().push_back("[");
-
-		m_pos++;
-		m_col++;
-		len++;
-		ch = m_text[m_pos];
-
-		// optional logical not for entire expression
-		if (ch == '^')
+		else
 		{
-			elem.text().push_back("^");
-			m_pos++;
-			m_col++;
-			len++;
-			ch = m_text[m_pos];
+			std::vector<uint32_t> *weights = &m_rule_weights[rule_id];
+			if (weights->size() == 0) weights = nullptr;
+			retval = gen_alt(choose_alt(m_grammar.alts(m_grammar.rule(rule_id)), depth, weights), depth, fill);
 		}
+		m_captures.pop_back();
+		m_skipping = skipping_prev;
+		return retval;
+	}
 
-		// first range is required
-		int32_t len_br = parse_ch_class_range(elem);
-		if (-1 == len_br)
+	// ------------------------------------------------------------------------
+	// operands of an 'operators' rule joined by random binary operators,
+	// each with an occasional prefix or postfix operator
+	bool gen_op_expr(Rule &rule, uint32_t depth, bool fill)
+	{
+		std::vector<std::string> binary_ops;
+		std::vector<std::string> prefix_ops;
+		std::vector<std::string> postfix_ops;
+		for (auto &level : m_grammar.op_levels(rule))
 		{
-			m_pos = pos_prev;
-			m_col = col_prev;
-			m_line = line_prev;
-			if (SCC_DEBUG) eprintln("exiting parse_ch_class ", len);
-			return -1;
+			std::vector<std::string> &ops = (OpKind::PREFIX == level.kind) ? prefix_ops
+				: (OpKind::POSTFIX == level.kind) ? postfix_ops : binary_ops;
+			for (uint32_t i = 0; i < level.tok_count; i++)
+			{
+				ops.push_back(unescape_string(m_grammar.tok(level, i)));
+			}
 		}
-		len += len_br;
-
-		// 0 or more additional ranges
-		for (;;)
+		bool grow_ops = depth < m_max_depth && !finishing();
+		auto gen_operand = [&](uint32_t depth)
 		{
-			ch = m_text[m_pos];
-			if (ch == ']') break;
-
-			int32_t valid_range_elements = 0;
-			int32_t len_range = 0;
-			uint32_t pos_prev_range = m_pos;
-			uint32_t col_prev_range = m_col;
-			uint32_t line_prev_range = m_line;
-
-			// optional logical not for this range
-			if (ch == '!')
+			if (grow_ops && !prefix_ops.empty() && 0 == rand_below(4))
 			{
-				elem.text().push_back("!");
-				m_pos++;
-				m_col++;
-				len_range++;
-				valid_range_elements++;
+				emit(prefix_ops[rand_below(prefix_ops.size())]);
+				gen_op_skip(rule, depth);
 			}
-
-			len_br = parse_ch_class_range(elem);
-			if (-1 == len_br)
+			gen_alt(m_grammar.alts(rule)[0], depth, false);
+			if (grow_ops && !postfix_ops.empty() && 0 == rand_below(4))
 			{
-				m_pos = pos_prev_range;
-				m_col = col_prev_range;
-				m_line = line_prev_range;
-				for (int32_t i = 0; i < valid_range_elements; i++)
-				{
-					elem.text().pop_back();
-				}
-				break;
+				gen_op_skip(rule, depth);
+				emit(postfix_ops[rand_below(postfix_ops.size())]);
 			}
-			len += len_range + len_br;
-		}
+		};
 
-		ch = m_text[m_pos];
-		if (ch != ']' || len <= 0)
+		gen_operand(depth);
+		// the first piece is checked with the first operand before it, as a
+		// sentence, later ones with the previous piece, as what follows an
+		// operand
+		if (fill && !binary_ops.empty())
 		{
-			m_pos = pos_prev;
-			m_col = col_prev;
-			m_line = line_prev;
-			len = -1;
+			uint32_t rule_id = m_grammar.rule_root();
+			return grow(std::string(), 0, [&](uint32_t depth)
+			{
+				gen_op(rule, binary_ops, depth);
+				gen_operand(depth);
+			}, [&](bool first, size_t prev_at, size_t piece_at)
+			{
+				bool ok = first ? m_matcher.matches(m_buf.data(), (uint32_t)m_buf.size())
+					: m_matcher.matches_ops(m_buf.data() + prev_at, (uint32_t)(m_buf.size() - prev_at), rule_id);
+				return ok ? piece_at : std::string::npos;
+			});
 		}
-		else
+		uint32_t reps = grow_ops ? (uint32_t)rand_below(m_max_reps + 1) : 0;
+		if (binary_ops.empty()) reps = 0;
+		for (uint32_t r = 0; r < reps; r++)
 		{
-			elem.text().push_back("]");
-			elems.push_back(elem);
-			m_pos++;
-			m_col++;
-			len++;
+			gen_op(rule, binary_ops, depth);
+			gen_operand(depth);
 		}
-
-		if (SCC_DEBUG) eprintln("exiting parse_ch_class ", len);
-		return len;
+		return true;
 	}
 
 	// ------------------------------------------------------------------------
-	// ch_class_range inline : char ("-" char)?;
-	// returns length on success, -1 on failure
-	int32_t parse_ch_class_range(Elem &elem)
+	// random binary operator, with the skip rule before and after
+	void gen_op(Rule &rule, std::vector<std::string> &ops, uint32_t depth)
 	{
-		if (SCC_DEBUG) eprintln("parse_ch_class_range");
-
-		int32_t len = 0;
+		gen_op_skip(rule, depth);
+		emit(ops[rand_below(ops.size())]);
+		gen_op_skip(rule, depth);
+	}
 
-		char ch = m_text[m_pos];
-		if (ch == ']') return -1;
+	// ------------------------------------------------------------------------
+	// rule matched around operators of an 'operators' rule, or the %skip rule
+	void gen_op_skip(Rule &rule, uint32_t depth)
+	{
+		if (Elem::NO_RULE != rule.op_skip()) gen_rule(rule.op_skip(), depth + 1, false);
+		else gen_skip(depth);
+	}
 
-		int32_t len_char = parse_char(elem);
-		if (len_char < 0) return -1;
+	// ------------------------------------------------------------------------
+	// the %skip rule, where the parser runs it
+	void gen_skip(uint32_t depth)
+	{
+		if (m_skipping) gen_rule(m_skip_rule, depth + 1, false);
+	}
 
-		// disallow unescaped reserved character
-		if (len_char == 1)
+	// ------------------------------------------------------------------------
+	// only the last repeating element of a filling alternative grows to the
+	// target size; the elements after it are generated first, so that the
+	// sentence can be checked as it grows
+	bool gen_alt(Elem &alt, uint32_t depth, bool fill)
+	{
+		Span<Elem> elems = m_grammar.subs(alt);
+		uint32_t fill_idx = elems.size();
+		if (fill)
 		{
-			ch = elem.text()[elem.text().size() - 1][0];
-			for (int32_t i = 0; ch_class_reserve_chars[i] != '\0'; i++)
+			for (uint32_t e = 0; e < elems.size(); e++)
 			{
-				if (ch == ch_class_reserve_chars[i])
-				{
-					eprintln("###*", ch, "*");
-					return -1;
-				}
+				if (QuantifierType::ZERO_PLUS == elems[e].quantifier()
+					|| QuantifierType::ONE_PLUS == elems[e].quantifier()) fill_idx = e;
 			}
 		}
+		if (fill_idx == elems.size())
+		{
+			for (auto &elem : elems) gen_elem(elem, depth);
+			return true;
+		}
 
-		len += len_char;
-
-		ch = m_text[m_pos];
-		if (ch != '-') return len;
-		elem.text().push_back(std::string(&m_text[m_pos], 1));
-		m_pos++;
-		m_col++;
-		len++;
-
-		// cannot end with trailing '-'
-		ch = m_text[m_pos];
-		if (ch == ']') return -1;
-
-		len_char = parse_char(elem);
-		if (len_char < 0) return -1;
+		for (uint32_t e = 0; e < fill_idx; e++) gen_elem(elems[e], depth);
+		size_t prefix_len = m_buf.size();
+		m_closing = true;
+		for (uint32_t e = fill_idx + 1; e < elems.size(); e++) gen_elem(elems[e], depth);
+		m_closing = false;
+		std::string suffix = m_buf.substr(prefix_len);
+		m_buf.resize(prefix_len);
+
+		// the parser reads the sentence as the elements before the filling
+		// one, then a match of it per piece, then the rest of the alternate;
+		// a match may also take in text the next piece begins with (e.g. the
+		// whitespace that ends one piece and starts the next), so each piece
+		// is checked from where the match before it starts. A filling
+		// alternate is one of the root rule's
+		uint32_t root = m_grammar.rule_root();
+		Span<Elem> head(elems.begin(), fill_idx);
+		Span<Elem> tail(elems.begin() + fill_idx, elems.size() - fill_idx);
+		Elem once = elems[fill_idx];
+		once.quantifier() = QuantifierType::ONE;
+		uint32_t reps_min = (QuantifierType::ONE_PLUS == elems[fill_idx].quantifier()) ? 1 : 0;
+		return grow(suffix, reps_min, [&](uint32_t depth)
+		{
+			gen_skip(depth);
+			gen_elem_once(once, depth);
+		}, [&](bool first, size_t prev_at, size_t)
+		{
+			const char *text = m_buf.data();
+			uint32_t len = (uint32_t)m_buf.size();
+			if (first)
+			{
+				if (!m_matcher.matches(text, len)) return std::string::npos;
+				uint32_t end = m_matcher.match_elems(text, len, 0, root, head);
+				return (GrammarMatcher::NO_MATCH == end) ? std::string::npos : (size_t)end;
+			}
+			uint32_t end = m_matcher.match_elems(text + prev_at, (uint32_t)(len - prev_at), 0,
+				root, Span<Elem>(&once, 1));
+			if (GrammarMatcher::NO_MATCH == end) return std::string::npos;
+			size_t match_at = prev_at + end;
+			return m_matcher.matches_rest(text + match_at, (uint32_t)(len - match_at), root, tail)
+				? match_at : std::string::npos;
+		});
+	}
 
-		// disallow unescaped reserved character
-		if (len_char == 1)
+	// ------------------------------------------------------------------------
+	// add pieces from gen_piece(depth) to the sentence until it reaches the
+	// target size, then suffix, which closes it
+	//
+	// check(first, prev_at, piece_at) tells whether the sentence parses with
+	// the piece at piece_at in the buffer, which is followed by suffix for the
+	// check, added after the previous one, whose match starts at prev_at;
+	// first if there is no previous piece, when the buffer holds the sentence
+	// from its start. It returns where the piece's own match starts, or
+	// std::string::npos if the sentence does not parse. A piece that does
+	// not is generated again, starting deeper each time, and if none does, so
+	// is the previous one (which may leave nothing that can follow it, e.g. a
+	// comment without its newline). If no first piece parses, returns false;
+	// if no other piece does, the sentence ends short of the target
+	template <typename GenPiece, typename Check>
+	bool grow(const std::string &suffix, uint32_t reps_min, GenPiece gen_piece, Check check)
+	{
+		// pieces still in the buffer: where each one's text and match start;
+		// once some are written out, the last two are kept, so that a piece
+		// redone still has the one before it to be checked with
+		struct Piece
 		{
-			for (int32_t i = 0; ch_class_reserve_chars[i] != '\0'; i++)
+			size_t at;
+			size_t match_at;
+		};
+		std::vector<Piece> pieces;
+		bool flushed = false;
+		uint32_t redone = 0;
+		uint32_t r = 0;
+		uint32_t r_max = 0;
+		while (r < reps_min || !finishing())
+		{
+			size_t mark = m_buf.size();
+			size_t prev_at = pieces.empty() ? mark : pieces.back().match_at;
+			size_t match_at = std::string::npos;
+			bool can_redo = pieces.size() > (flushed ? 1u : 0u) && redone < ATTEMPTS;
+			for (uint32_t attempt = 0; attempt < PIECE_ATTEMPTS && std::string::npos == match_at; attempt++)
+			{
+				m_buf.resize(mark);
+				gen_piece(std::min(m_max_depth, m_max_depth * attempt / DEEPER_TRIES));
+				size_t end = m_buf.size();
+				m_buf += suffix;
+				match_at = check(pieces.empty(), prev_at, mark);
+				m_buf.resize(end);
+				// a piece taken in whole by the match before it adds no match;
+				// that match runs on (e.g. a comment without its newline), so
+				// the piece before is redone
+				if (std::string::npos != match_at && (match_at > end || (match_at == end && end > mark)))
+				{
+					match_at = std::string::npos;
+					if (can_redo) break;
+				}
+			}
+			if (std::string::npos != match_at)
+			{
+				pieces.push_back(Piece{mark, match_at});
+				r++;
+				// pieces are only redone so often without getting further
+				if (r > r_max)
+				{
+					r_max = r;
+					redone = 0;
+				}
+				// nullable element would never reach target
+				if (r > reps_min && m_buf.size() == mark) break;
+				if (m_buf.size() >= BUF_FLUSH && pieces.size() > 2)
+				{
+					pieces.erase(pieces.begin(), pieces.end() - 2);
+					size_t n = std::min(pieces[0].at, pieces[0].match_at);
+					flush(m_buf.size() - n);
+					for (auto &piece : pieces)
+					{
+						piece.at -= n;
+						piece.match_at -= n;
+					}
+					flushed = true;
+				}
+				continue;
+			}
+			m_buf.resize(mark);
+			if (can_redo)
 			{
-				if (ch == ch_class_reserve_chars[i]) return -1;
+				redone++;
+				m_buf.resize(pieces.back().at);
+				pieces.pop_back();
+				r--;
+				continue;
 			}
+			if (0 == r) return false;
+			eprintln("WARNING: no repetition to grow sentence by parsed after ",
+				m_emitted + m_buf.size(), " bytes");
+			break;
 		}
+		size_t mark = m_buf.size();
+		emit(suffix);
+		if (0 == r && std::string::npos == check(true, mark, mark)) return false;
+		m_grown = true;
+		return true;
+	}
 
-		// error if first element >= second one
-		std::string ch1 = elem.text()[1];
-		std::string ch2 = elem.text()[3];
-		bool escaped = false;
-		if (decode_to_int32(&escaped, ch1.c_str()) >= decode_to_int32(&escaped, ch2.c_str()))
+	// ------------------------------------------------------------------------
+	void gen_elem(Elem &elem, uint32_t depth)
+	{
+		uint32_t reps_min = 0;
+		uint32_t reps_max = 1;
+		if (QuantifierType::ONE == elem.quantifier()) reps_min = 1;
+		else if (QuantifierType::ZERO_PLUS == elem.quantifier()) reps_max = m_max_reps;
+		else if (QuantifierType::ONE_PLUS == elem.quantifier())
 		{
-			eprintln("ERROR: invalid range [", ch1, "-", ch2, "]: '", ch1, "' >= '", ch2, "'. left char must be < right char");
-			return -1;
+			reps_min = 1;
+			reps_max = (m_max_reps > 1) ? m_max_reps : 1;
+		}
+		else if (QuantifierType::COUNT == elem.quantifier())
+		{
+			const std::string &count = m_grammar.count(elem);
+			uint64_t n = isdigit((uint8_t)count[0]) ? strtoull(count.c_str(), nullptr, 10)
+				: m_captures.back()[elem.count_id()];
+			// no text matches an overflowed count; the sentence is checked
+			// and generated again
+			reps_min = (CAPTURE_OVERFLOW == n) ? 0 : (uint32_t)n;
+			reps_max = reps_min;
 		}
 
-		len += len_char;
-
-		return len;
+		// past the depth limit, only repetitions of text, which nest no
+		// deeper, still vary
+		uint32_t reps = reps_min;
+		bool text = ElemType::STRING == elem.type() || ElemType::CH_CLASS == elem.type()
+			|| ElemType::UNTIL == elem.type();
+		if (depth < m_max_depth && !finishing())
+		{
+			reps += (uint32_t)rand_below(reps_max - reps_min + 1);
+		}
+		else if (text && reps_max > reps_min) reps += (uint32_t)rand_below(2);
+		size_t start = m_buf.size();
+		for (uint32_t r = 0; r < reps; r++)
+		{
+			gen_skip(depth);
+			gen_elem_once(elem, depth);
+		}
+		if (StrPool::NO_STR != elem.capture_id())
+		{
+			m_captures.back()[elem.capture_id()] = capture_value(m_buf.substr(start));
+		}
 	}
 
 	// ------------------------------------------------------------------------
-	// char inline : [\u0020-\U0010ffff!'!"!\\] | "\\" esc;
-	// esc inline : [!-[\\]^abfnrtv] | unicode;
-	// unicode inline : "u" hex hex hex hex | "U00" hex hex hex hex hex hex;
-	// hex inline : [0-9A-Fa-f];
-	// returns length on success, -1 on failure
-	int32_t parse_char(Elem &elem)
+	void gen_elem_once(Elem &elem, uint32_t depth)
 	{
-		if (SCC_DEBUG) eprintln("parse_char");
-		char ch = m_text[m_pos];
-		if (ch >= 0 && ch < ' ') return -1;
-
-		// if high bit set
-		if (ch < 0)
+		// predicates consume nothing; inputs they reject may be generated
+		if (Lookahead::NONE != elem.lookahead()) return;
+		if (ElemType::NAME == elem.type())
 		{
-			int32_t len = parse_utf8_char();
-			if (len < 0) return -1;
-			elem.text().push_back(std::string(&m_text[m_pos], len));
-			m_pos += len;
-			m_col += len;
-			return len;
+			gen_rule(elem.rule(), depth + 1, false);
 		}
-
-		bool is_esc = false;
-		if (ch == '\\')
+		else if (ElemType::GROUP == elem.type())
 		{
-			is_esc = true;
-			m_pos++;
-			m_col++;
-			ch = m_text[m_pos];
+			gen_alt(choose_alt(m_grammar.subs(elem), depth, nullptr), depth, false);
 		}
-		if (ch >= 0 && ch < ' ') return -1;
-
-		// 1 byte UTF-8 character
-		if (!is_esc)
+		else if (ElemType::STRING == elem.type())
 		{
-			elem.text().push_back(std::string(&m_text[m_pos], 1));
-			m_pos++;
-			m_col++;
-			return 1;
+			emit(unescape_string(m_grammar.tok(elem, 0)));
 		}
-
-		// single-char escapes
-		for (int32_t i = 0; esc_chars[i] != '\0'; i++)
+		// a few letters, unless they could end in part of the terminator
+		else if (ElemType::UNTIL == elem.type())
 		{
-			if (ch == esc_chars[i])
-			{
-				m_pos++;
-				m_col++;
-				elem.text().push_back(std::string(&m_text[m_pos - 2], 2));
-				return 2;
-			}
+			std::string term = unescape_string(m_grammar.tok(elem, 0));
+			std::string str;
+			for (uint64_t n = rand_below(8); n > 0; n--) str += (char)('a' + rand_below(26));
+			if ((str + term).find(term) < str.size()) str.clear();
+			emit(str + term);
 		}
-
-		// \u[0-9A-Fa-f]{4}
-		if (ch == 'u')
+		else if (ElemType::CH_CLASS == elem.type() && m_grammar.bytes())
 		{
-			m_pos++;
-			m_col++;
-			int32_t i = 0;
-			for (; i < 4 && is_hex_char(m_text[m_pos]); i++, m_pos++, m_col++);
-			if (i < 4) return -1;
-			elem.text().push_back(std::string(&m_text[m_pos - 6], 6));
-			return 6;
+			emit(std::string(1, (char)random_class_byte(elem)));
 		}
-
-		// \U[0-9A-Fa-f]{8}
-		if (ch == 'U')
+		else if (ElemType::CH_CLASS == elem.type())
 		{
-			m_pos++;
-			m_col++;
-			int32_t i = 0;
-			for (; i < 8 && is_hex_char(m_text[m_pos]); i++, m_pos++, m_col++);
-			if (i < 8) return -1;
-			elem.text().push_back(std::string(&m_text[m_pos - 10], 10));
-			return 10;
+			std::string str;
+			append_utf8(str, random_ch_class_char(elem));
+			emit(str);
 		}
+	}
 
-		return -1;
+	// ------------------------------------------------------------------------
+	// value of captured text as the parser computes it
+	uint64_t capture_value(const std::string &text) { return capture_number(m_grammar.bytes(), text.data(), text.size()); }
+
+	// ------------------------------------------------------------------------
+	// decoded character class, kept per element
+	ChClass &ch_class(Elem &elem)
+	{
+		auto it = m_classes.find(&elem);
+		if (it == m_classes.end()) it = m_classes.emplace(&elem, m_grammar.ch_class(elem)).first;
+		return it->second;
 	}
 
 	// ------------------------------------------------------------------------
-	// returns length on success, -1 on failure
-	int32_t parse_utf8_char()
+	// pick a random byte in class, for %bytes grammars
+	uint8_t random_class_byte(Elem &elem)
 	{
-		int32_t n_bytes;
-		uint8_t byte = (uint8_t)m_text[m_pos];
-		// in 1 byte case, return immediately; all others must be validated
-		if ((byte & 0x80) == 0) return 1;
-		else if ((byte & 0xe0) == 0xc0) n_bytes = 2;
-		else if ((byte & 0xf0) == 0xe0) n_bytes = 3;
-		else if ((byte & 0xf8) == 0xf0) n_bytes = 4;
-		else return -1;
-		for (int32_t i = 0; i < n_bytes; i++)
+		ChClass &cc = ch_class(elem);
+		std::vector<uint8_t> bytes;
+		for (int32_t ch = 0; ch < 256; ch++)
 		{
-			byte = (uint8_t)m_text[m_pos + i];
-			if ((byte & 0xc0) != 0xc0) return -1;
+			if (cc.matches(ch)) bytes.push_back((uint8_t)ch);
 		}
-		return n_bytes;
+		if (bytes.empty())
+		{
+			eprintln("FATAL ERROR: cannot generate byte for character class", m_grammar.elem_to_string(elem));
+			exit(1);
+		}
+		return bytes[rand_below(bytes.size())];
 	}
 
 	// ------------------------------------------------------------------------
-	// converts escape sequence string to int32_t and returns on success,
-	// returns -1 on failure
-	//
-	// esc_seq : '\\' esc;
-	// esc inline : [\!\-\[\\\]\^abfnrtv] | unicode;
-	// unicode inline : "u" hex hex hex hex | "U00" hex hex hex hex hex hex;
-	// hex inline : [0-9A-Fa-f];
-	int32_t esc_to_int32(const char *str)
+	// pick a random char in class; ranges are sampled uniformly, but any
+	// ASCII part of a range is favoured so huge ranges such as
+	// [\u0020-\U0010ffff] still produce mostly readable text
+	int32_t random_ch_class_char(Elem &elem)
 	{
-		uint32_t i = 0;
-		if (str[i] != '\\') return -1;
-		char ch = str[i + 1];
-		if (ch == 'a') return 0x7;
-		else if (ch == 'b') return 0x8;
-		else if (ch == 'f') return 0xc;
-		else if (ch == 'n') return 0xa;
-		else if (ch == 'r') return 0xd;
-		else if (ch == 't') return 0x9;
-		else if (ch == 'v') return 0xb;
-		else if (ch == '!') return 0x21;
-		else if (ch == '"') return 0x22;
-		//~ else if (ch == '\'') return 0x27;
-		else if (ch == '-') return 0x2d;
-		//~ else if (ch == '?') return 0x3f;
-		else if (ch == '[') return 0x5b;
-		else if (ch == '\\') return 0x5c;
-		else if (ch == ']') return 0x5d;
-		else if (ch == '^') return 0x5e;
-		else if (ch == 'u') return hex_to_int32(&str[i + 2], 4);
-		else if (ch == 'U') return hex_to_int32(&str[i + 2], 8);
-		return -1;
+		ChClass &cc = ch_class(elem);
+		for (uint32_t attempt = 0; attempt < 256; attempt++)
+		{
+			int32_t lo = 0x20;
+			int32_t hi = 0x7e;
+			if (!cc.negate_all && cc.pos.size() > 0)
+			{
+				auto &r = cc.pos[rand_below(cc.pos.size())];
+				lo = r.first;
+				hi = r.second;
+				if (lo < 0x80 && hi >= 0x80 && rand_below(4) > 0) hi = 0x7f;
+			}
+			else if (rand_below(8) == 0)
+			{
+				lo = 0xa0;
+				hi = 0x2ff;
+			}
+			int32_t ch = lo + (int32_t)rand_below((uint64_t)(hi - lo) + 1);
+			if (0 == ch || (ch >= 0xd800 && ch <= 0xdfff)) continue;
+			if (cc.matches(ch)) return ch;
+		}
+		// fall back to scanning printable ASCII and whitespace
+		for (int32_t ch = 1; ch < 0x80; ch++)
+		{
+			if (cc.matches(ch)) return ch;
+		}
+		eprintln("FATAL ERROR: cannot generate char for character class", m_grammar.elem_to_string(elem));
+		exit(1);
 	}
+};
+// definitions of the constants above, which may be bound to references
+const uint32_t CorpusGen::DEPTH_INF;
+const size_t CorpusGen::BUF_FLUSH;
+const uint32_t CorpusGen::ATTEMPTS;
+const uint32_t CorpusGen::DEEPER_TRIES;
+const uint32_t CorpusGen::PIECE_ATTEMPTS;
+};
+
+using namespace IPG;
+
+// ----------------------------------------------------------------------------
+void print_usage(const char *prog)
+{
+	eprintln("Usage: ", prog, " [options] <grammer_file>");
+	eprintln("");
+	eprintln("with no options, prints generated parser to stdout");
+	eprintln("");
+	eprintln("  -o PATH          write output (parser or corpus) to PATH instead of stdout");
+	eprintln("  -u N             with -o, write parser as declarations header PATH plus N");
+	eprintln("                   implementation files PATH_0.cpp .. PATH_<N-1>.cpp (PATH");
+	eprintln("                   without .h extension) that can be compiled in parallel;");
+	eprintln("                   reruns only rewrite files whose contents change");
+	eprintln("  -p PROFILE       counters from Parser::write_profile() of a parser built with");
+	eprintln("                   -DIPG_PROFILE; orders functions by matches, marks hot and");
+	eprintln("                   never-called rules, adds branch hints (used when built with");
+	eprintln("                   -DIPG_HINTS) and tries more often matching alternates first");
+	eprintln("                   where that cannot change the result");
+	eprintln("  -c               collapse every rule's node into its only child, as if all");
+	eprintln("                   rules without a modifier were marked 'collapse'");
+	eprintln("  -e               with collapsing, record ids of collapsed rules in the");
+	eprintln("                   surviving node's ASTNode::elided()");
+	eprintln("  -n               build no AST, e.g. when rule actions compute the result");
+	eprintln("  -m               build only nodes of rules chosen at runtime with");
+	eprintln("                   Parser::subscribe() (default: all)");
+	eprintln("  -t               also write a typed node struct per rule, which the parser");
+	eprintln("                   fills in an Arena as rules match (needs TypedAST.h); with");
+	eprintln("                   -n, only those are built");
+	eprintln("  -i               add Parser::reparse(), which parses again after an edit,");
+	eprintln("                   keeping the nodes the edit cannot have changed");
+	eprintln("  -b               fill a table of every rule's match at every position bottom-up,");
+	eprintln("                   in parallel where rules allow (link with -pthread), before");
+	eprintln("                   building the tree; rules may call themselves where their");
+	eprintln("                   match starts (left recursion)");
+	eprintln("");
+	eprintln("corpus generation (writes random sentences, checked to parse):");
+	eprintln("  -g SIZE          generate at least SIZE bytes (suffix K, M or G)");
+	eprintln("  -s SEED          random seed (default 1)");
+	eprintln("  -d DEPTH         max rule nesting before choosing shallowest completions (default 64)");
+	eprintln("  -r REPS          max repetitions for * and + elements (default 4)");
+	eprintln("  -w RULE=W1,W2..  weights for top-level alternatives of RULE (repeatable)");
+}
+
+// ----------------------------------------------------------------------------
+// parse size with optional K, M or G suffix
+// returns false on failure
+bool parse_size(const char *str, uint64_t *size)
+{
+	char *end = nullptr;
+	*size = strtoull(str, &end, 10);
+	if (end == str) return false;
+	if ('K' == *end || 'k' == *end) { *size <<= 10; end++; }
+	else if ('M' == *end || 'm' == *end) { *size <<= 20; end++; }
+	else if ('G' == *end || 'g' == *end) { *size <<= 30; end++; }
+	return '\0' == *end;
+}
+
+// ----------------------------------------------------------------------------
+// record of the last split output, kept next to it so that a rerun only
+// regenerates units whose rules changed
+//
+// format, one entry per line:
+//  options <hash>
+//  unit <index> <hash>
+//  rule <index> <name>
+class SplitManifest
+{
+public:
+	uint64_t options = 0;
+	std::vector<uint64_t> unit_hashes;
+	std::unordered_map<std::string, uint32_t> rule_units;
 
 	// ------------------------------------------------------------------------
-	int32_t decode_to_int32(bool *escaped, const char *str)
+	// returns false if path cannot be read
+	bool load(const std::string &path)
 	{
-		if (str[0] == '\\')
+		FILE *fp = fopen(path.c_str(), "rb");
+		if (nullptr == fp) return false;
+		std::string text;
+		char buf[4096];
+		size_t n;
+		while ((n = fread(buf, 1, sizeof(buf), fp)) > 0) text.append(buf, n);
+		fclose(fp);
+
+		std::istringstream lines(text);
+		std::string line;
+		while (std::getline(lines, line))
 		{
-			*escaped = true;
-			return esc_to_int32(str);
+			std::istringstream fields(line);
+			std::string key, val1, val2;
+			fields >> key >> val1 >> val2;
+			if ("options" == key) options = strtoull(val1.c_str(), nullptr, 16);
+			else if ("unit" == key)
+			{
+				uint32_t u = (uint32_t)strtoul(val1.c_str(), nullptr, 10);
+				if (u >= unit_hashes.size()) unit_hashes.resize(u + 1, 0);
+				unit_hashes[u] = strtoull(val2.c_str(), nullptr, 16);
+			}
+			else if ("rule" == key)
+			{
+				rule_units[val2] = (uint32_t)strtoul(val1.c_str(), nullptr, 10);
+			}
 		}
-		*escaped = false;
-		int32_t val;
-		int32_t len_item = utf8_to_int32(&val, str);
-		return (len_item > 0) ? val : -1;
+		return true;
 	}
 
 	// ------------------------------------------------------------------------
-	// is character in [0-9A-F]
-	bool is_hex_char(char ch)
+	void print(CodeWriter &out, Grammar &grammar)
 	{
-		return ((ch >= '0' && ch <= '9') || (ch >= 'A' && ch <= 'F')
-				|| (ch >= 'a' && ch <= 'f'));
+		out.println("options ", hex(options));
+		for (uint32_t u = 0; u < unit_hashes.size(); u++)
+		{
+			out.println("unit ", u, " ", hex(unit_hashes[u]));
+		}
+		// in grammar order so the file is stable
+		for (auto &rule : grammar.rules())
+		{
+			auto iter = rule_units.find(grammar.name(rule));
+			if (rule_units.end() != iter) out.println("rule ", iter->second, " ", iter->first);
+		}
 	}
 
+private:
 	// ------------------------------------------------------------------------
-	// convert hex string of 4 or 8 characters to int32_t
-	// returns value on success or -1 on failure
-	int32_t hex_to_int32(const char *str, int32_t len)
+	static std::string hex(uint64_t val)
 	{
-		if (len != 4 && len != 8) return -1;
-		int32_t val = 0;
-		for (int32_t i = 0; i < len; i++)
+		char buf[17];
+		snprintf(buf, sizeof(buf), "%016llx", (unsigned long long)val);
+		return buf;
+	}
+};
+
+// ----------------------------------------------------------------------------
+// version of the code split units are generated as, part of every unit hash;
+// bump it whenever a change to ipg changes what units contain, so that units
+// generated before are regenerated rather than kept
+const uint64_t SPLIT_FORMAT = 1;
+
+// ----------------------------------------------------------------------------
+// write parser as declarations header plus n_units implementation files
+//
+// a manifest (PATH without extension plus ".manifest") records a hash per
+// unit; units whose hash is unchanged since the last run are not
+// regenerated, and no file is rewritten unless its contents change
+// returns false on failure
+bool write_split_parser(ParseGen &pg, const std::string &header_path, uint32_t n_units)
+{
+	std::string stem = header_path;
+	size_t dot = stem.rfind('.');
+	if (std::string::npos != dot && std::string::npos == stem.find_first_of("/\\", dot))
+	{
+		stem.erase(dot);
+	}
+	size_t slash = header_path.find_last_of("/\\");
+	std::string header_name = header_path.substr(std::string::npos == slash ? 0 : slash + 1);
+	std::string manifest_path = stem + ".manifest";
+
+	// anything that affects all units: the format units are generated in,
+	// the header name and the number of units
+	uint64_t options = fnv1a(SPLIT_FORMAT);
+	options = fnv1a(header_name, options);
+	options = fnv1a((uint64_t)n_units, options);
+
+	SplitManifest prev;
+	bool have_prev = prev.load(manifest_path) && prev.options == options;
+	if (!have_prev) prev = SplitManifest();
+
+	uint32_t n_written = 0;
+	CodeWriter &out = pg.out();
+	out.open_if_changed(header_path.c_str());
+	pg.print_parser(true);
+	if (!out.close())
+	{
+		eprintln("ERROR writing file '", header_path, "'");
+		return false;
+	}
+	if (out.changed()) n_written++;
+
+	SplitManifest next;
+	next.options = options;
+	next.unit_hashes.resize(n_units, 0);
+	std::vector<std::vector<uint32_t>> units = pg.partition_rules(n_units, prev.rule_units);
+	uint32_t n_regen = 0;
+	for (uint32_t u = 0; u < n_units; u++)
+	{
+		uint64_t hash = options;
+		for (auto rule_id : units[u])
 		{
-			val <<= 4;
-			char ch = str[i];
-			if (ch >= '0' && ch <= '9') val += ch - '0';
-			else if (ch >= 'A' && ch <= 'F') val += ch - 'A' + 10;
-			else if (ch >= 'a' && ch <= 'f') val += ch - 'a' + 10;
-			else return -1;
+			hash = fnv1a(pg.rule_hash(rule_id), hash);
+			next.rule_units[pg.grammar().name(rule_id)] = u;
 		}
-		return val;
+		next.unit_hashes[u] = hash;
+
+		std::string unit_path = stem + "_" + std::to_string(u) + ".cpp";
+		FILE *fp = fopen(unit_path.c_str(), "rb");
+		bool exists = (nullptr != fp);
+		if (exists) fclose(fp);
+		if (exists && u < prev.unit_hashes.size() && prev.unit_hashes[u] == hash) continue;
+
+		n_regen++;
+		out.open_if_changed(unit_path.c_str());
+		pg.print_unit(header_name, units[u]);
+		if (!out.close())
+		{
+			eprintln("ERROR writing file '", unit_path, "'");
+			return false;
+		}
+		if (out.changed()) n_written++;
 	}
-};
-};
 
-using namespace IPG;
+	out.open_if_changed(manifest_path.c_str());
+	next.print(out, pg.grammar());
+	if (!out.close())
+	{
+		eprintln("ERROR writing file '", manifest_path, "'");
+		return false;
+	}
+	eprintln("regenerated ", n_regen, " of ", n_units, " units; files changed: ", n_written);
+	return true;
+}
 
 // ----------------------------------------------------------------------------
 int main(int argc, char **argv)
 {
-	if (argc < 2)
+	const char *grammar_file = nullptr;
+	const char *out_file = nullptr;
+	const char *profile_file = nullptr;
+	uint32_t n_units = 0;
+	bool collapse_all = false;
+	bool record_elided = false;
+	bool typed = false;
+	bool no_tree = false;
+	bool subscribe = false;
+	bool incremental = false;
+	bool bottom_up = false;
+	bool gen_corpus = false;
+	uint64_t corpus_size = 0;
+	uint64_t seed = 1;
+	uint32_t max_depth = 64;
+	uint32_t max_reps = 4;
+	std::map<std::string, std::vector<uint32_t>> weights;
+
+	for (int i = 1; i < argc; i++)
+	{
+		std::string arg = argv[i];
+		bool has_val = (i + 1 < argc);
+		if ("-g" == arg && has_val)
+		{
+			gen_corpus = true;
+			if (!parse_size(argv[++i], &corpus_size))
+			{
+				eprintln("ERROR: invalid size '", argv[i], "'");
+				return 1;
+			}
+		}
+		else if ("-o" == arg && has_val) out_file = argv[++i];
+		else if ("-p" == arg && has_val) profile_file = argv[++i];
+		else if ("-c" == arg) collapse_all = true;
+		else if ("-e" == arg) record_elided = true;
+		else if ("-t" == arg) typed = true;
+		else if ("-n" == arg) no_tree = true;
+		else if ("-m" == arg) subscribe = true;
+		else if ("-i" == arg) incremental = true;
+		else if ("-b" == arg) bottom_up = true;
+		else if ("-u" == arg && has_val)
+		{
+			n_units = (uint32_t)strtoul(argv[++i], nullptr, 10);
+			if (0 == n_units)
+			{
+				eprintln("ERROR: invalid number of units '", argv[i], "'");
+				return 1;
+			}
+		}
+		else if ("-s" == arg && has_val) seed = strtoull(argv[++i], nullptr, 10);
+		else if ("-d" == arg && has_val) max_depth = (uint32_t)strtoul(argv[++i], nullptr, 10);
+		else if ("-r" == arg && has_val) max_reps = (uint32_t)strtoul(argv[++i], nullptr, 10);
+		else if ("-w" == arg && has_val)
+		{
+			std::string spec = argv[++i];
+			size_t eq = spec.find('=');
+			if (std::string::npos == eq)
+			{
+				eprintln("ERROR: invalid weights '", spec, "'");
+				return 1;
+			}
+			std::vector<uint32_t> &rule_weights = weights[spec.substr(0, eq)];
+			const char *str = spec.c_str() + eq + 1;
+			for (;;)
+			{
+				char *end = nullptr;
+				rule_weights.push_back((uint32_t)strtoul(str, &end, 10));
+				if (',' != *end) break;
+				str = end + 1;
+			}
+		}
+		else if ('-' != arg[0] && nullptr == grammar_file) grammar_file = argv[i];
+		else
+		{
+			print_usage(argv[0]);
+			return 1;
+		}
+	}
+	if (nullptr == grammar_file || (n_units > 0 && nullptr == out_file))
 	{
-		eprintln("Usage: ", argv[0], " <grammer_file>");
+		print_usage(argv[0]);
 		return 1;
 	}
 
 	FILE *fp;
-	fp = fopen(argv[1], "rb");
+	fp = fopen(grammar_file, "rb");
 	if (nullptr == fp)
 	{
-		eprintln("ERROR opening file '", argv[1], "'");
+		eprintln("ERROR opening file '", grammar_file, "'");
 		return 1;
 	}
 	fseek(fp, 0, SEEK_END);
@@ -1819,11 +8653,58 @@ int main(int argc, char **argv)
 	eprintln("read: ", bytes_read);
 
 	ParseGen pg;
+	pg.collapse_all() = collapse_all;
+	pg.record_elided() = record_elided;
+	pg.typed() = typed;
+	pg.no_tree() = no_tree;
+	pg.subscribe() = subscribe;
+	pg.incremental() = incremental;
+	pg.bottom_up() = bottom_up;
 	bool ok = pg.parse_grammar(buf);
 	if (ok) ok = pg.check_rules();
-	if (ok)
+	if (ok && nullptr != profile_file && !pg.load_profile(profile_file))
+	{
+		eprintln("ERROR reading profile '", profile_file, "'");
+		return 1;
+	}
+	if (ok && nullptr != profile_file && !gen_corpus) pg.report_reordering();
+	if (ok && gen_corpus)
+	{
+		FILE *fp_out = stdout;
+		if (nullptr != out_file) fp_out = fopen(out_file, "wb");
+		if (nullptr == fp_out)
+		{
+			eprintln("ERROR opening file '", out_file, "'");
+			return 1;
+		}
+		CorpusGen cg(pg.grammar(), fp_out, seed);
+		cg.max_depth() = max_depth;
+		cg.max_reps() = max_reps;
+		cg.weights() = weights;
+		cg.lexical() = pg.lexical();
+		ok = cg.generate(corpus_size);
+		if (stdout != fp_out) fclose(fp_out);
+		if (ok) eprintln("generated ", cg.emitted(), " bytes");
+	}
+	else if (ok && n_units > 0)
+	{
+		if (!write_split_parser(pg, out_file, n_units)) return 1;
+		pg.print_rules_debug();
+		eprintln("parsed successfully");
+	}
+	else if (ok)
 	{
+		if (!pg.out().open(out_file))
+		{
+			eprintln("ERROR opening file '", out_file, "'");
+			return 1;
+		}
 		pg.print_parser();
+		if (!pg.out().close())
+		{
+			eprintln("ERROR writing output");
+			return 1;
+		}
 		pg.print_rules_debug();
 		eprintln("parsed successfully");
 	}
@@ -1833,5 +8714,5 @@ int main(int argc, char **argv)
 	}
 
 	delete[] buf;
-	return 0;
+	return ok ? 0 : 1;
 }
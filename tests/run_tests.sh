@@ -0,0 +1,169 @@
+#!/bin/sh
+# ----------------------------------------------------------------------------
+# parse tests for generated parsers
+#
+# each grammar in tests/grammars has a .cases file beside it, one input per
+# line: "+ TEXT" must parse, "- TEXT" must not, "= TREE" gives the tree of the
+# case before it (see test_main.cpp). Every grammar is generated and checked
+# once per line of NAME.flags, a set of ipg flags (a blank line for none), or
+# without flags, with -n and with -b if there is no such file. A random
+# corpus generated from each grammar (ipg -g, which checks its sentences with
+# an interpreter of the grammar) must parse too, so that interpreter and the
+# parsers agree. Split output (-u) of a grammar with a NAME.edit file is also
+# regenerated after that edit (see check_regen() below). A grammar with a
+# NAME.error file instead must be rejected, with that line among ipg's errors
+#
+# usage (from any directory):
+#  tests/run_tests.sh [NAME...]
+#
+#  NAME  grammar names without extension (default: all)
+#
+# environment: CXX (default g++), CORPUS_SIZE (default 64K)
+
+set -e
+
+ROOT=$(cd "$(dirname "$0")/.." && pwd)
+BUILD="$ROOT/tests/build"
+CXX=${CXX:-g++}
+CORPUS_SIZE=${CORPUS_SIZE:-64K}
+
+mkdir -p "$BUILD"
+$CXX --std=c++11 -O2 "$ROOT/ipg.cpp" -o "$BUILD/ipg.exe"
+
+if [ $# -eq 0 ]; then
+	set -- $(cd "$ROOT/tests/grammars" && ls *.grammar | sed 's/\.grammar$//')
+fi
+
+# date every file in PDIR back; written() lists the parser files written since
+stamp_old() { touch -d 2000-01-01 "$PDIR"/*; }
+written() { find "$PDIR" -type f -name 'test_parser*' ! -name '*.manifest' -newermt 2000-01-02 | sort; }
+
+# split output is regenerated in place: unchanged, nothing is rewritten; after
+# the edit in NAME.edit (a sed script that changes rules but not what the
+# grammar accepts), only units holding changed rules are, the header only if
+# the edit changes how many -b loop caches there are (N_REPS), and the files
+# are the same as written from scratch with the same manifest, and still pass
+check_regen()
+{
+	stamp_old
+	"$BUILD/ipg.exe" $GEN_FLAGS -o "$PDIR/test_parser.h" "$GRAMMAR" 2>/dev/null
+	if [ -n "$(written)" ]; then
+		echo "FAIL $NAME $FLAGS regenerated unchanged:" $(written)
+		FAILED=1
+		return
+	fi
+	cp "$PDIR/test_parser.h" "$DIR/header_before.h"
+	rm -rf "$DIR/fresh"
+	mkdir -p "$DIR/fresh"
+	cp "$PDIR"/*.manifest "$DIR/fresh"
+	sed -f "$ROOT/tests/grammars/$NAME.edit" "$GRAMMAR" > "$DIR/edited.grammar"
+	"$BUILD/ipg.exe" $GEN_FLAGS -o "$PDIR/test_parser.h" "$DIR/edited.grammar" 2>/dev/null
+	"$BUILD/ipg.exe" $GEN_FLAGS -o "$DIR/fresh/test_parser.h" "$DIR/edited.grammar" 2>/dev/null
+	N_UNITS=$(ls "$PDIR"/test_parser_*.cpp | wc -l)
+	N_WRITTEN=$(written | grep -c '\.cpp$' || true)
+	if diff "$DIR/header_before.h" "$PDIR/test_parser.h" | grep '^[<>]' | grep -qv 'N_REPS = ' \
+		|| [ "$N_WRITTEN" -eq 0 ] \
+		|| { [ "$N_UNITS" -gt 1 ] && [ "$N_WRITTEN" -ge "$N_UNITS" ]; }; then
+		echo "FAIL $NAME $FLAGS regenerated after edit:" $(written)
+		FAILED=1
+		return
+	fi
+	if ! diff -r -q "$PDIR" "$DIR/fresh" > /dev/null; then
+		echo "FAIL $NAME $FLAGS stale after edit:" $(diff -r -q "$PDIR" "$DIR/fresh" | sed 's/^Files \([^ ]*\) .*/\1/')
+		FAILED=1
+		return
+	fi
+	$CXX --std=c++11 -O1 -pthread $DEFS -I"$ROOT" -I"$PDIR" "$ROOT/tests/test_main.cpp" "$PDIR"/test_parser_*.cpp -o "$DIR/test.exe"
+	if "$DIR/test.exe" "$ROOT/tests/grammars/$NAME.cases" "$DIR/corpus.txt"; then
+		echo "ok   $NAME $FLAGS regenerated $N_WRITTEN of $N_UNITS units after edit"
+	else
+		echo "FAIL $NAME $FLAGS after edit"
+		FAILED=1
+	fi
+}
+
+FAILED=0
+for NAME in "$@"; do
+	GRAMMAR="$ROOT/tests/grammars/$NAME.grammar"
+	DIR="$BUILD/$NAME"
+	mkdir -p "$DIR"
+	if [ -f "$ROOT/tests/grammars/$NAME.error" ]; then
+		if "$BUILD/ipg.exe" "$GRAMMAR" > /dev/null 2> "$DIR/ipg_err.txt" \
+			|| ! grep -qxF -f "$ROOT/tests/grammars/$NAME.error" "$DIR/ipg_err.txt"; then
+			echo "FAIL $NAME not rejected with" "$(cat "$ROOT/tests/grammars/$NAME.error")"
+			FAILED=1
+		else
+			echo "ok   $NAME rejected"
+		fi
+		continue
+	fi
+	if ! "$BUILD/ipg.exe" -g "$CORPUS_SIZE" -o "$DIR/corpus.txt" "$GRAMMAR" 2>/dev/null; then
+		echo "FAIL $NAME corpus not generated"
+		FAILED=1
+		continue
+	fi
+	FLAGS_FILE="$ROOT/tests/grammars/$NAME.flags"
+	if [ ! -f "$FLAGS_FILE" ]; then
+		FLAGS_FILE="$DIR/default.flags"
+		printf '\n-n\n-b\n' > "$FLAGS_FILE"
+	fi
+	while IFS= read -r FLAGS <&3; do
+		DEFS=""
+		case " $FLAGS " in *" -n "*) DEFS="$DEFS -DTEST_NO_TREE";; esac
+		case " $FLAGS " in *" -e "*) DEFS="$DEFS -DTEST_ELIDED";; esac
+		case " $FLAGS " in *" -t "*) DEFS="$DEFS -DTEST_TYPED";; esac
+		case " $FLAGS " in *" -m "*) DEFS="$DEFS -DTEST_SUBSCRIBE";; esac
+		case " $FLAGS " in *" -b "*) DEFS="$DEFS -DTEST_BOTTOM_UP";; esac
+		case " $FLAGS " in *" -i "*) DEFS="$DEFS -DTEST_INCREMENTAL";; esac
+		GEN_FLAGS="$FLAGS"
+		case " $FLAGS " in
+		*" -p "*)
+			# -p alone stands for a profile of the corpus, from a parser
+			# generated without it (or -u) and built with -DIPG_PROFILE
+			BASE_FLAGS=$(echo " $FLAGS " | sed 's/ -p / /; s/ -u [0-9]* / /')
+			"$BUILD/ipg.exe" $BASE_FLAGS "$GRAMMAR" > "$DIR/test_parser.h" 2>/dev/null
+			$CXX --std=c++11 -O1 -pthread $DEFS -DIPG_PROFILE -I"$ROOT" -I"$DIR" "$ROOT/tests/test_main.cpp" -o "$DIR/test.exe"
+			"$DIR/test.exe" "$ROOT/tests/grammars/$NAME.cases" "$DIR/corpus.txt" "$DIR/profile.txt" > /dev/null 2>&1 || true
+			GEN_FLAGS=$(echo " $FLAGS " | sed "s| -p | -p $DIR/profile.txt |")
+			DEFS="$DEFS -DIPG_HINTS"
+			;;
+		esac
+		case " $FLAGS " in
+		*" -u "*)
+			# split output, written from scratch into a directory of its own
+			PDIR="$DIR/split"
+			rm -rf "$PDIR"
+			mkdir -p "$PDIR"
+			"$BUILD/ipg.exe" $GEN_FLAGS -o "$PDIR/test_parser.h" "$GRAMMAR" 2>"$DIR/ipg_err.txt"
+			SOURCES=$(ls "$PDIR"/test_parser_*.cpp)
+			;;
+		*)
+			PDIR="$DIR"
+			"$BUILD/ipg.exe" $GEN_FLAGS "$GRAMMAR" > "$PDIR/test_parser.h" 2>"$DIR/ipg_err.txt"
+			# -o writes what stdout gets
+			"$BUILD/ipg.exe" $GEN_FLAGS -o "$PDIR/test_parser_o.h" "$GRAMMAR" 2>/dev/null
+			if ! cmp -s "$PDIR/test_parser.h" "$PDIR/test_parser_o.h"; then
+				echo "FAIL $NAME $FLAGS -o output differs"
+				FAILED=1
+			fi
+			SOURCES=""
+			;;
+		esac
+		if grep -q "&values()" "$PDIR/test_parser.h"; then DEFS="$DEFS -DTEST_VALUES"; fi
+		if grep -q "bool expand(" "$PDIR/test_parser.h"; then DEFS="$DEFS -DTEST_LAZY"; fi
+		if grep -q "split_points(" "$PDIR/test_parser.h"; then DEFS="$DEFS -DTEST_STRUCTURAL"; fi
+		$CXX --std=c++11 -O1 -pthread $DEFS -I"$ROOT" -I"$PDIR" "$ROOT/tests/test_main.cpp" $SOURCES -o "$DIR/test.exe"
+		NOTE=""
+		case " $FLAGS " in *" -p "*) NOTE=" ($(grep -o 'expected alternates tried.*' "$DIR/ipg_err.txt" || true))";; esac
+		if "$DIR/test.exe" "$ROOT/tests/grammars/$NAME.cases" "$DIR/corpus.txt"; then
+			echo "ok   $NAME $FLAGS$NOTE"
+		else
+			echo "FAIL $NAME $FLAGS"
+			FAILED=1
+		fi
+		if [ "$PDIR" != "$DIR" ] && [ -f "$ROOT/tests/grammars/$NAME.edit" ]; then
+			check_regen
+		fi
+	done 3< "$FLAGS_FILE"
+done
+exit $FAILED
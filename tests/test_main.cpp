@@ -0,0 +1,680 @@
+// ----------------------------------------------------------------------------
+// test driver for a generated parser
+//
+// reads a .cases file, one case or check per line:
+//  + TEXT  TEXT must parse; it may use the escapes \n, \r, \t, \\ and \xNN
+//  - TEXT  TEXT must not parse
+//  = TREE  after a "+" line: the nodes it gives below the root, e.g.
+//          list('[' item{value}('1') ']'), text nodes quoted and escaped
+//          as TEXT is (and ' as \', bytes not in UTF-8 characters as \xNN),
+//          rules collapsed into a node in braces after its name, and
+//          payloads skipped by count as <LENGTH>
+//  $ V..   after a "+" line: the values() it leaves
+//  @ L:C   after a "-" line: the line and column its parse got to
+//          (line_ok(), col_ok())
+//  % subscribe RULE..
+//          build only the nodes of these rules in the cases after it (all
+//          of them if none are given)
+// other lines are comments. The nodes of a case that parses must carry the
+// line and column of their position, and every case must parse the same way
+// when read from a ChunkInput in small pieces. Prints each case that does
+// otherwise and exits non-zero if any. A second file given (e.g. a corpus
+// from ipg -g) must parse as a whole, and the same way in pieces; built with
+// -DIPG_PROFILE, the rule counters of that parse are written to a third
+// file, for ipg -p
+//
+// what is checked depends on the parser, as defined when building this:
+//  TEST_NO_TREE  (ipg -n) trees are not checked
+//  TEST_ELIDED   (ipg -e) collapsed rules in trees are checked, else ignored
+//  TEST_VALUES   (%value) values are checked
+//  TEST_BOTTOM_UP (ipg -b) where a failed parse got is not checked, as
+//                rules failing there are not entered; the second file is
+//                parsed with one thread and with four, the same way
+//  TEST_SUBSCRIBE (ipg -m) subscriptions are made, else they are an error
+//  TEST_LAZY     ('lazy' rules) unless TEST_NO_TREE, a "+" case's nodes
+//                left by lazy rules are expanded, and must give the tree of
+//                a parse with set_lazy(false); trees given are those
+//                expanded ones
+//  TEST_INCREMENTAL (ipg -i) each case is also reparse()d from the tree of
+//                the last case that parsed, as an edit of its text, and
+//                must give what parsing it in full does
+//  TEST_STRUCTURAL (%structural) the parts split_points() cuts a "+" case
+//                and the second file into at '\n' must parse on their own,
+//                so such grammars must take any run of whole lines
+//  TEST_TYPED    (ipg -t) the typed nodes the parser fills for a "+" case and
+//                the second file must match their trees node for node, in
+//                rule, position and text; with TEST_NO_TREE there must be a
+//                root node
+//
+// normally built and run by tests/run_tests.sh
+//
+//  NOTE: assumes parser saved to "test_parser.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
+#include "test_parser.h"
+
+using namespace IPG;
+
+// ----------------------------------------------------------------------------
+// TEXT of a case line with its escapes replaced
+std::string unescape(const std::string &str)
+{
+	std::string out;
+	for (size_t i = 0; i < str.size(); i++)
+	{
+		if ('\\' != str[i] || i + 1 == str.size())
+		{
+			out += str[i];
+			continue;
+		}
+		char ch = str[++i];
+		if ('n' == ch) out += '\n';
+		else if ('r' == ch) out += '\r';
+		else if ('t' == ch) out += '\t';
+		else if ('x' == ch && i + 2 < str.size())
+		{
+			out += (char)strtol(str.substr(i + 1, 2).c_str(), nullptr, 16);
+			i += 2;
+		}
+		else out += ch;
+	}
+	return out;
+}
+
+// ----------------------------------------------------------------------------
+// length of the UTF-8 character at str[i], 0 if the bytes there are not one
+size_t utf8_len(const std::string &str, size_t i)
+{
+	unsigned char ch = str[i];
+	size_t len = ch < 0x80 ? 1 : ch < 0xc2 ? 0 : ch < 0xe0 ? 2 : ch < 0xf0 ? 3 : ch < 0xf5 ? 4 : 0;
+	if (i + len > str.size()) return 0;
+	for (size_t j = 1; j < len; j++)
+	{
+		if (0x80 != (str[i + j] & 0xc0)) return 0;
+	}
+	return len;
+}
+
+// ----------------------------------------------------------------------------
+// text quoted for a TREE, escaped as case text is; bytes not in a UTF-8
+// character (from %bytes grammars) as \xNN
+std::string quote(const std::string &str)
+{
+	std::string out = "'";
+	for (size_t i = 0; i < str.size(); i++)
+	{
+		unsigned char ch = str[i];
+		size_t len = utf8_len(str, i);
+		if (len > 1)
+		{
+			out += str.substr(i, len);
+			i += len - 1;
+		}
+		else if ('\n' == ch) out += "\\n";
+		else if ('\r' == ch) out += "\\r";
+		else if ('\t' == ch) out += "\\t";
+		else if ('\\' == ch || '\'' == ch) out += std::string("\\") + (char)ch;
+		else if (ch < 0x20 || ch >= 0x7f)
+		{
+			char hex[8];
+			snprintf(hex, sizeof(hex), "\\x%02x", ch);
+			out += hex;
+		}
+		else out += (char)ch;
+	}
+	return out + "'";
+}
+
+// ----------------------------------------------------------------------------
+// node and its subtree in the form of a TREE line
+std::string tree(ASTNode &node)
+{
+	if (node.span_len() > 0) return "<" + std::to_string(node.span_len()) + ">";
+	if (ASTNode::NO_RULE == node.rule_id() && node.children().empty()) return quote(node.text());
+	std::string out = node.text();
+	if (!node.elided().empty())
+	{
+		out += "{";
+		for (size_t i = 0; i < node.elided().size(); i++)
+		{
+			if (i > 0) out += ",";
+			out += Parser::rule_name(node.elided()[i]);
+		}
+		out += "}";
+	}
+	out += "(";
+	for (size_t i = 0; i < node.children().size(); i++)
+	{
+		if (i > 0) out += " ";
+		out += tree(node.child(i));
+	}
+	return out + ")";
+}
+
+// ----------------------------------------------------------------------------
+// TREE without the collapsed rules after node names
+std::string without_elided(const std::string &tree)
+{
+	std::string out;
+	bool quoted = false;
+	for (size_t i = 0; i < tree.size(); i++)
+	{
+		if (quoted && '\\' == tree[i])
+		{
+			out += tree.substr(i++, 2);
+			continue;
+		}
+		if ('\'' == tree[i]) quoted = !quoted;
+		if (!quoted && '{' == tree[i])
+		{
+			i = tree.find('}', i);
+			if (std::string::npos == i) break;
+			continue;
+		}
+		out += tree[i];
+	}
+	return out;
+}
+
+// ----------------------------------------------------------------------------
+// nodes below root, as they are given on a "=" line
+std::string children_tree(ASTNode &root)
+{
+	std::string out;
+	for (auto &child : root.children())
+	{
+		if (!out.empty()) out += " ";
+		out += tree(child);
+	}
+	return out;
+}
+
+// ----------------------------------------------------------------------------
+// node and its subtree with everything a parse sets in them, for comparing
+// trees made in different ways
+std::string layout(ASTNode &node)
+{
+	std::string out = quote(node.text()) + "@" + std::to_string(node.pos()) + ":"
+		+ std::to_string(node.line()) + ":" + std::to_string(node.col());
+	if (ASTNode::NO_RULE != node.rule_id()) out += "#" + std::to_string(node.rule_id());
+	if (node.lazy_len() > 0) out += "~" + std::to_string(node.lazy_len());
+	if (node.span_len() > 0) out += "+" + std::to_string(node.span_len());
+	for (auto id : node.elided()) out += "^" + std::to_string(id);
+	if (node.children().empty()) return out;
+	out += "(";
+	for (auto &child : node.children()) out += layout(child) + " ";
+	return out + ")";
+}
+
+// ----------------------------------------------------------------------------
+// newlines in text within the payloads in node's subtree replaced, as they
+// are not counted into line numbers
+void blank_spans(std::string &text, ASTNode &node)
+{
+	for (uint32_t i = node.pos(); i < node.pos() + node.span_len() && i < text.size(); i++)
+	{
+		if ('\n' == text[i]) text[i] = ' ';
+	}
+	for (auto &child : node.children()) blank_spans(text, child);
+}
+
+// ----------------------------------------------------------------------------
+// description of the first node in node's subtree whose line and column are
+// not those of its position in text (with blank_spans() done), empty if all
+// agree
+std::string position_mismatch(const std::string &text, ASTNode &node)
+{
+	uint32_t line = 1;
+	uint32_t col = 1;
+	for (uint32_t i = 0; i < node.pos() && i < text.size(); i++)
+	{
+		col++;
+		if ('\n' == text[i])
+		{
+			line++;
+			col = 1;
+		}
+	}
+	if (line != node.line() || col != node.col())
+	{
+		return quote(node.text()) + " at " + std::to_string(node.pos()) + " is at " + std::to_string(node.line())
+			+ ":" + std::to_string(node.col()) + ", not " + std::to_string(line) + ":" + std::to_string(col);
+	}
+	for (auto &child : node.children())
+	{
+		std::string mismatch = position_mismatch(text, child);
+		if (!mismatch.empty()) return mismatch;
+	}
+	return "";
+}
+
+// ----------------------------------------------------------------------------
+// what a parse left (its tree, values and where it got to), for comparing
+// parses of the same text through different inputs
+template <class P>
+std::string outcome(P &p, bool parsed, ASTNode &root)
+{
+	std::ostringstream out;
+	out << (parsed ? layout(root) : "(failed)") << " at " << p.line_ok() << ":" << p.col_ok();
+#ifdef TEST_VALUES
+	for (auto &value : p.values()) out << " " << value;
+#endif
+	return out.str();
+}
+
+// ----------------------------------------------------------------------------
+// outcome() of parsing text with a ChunkParser over pieces of n bytes, each
+// copied into a buffer of its own so that nothing reads on from one into
+// the next
+std::string chunked_outcome(const std::string &text, size_t n, const std::vector<uint32_t> &subscribed)
+{
+	std::vector<std::string> pieces;
+	for (size_t pos = 0; pos < text.size(); pos += n) pieces.push_back(text.substr(pos, n));
+	std::vector<Chunk> chunks;
+	for (auto &piece : pieces) chunks.push_back({piece.data(), piece.size()});
+	ChunkInput in(chunks);
+	ChunkParser p(in);
+#ifdef TEST_SUBSCRIBE
+	if (!subscribed.empty()) p.subscribe(subscribed);
+#else
+	(void)subscribed;
+#endif
+	ASTNode astn(0, 1, 1, "ROOT");
+	bool parsed = (RET_OK == p.parse(astn));
+	return outcome(p, parsed, astn);
+}
+
+#ifdef TEST_INCREMENTAL
+// ----------------------------------------------------------------------------
+// outcome() of reparse() of old, the tree of old_text, over text, after an
+// edit found as the bytes between the prefix and suffix the two share
+std::string reparsed_outcome(ASTNode old, const std::string &old_text, const std::string &text)
+{
+	size_t n = std::min(old_text.size(), text.size());
+	size_t prefix = 0;
+	while (prefix < n && old_text[prefix] == text[prefix]) prefix++;
+	size_t suffix = 0;
+	while (suffix < n - prefix && old_text[old_text.size() - 1 - suffix] == text[text.size() - 1 - suffix]) suffix++;
+	Parser p(text.c_str(), text.size());
+	bool parsed = (RET_OK == p.reparse(old, (uint32_t)prefix, (uint32_t)(old_text.size() - prefix - suffix),
+		(uint32_t)(text.size() - prefix - suffix)));
+	return outcome(p, parsed, old);
+}
+#endif
+
+#ifdef TEST_STRUCTURAL
+// ----------------------------------------------------------------------------
+// the first of the parts split_points() cuts text into that does not parse
+// on its own, as "FROM-TO", empty if all do
+std::string unparsed_part(Parser &p, const std::string &text, uint32_t parts)
+{
+	std::vector<uint32_t> points = p.split_points(parts, '\n');
+	points.push_back((uint32_t)text.size());
+	uint32_t from = 0;
+	for (auto to : points)
+	{
+		std::string part = text.substr(from, to - from);
+		ASTNode astn(0, 1, 1, "ROOT");
+		Parser pp(part.c_str(), part.size());
+		if (RET_OK != pp.parse(astn)) return std::to_string(from) + "-" + std::to_string(to);
+		from = to;
+	}
+	return "";
+}
+#endif
+
+#if defined(TEST_LAZY) && !defined(TEST_NO_TREE)
+// ----------------------------------------------------------------------------
+// expand node, if left by a 'lazy' rule, and the nodes below it
+// returns false if a body does not match its rule
+bool expand_all(Parser &p, ASTNode &node)
+{
+	if (!p.expand(node)) return false;
+	for (auto &child : node.children())
+	{
+		if (!expand_all(p, child)) return false;
+	}
+	return true;
+}
+#endif
+
+#ifdef TEST_TYPED
+// ----------------------------------------------------------------------------
+// description of how typed node tn, filled by the parser, and node, the
+// ASTNode of the same match, differ below and at them, empty if they agree
+//
+// the children compared are those built by rules, or all of them under an
+// operator level or 'operators' rule (whose text nodes tell it apart), put
+// in input order
+std::string typed_mismatch(const TypedNode *tn, ASTNode &node)
+{
+	std::string text;
+	for (auto &child : node.children())
+	{
+		if (ASTNode::NO_RULE == child.rule_id() && child.children().empty()) text += child.text();
+	}
+	if (TypedNode::OP_LEVEL == tn->rule_id || TypedNode::NO_RULE == tn->rule_id) text = node.text();
+	if (tn->rule_id != node.rule_id() && !(TypedNode::OP_LEVEL == tn->rule_id && ASTNode::NO_RULE == node.rule_id()))
+	{
+		return node.text() + " at " + std::to_string(node.pos()) + " built rule " + std::to_string(tn->rule_id);
+	}
+	if (tn->pos != node.pos() || tn->line != node.line() || tn->col != node.col()
+		|| std::string(tn->text, tn->text_len) != text)
+	{
+		return node.text() + " at " + std::to_string(node.pos()) + " built one at " + std::to_string(tn->pos)
+			+ " with text " + quote(std::string(tn->text, tn->text_len));
+	}
+	std::vector<const TypedNode *> typed;
+	typed_children(tn, typed);
+	std::stable_sort(typed.begin(), typed.end(), [](const TypedNode *a, const TypedNode *b)
+	{
+		return a->pos < b->pos;
+	});
+	bool items = (TypedNode::OP_LEVEL == tn->rule_id);
+	for (auto child : typed) items |= (TypedNode::NO_RULE == child->rule_id || TypedNode::OP_LEVEL == child->rule_id);
+	std::vector<ASTNode *> below;
+	for (auto &child : node.children())
+	{
+		if (items || ASTNode::NO_RULE != child.rule_id()) below.push_back(&child);
+	}
+	if (below.size() != typed.size())
+	{
+		return node.text() + " at " + std::to_string(node.pos()) + " has " + std::to_string(below.size())
+			+ " children, its typed node " + std::to_string(typed.size());
+	}
+	for (size_t i = 0; i < below.size(); i++)
+	{
+		std::string mismatch = typed_mismatch(typed[i], *below[i]);
+		if (!mismatch.empty()) return mismatch;
+	}
+	return "";
+}
+
+// ----------------------------------------------------------------------------
+// description of how the typed nodes p filled and the tree below root differ,
+// empty if they agree; without a tree, p must have filled a root node if it
+// matched anything
+std::string typed_root_mismatch(Parser &p, ASTNode &root)
+{
+	const TypedNode *tn = p.typed_root();
+#ifdef TEST_NO_TREE
+	(void)root;
+	if (nullptr == tn && p.len() > 0) return "the root missing";
+	return "";
+#else
+	ASTNode *top = nullptr;
+	for (auto &child : root.children())
+	{
+		if (ASTNode::NO_RULE != child.rule_id())
+		{
+			top = &child;
+			break;
+		}
+	}
+	if (nullptr == tn && nullptr == top) return "";
+	if (nullptr == tn || nullptr == top) return std::string("the root missing from the ") + ((nullptr == tn) ? "typed nodes" : "tree");
+	return typed_mismatch(tn, *top);
+#endif
+}
+#endif
+
+int main(int argc, char **argv)
+{
+	if (argc < 2)
+	{
+		eprintln("Usage: ", argv[0], " <cases_file> [<input_file> [<profile_file>]]");
+		return 1;
+	}
+	std::ifstream cases(argv[1]);
+	if (!cases)
+	{
+		eprintln("ERROR opening file: ", argv[1]);
+		return 1;
+	}
+
+	uint32_t n_failed = 0;
+	uint32_t line_num = 0;
+	// tree and values of the last case, if it was "+" and parsed
+	ASTNode last(0, 1, 1, "ROOT");
+	std::string last_values;
+	bool last_parsed = false;
+	// where the last case stopped, if it was "-" and did not parse
+	std::string last_stop;
+	bool last_failed = false;
+	// rules subscribed to, none for all
+	std::vector<uint32_t> subscribed;
+#ifdef TEST_INCREMENTAL
+	// the last case that parsed, the tree reparse() starts from for the next
+	ASTNode prev_tree;
+	std::string prev_text;
+	bool prev_parsed = false;
+	uint32_t prev_line_num = 0;
+#endif
+	for (std::string line; std::getline(cases, line);)
+	{
+		line_num++;
+		if (line.size() < 2 || ' ' != line[1]) continue;
+		if ('=' == line[0])
+		{
+#ifndef TEST_NO_TREE
+			std::string got = children_tree(last);
+			std::string want = line.substr(2);
+#ifndef TEST_ELIDED
+			want = without_elided(want);
+#endif
+			if (last_parsed && got != want)
+			{
+				eprintln(argv[1], ":", line_num, ": tree is ", got);
+				n_failed++;
+			}
+#endif
+			continue;
+		}
+		if ('$' == line[0])
+		{
+#ifdef TEST_VALUES
+			if (last_parsed && last_values != line.substr(2))
+			{
+				eprintln(argv[1], ":", line_num, ": values are ", last_values);
+				n_failed++;
+			}
+#endif
+			continue;
+		}
+		if ('@' == line[0])
+		{
+#ifndef TEST_BOTTOM_UP
+			if (last_failed && last_stop != line.substr(2))
+			{
+				eprintln(argv[1], ":", line_num, ": stopped at ", last_stop);
+				n_failed++;
+			}
+#endif
+			continue;
+		}
+		if (0 == line.compare(0, 11, "% subscribe"))
+		{
+#ifdef TEST_SUBSCRIBE
+			subscribed.clear();
+			std::istringstream names(line.substr(11));
+			for (std::string name; names >> name;)
+			{
+				subscribed.push_back(Parser::rule_id(name));
+				if (Parser::N_RULES == subscribed.back())
+				{
+					eprintln(argv[1], ":", line_num, ": no rule ", name);
+					n_failed++;
+				}
+			}
+#else
+			eprintln(argv[1], ":", line_num, ": subscriptions need a parser generated with -m");
+			n_failed++;
+#endif
+			continue;
+		}
+		if ('+' != line[0] && '-' != line[0]) continue;
+		std::string text = unescape(line.substr(2));
+		ASTNode astn(0, 1, 1, "ROOT");
+		Parser p(text.c_str(), text.size());
+#ifdef TEST_SUBSCRIBE
+		if (!subscribed.empty()) p.subscribe(subscribed);
+#endif
+		bool parsed = (RET_OK == p.parse(astn));
+		if (parsed != ('+' == line[0]))
+		{
+			eprintln(argv[1], ":", line_num, ": ", parsed ? "parsed" : "did not parse", ": ", line.substr(2));
+			n_failed++;
+		}
+		std::string whole = outcome(p, parsed, astn);
+		for (size_t n : {1, 2, 5})
+		{
+			std::string chunked = chunked_outcome(text, n, subscribed);
+			if (chunked != whole)
+			{
+				eprintln(argv[1], ":", line_num, ": in pieces of ", n, " bytes gives ", chunked, ", not ", whole);
+				n_failed++;
+				break;
+			}
+		}
+#ifdef TEST_INCREMENTAL
+		if (prev_parsed)
+		{
+			std::string reparsed = reparsed_outcome(prev_tree, prev_text, text);
+			if (reparsed != whole)
+			{
+				eprintln(argv[1], ":", line_num, ": reparsed after line ", prev_line_num, " gives ", reparsed, ", not ", whole);
+				n_failed++;
+			}
+		}
+		if (parsed)
+		{
+			prev_parsed = true;
+			prev_tree = astn;
+			prev_text = text;
+			prev_line_num = line_num;
+		}
+#endif
+#ifdef TEST_STRUCTURAL
+		std::string unparsed = parsed ? unparsed_part(p, text, 3) : "";
+		if (!unparsed.empty())
+		{
+			eprintln(argv[1], ":", line_num, ": part ", unparsed, " from split_points() does not parse");
+			n_failed++;
+		}
+#endif
+#if defined(TEST_LAZY) && !defined(TEST_NO_TREE)
+		if (parsed && '+' == line[0])
+		{
+			ASTNode eager(0, 1, 1, "ROOT");
+			Parser pe(text.c_str(), text.size());
+			pe.set_lazy(false);
+			bool eager_parsed = (RET_OK == pe.parse(eager));
+			bool expanded = expand_all(p, astn);
+			if (expanded != eager_parsed || (expanded && layout(astn) != layout(eager)))
+			{
+				eprintln(argv[1], ":", line_num, ": expanded ", expanded ? layout(astn) : "(failed)",
+					" but parsed in full ", eager_parsed ? layout(eager) : "(failed)");
+				n_failed++;
+			}
+			parsed = expanded;
+		}
+#endif
+#ifndef TEST_NO_TREE
+		std::string counted = text;
+		blank_spans(counted, astn);
+		std::string misplaced = parsed ? position_mismatch(counted, astn) : "";
+		if (!misplaced.empty())
+		{
+			eprintln(argv[1], ":", line_num, ": node ", misplaced);
+			n_failed++;
+		}
+#endif
+#ifdef TEST_TYPED
+		std::string mismatch = parsed ? typed_root_mismatch(p, astn) : "";
+		if (!mismatch.empty())
+		{
+			eprintln(argv[1], ":", line_num, ": typed node of ", mismatch);
+			n_failed++;
+		}
+#endif
+#ifdef TEST_VALUES
+		std::ostringstream values;
+		for (size_t i = 0; i < p.values().size(); i++) values << ((i > 0) ? " " : "") << p.values()[i];
+		last_values = values.str();
+#endif
+		last = std::move(astn);
+		last_parsed = parsed && '+' == line[0];
+		last_stop = std::to_string(p.line_ok()) + ":" + std::to_string(p.col_ok());
+		last_failed = !parsed && '-' == line[0];
+	}
+	if (argc > 2)
+	{
+		std::ifstream input(argv[2], std::ios::binary);
+		if (!input)
+		{
+			eprintln("ERROR opening file: ", argv[2]);
+			return 1;
+		}
+		std::stringstream ss;
+		ss << input.rdbuf();
+		std::string text = ss.str();
+		ASTNode astn(0, 1, 1, "ROOT");
+		Parser p(text.c_str(), text.size());
+#ifdef TEST_BOTTOM_UP
+		p.set_threads(1);
+#endif
+		bool parsed = (RET_OK == p.parse(astn));
+		if (!parsed)
+		{
+			eprintln(argv[2], ": did not parse, stopped at line ", p.line_ok(), " col ", p.col_ok());
+			n_failed++;
+		}
+		else if (chunked_outcome(text, 61, {}) != outcome(p, true, astn))
+		{
+			eprintln(argv[2], ": parsed differently in pieces of 61 bytes");
+			n_failed++;
+		}
+#ifdef TEST_TYPED
+		std::string mismatch = parsed ? typed_root_mismatch(p, astn) : "";
+		if (!mismatch.empty())
+		{
+			eprintln(argv[2], ": typed node of ", mismatch);
+			n_failed++;
+		}
+#endif
+#ifdef TEST_STRUCTURAL
+		std::string unparsed = parsed ? unparsed_part(p, text, 8) : "";
+		if (!unparsed.empty())
+		{
+			eprintln(argv[2], ": part ", unparsed, " from split_points() does not parse");
+			n_failed++;
+		}
+#endif
+#ifdef TEST_BOTTOM_UP
+		// the table is filled by one thread per 16K positions at most
+		ASTNode threaded(0, 1, 1, "ROOT");
+		Parser pt(text.c_str(), text.size());
+		pt.set_threads(4);
+		bool threaded_parsed = (RET_OK == pt.parse(threaded));
+		if (outcome(pt, threaded_parsed, threaded) != outcome(p, parsed, astn))
+		{
+			eprintln(argv[2], ": parsed differently with 4 threads");
+			n_failed++;
+		}
+#endif
+#ifdef IPG_PROFILE
+		FILE *fp = (argc > 3) ? fopen(argv[3], "w") : nullptr;
+		if (nullptr != fp)
+		{
+			p.write_profile(fp);
+			fclose(fp);
+		}
+#endif
+	}
+	return (n_failed > 0) ? 1 : 0;
+}
@@ -4,20 +4,37 @@
 #include <cstdint>
 #include <iostream>
 
+// ----------------------------------------------------------------------------
+// branch and function placement hints used by generated parsers; they have
+// not been shown to speed parsing up, so they are off unless the parser is
+// built with -DIPG_HINTS
+#if defined(IPG_HINTS) && (defined(__GNUC__) || defined(__clang__))
+#define IPG_LIKELY(x) __builtin_expect(!!(x), 1)
+#define IPG_UNLIKELY(x) __builtin_expect(!!(x), 0)
+#define IPG_HOT __attribute__((hot))
+#define IPG_COLD __attribute__((cold))
+#else
+#define IPG_LIKELY(x) (x)
+#define IPG_UNLIKELY(x) (x)
+#define IPG_HOT
+#define IPG_COLD
+#endif
+
 namespace IPG
 {
 // ----------------------------------------------------------------------------
 // variadic wrapper functions for printing to cout and cerr
 // single-argument
 template <typename T>
-void printstr(std::ostream &strm, std::string sep, std::string term, T t)
+void printstr(std::ostream &strm, const char *sep, const char *term, const T &t)
 {
   strm << t << term;
 }
 
 // multi-argument
 template<typename T, typename... Args>
-void printstr(std::ostream &strm, std::string sep, std::string term, T t, Args... args)
+void printstr(std::ostream &strm, const char *sep, const char *term, const T &t,
+  const Args &... args)
 {
   strm << t << sep;
   printstr(strm, sep, term, args...);
@@ -25,28 +42,28 @@ void printstr(std::ostream &strm, std::string sep, std::string term, T t, Args..
 
 // cout, no separator, no terminator
 template<typename T, typename... Args>
-void prints(T t, Args... args)
+void prints(const T &t, const Args &... args)
 {
   printstr(std::cout, "", "", t, args...);
 }
 
 // cerr, no separator, no terminator
 template<typename T, typename... Args>
-void eprints(T t, Args... args)
+void eprints(const T &t, const Args &... args)
 {
   printstr(std::cerr, "", "", t, args...);
 }
 
 // cout, no separator, newline-terminated
 template<typename T, typename... Args>
-void println(T t, Args... args)
+void println(const T &t, const Args &... args)
 {
   printstr(std::cout, "", "\n", t, args...);
 }
 
 // cerr, no separator, newline-terminated
 template<typename T, typename... Args>
-void eprintln(T t, Args... args)
+void eprintln(const T &t, const Args &... args)
 {
   printstr(std::cerr, "", "\n", t, args...);
 }
@@ -55,7 +72,7 @@ void eprintln(T t, Args... args)
 // decode a utf-8 character into a 32-bit number
 // on success, writes extracted code bits to num
 // returns number of bytes from utf-8 on success or -1 on failure
-int32_t utf8_to_int32(int32_t *num, const char *str)
+inline int32_t utf8_to_int32(int32_t *num, const char *str)
 {
 	int32_t n_bytes;
 	uint8_t byte = (uint8_t)str[0];